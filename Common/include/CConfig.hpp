@@ -154,6 +154,8 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool Fused_Gradient_Limiter;       /*!< \brief Gather the min/max for the limiters with the reconstruction gradients. */
+  bool Overlap_Halo_Comms;           /*!< \brief Exchange the reconstruction halos while computing the interior fluxes. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   ENUM_REGIME Kind_Regime;           /*!< \brief Kind of flow regime: in/compressible. */
@@ -430,6 +432,8 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  unsigned short NK_MaxJacobianAge;  /*!< \brief Max. number of NK iterations that reuse the Jacobian. */
+  su2double NK_ReuseTolerance;       /*!< \brief Degradation of the NK convergence that forces a Jacobian update. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -630,8 +634,16 @@ private:
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Size of the recycled subspace of GCRO-DR. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Levels;                 /*!< \brief Level-scheduled (instead of partitioned) threaded ILU. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Max. number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Number of smoothing sweeps of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
+  su2double Linear_Solver_AMG_Relaxation;        /*!< \brief Relaxation of the AMG block-Jacobi smoother. */
+  bool Linear_Solver_SELL;                       /*!< \brief Use the sliced ELLPACK storage for SIMD linear algebra. */
+  PREC_STORAGE Linear_Solver_Prec_Storage;       /*!< \brief Format of the stored preconditioner factors. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -705,6 +717,8 @@ private:
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned long Restart_Aggregators;  /*!< \brief Number of ranks that gather and write the binary restart data. */
+  bool Restart_Async;                 /*!< \brief Write the binary restart data from a background thread. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -1042,6 +1056,8 @@ private:
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
   bool FEAAdvancedMode;             /*!< \brief Determine if advanced features are used from the element-based FEA analysis (experimental). */
+  bool FEA_MatrixFree;              /*!< \brief Apply the FEA tangent operator element by element instead of assembling the Jacobian. */
+  bool FEA_Vectorization;           /*!< \brief Compute the FEA element matrices for SIMD-width batches of elements. */
   su2double RefGeom_Penalty,        /*!< \brief Penalty weight value for the reference geometry objective function. */
   RefNode_Penalty,                  /*!< \brief Penalty weight value for the reference node objective function. */
   DV_Penalty;                       /*!< \brief Penalty weight to add a constraint to the total amount of stiffness. */
@@ -1051,6 +1067,15 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  long ParMETIS_wallWgt;            /*!< \brief Load balancing weight added to points on viscous walls. */
+  bool ParMETIS_multiConstraint;    /*!< \brief Balance the wall weight as a separate constraint. */
+  bool ParMETIS_calibration;        /*!< \brief Measure the costs of the partitioning categories and reuse them. */
+  string ParMETIS_calibrationFile;  /*!< \brief File of the measured partitioning costs. */
+  unsigned long ParMETIS_rebalanceFreq; /*!< \brief Time iterations between checks of the measured load imbalance. */
+  su2double ParMETIS_rebalanceThreshold; /*!< \brief Measured load imbalance (max/avg) that triggers a repartitioning. */
+  POINT_ORDERING Kind_PointOrdering; /*!< \brief Reordering of the points of each partition. */
+  bool Geometry_Cache;              /*!< \brief Cache the partitioning, ordering and agglomeration of the geometry. */
+  string Geometry_Cache_FileName;   /*!< \brief Prefix of the geometry cache files. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1147,6 +1172,8 @@ private:
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
+  bool Persistent_P2P_Comms;                 /*!< \brief Use persistent requests for the point-to-point (halo) comms. */
+  HALO_COMPRESSION Kind_Halo_Compression;    /*!< \brief Compression of the point-to-point (halo) comms. */
   VERIFICATION_SOLUTION Kind_Verification_Solution; /*!< \brief Verification solution for accuracy assessment. */
 
   bool Time_Domain;              /*!< \brief Determines if the multizone problem is solved in time-domain */
@@ -2371,6 +2398,18 @@ public:
    */
   inline bool GetAdvanced_FEAElementBased(void) const { return FEAAdvancedMode; }
 
+  /*!
+   * \brief Get whether the FEA solver applies the tangent operator element by element (matrix-free).
+   * \return <code>TRUE</code> if the Jacobian is not assembled, only its diagonal blocks for preconditioning.
+   */
+  inline bool GetFEA_MatrixFree(void) const { return FEA_MatrixFree; }
+
+  /*!
+   * \brief Get whether the FEA solver computes the element matrices for batches of elements (SIMD).
+   * \return <code>TRUE</code> if the vectorized element kernels are used for the material models that support them.
+   */
+  inline bool GetFEA_Vectorization(void) const { return FEA_Vectorization; }
+
   /*!
    * \brief Get the name of the file with the reference geometry of the structural problem.
    * \return Name of the file with the reference geometry of the structural problem.
@@ -2495,6 +2534,17 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Get whether the neighbor min/max for the flow limiters are gathered with the reconstruction gradients.
+   */
+  bool GetFused_Gradient_Limiter(void) const { return Fused_Gradient_Limiter; }
+
+  /*!
+   * \brief Get whether the halo exchange of the flow reconstruction gradients and limiters is overlapped with the
+   *        flux computation on the edges between owned points.
+   */
+  bool GetOverlap_Halo_Comms(void) const { return Overlap_Halo_Comms; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -4316,12 +4366,48 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the maximum number of levels (including the finest) of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre and post smoothing sweeps of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Get the strength of connection threshold used for the AMG aggregation.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
+  /*!
+   * \brief Get the relaxation factor of the block-Jacobi smoother of the AMG preconditioner.
+   */
+  su2double GetLinear_Solver_AMG_Relaxation(void) const { return Linear_Solver_AMG_Relaxation; }
+
+  /*!
+   * \brief Check if the linear solvers keep a sliced ELLPACK (SELL-C-sigma) copy of the matrix for SIMD products.
+   */
+  bool GetLinear_Solver_SELL(void) const { return Linear_Solver_SELL; }
+
+  /*!
+   * \brief Get the floating point format used to store the preconditioner factors (ILU, Jacobi, and linelet).
+   */
+  PREC_STORAGE GetLinear_Solver_Prec_Storage(void) const { return Linear_Solver_Prec_Storage; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the number of vectors recycled between linear solves by GCRO-DR.
+   * \return Size of the recycled subspace.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4364,6 +4450,17 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get the max. number of Newton-Krylov iterations that reuse the Jacobian and preconditioner.
+   */
+  unsigned short GetNewtonKrylovMaxJacobianAge(void) const { return NK_MaxJacobianAge; }
+
+  /*!
+   * \brief Get the factor by which the linear iterations may grow (or the residual drop decrease) before
+   *        the Jacobian of the Newton-Krylov method is updated.
+   */
+  su2double GetNewtonKrylovReuseTolerance(void) const { return NK_ReuseTolerance; }
+
   /*!
    * \brief Returns the Roe kappa (multipler of the dissipation term).
    */
@@ -5496,6 +5593,17 @@ public:
    */
   bool GetWrt_Restart_Overwrite(void) const { return Wrt_Restart_Overwrite; }
 
+  /*!
+   * \brief Get the number of ranks that gather the binary restart data of groups of ranks and write it.
+   * \return Number of aggregators, 0 if all ranks write their own data.
+   */
+  unsigned long GetRestart_Aggregators(void) const { return Restart_Aggregators; }
+
+  /*!
+   * \brief Flag for whether the binary restart data is written by a background thread while the solver continues.
+   */
+  bool GetRestart_Async(void) const { return Restart_Async; }
+
     /*!
    * \brief Flag for whether visualization files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -9490,6 +9598,18 @@ public:
    */
   unsigned short GetComm_Level(void) const { return Comm_Level; }
 
+  /*!
+   * \brief Check if the point-to-point (halo) comms use persistent requests.
+   * \return YES if the requests are set up once per type of exchange and then only started.
+   */
+  bool GetPersistent_P2P_Comms(void) const { return Persistent_P2P_Comms; }
+
+  /*!
+   * \brief Get the compression of the point-to-point (halo) comms.
+   * \return Which quantities are exchanged in reduced precision.
+   */
+  HALO_COMPRESSION GetKind_Halo_Compression(void) const { return Kind_Halo_Compression; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9768,6 +9888,11 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get whether the threaded ILU is level-scheduled (same factor as serial ILU) instead of partitioned.
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Levels; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
@@ -9793,6 +9918,51 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Get the ParMETIS load balancing weight added to points on viscous walls.
+   */
+  long GetParMETIS_WallWeight() const { return ParMETIS_wallWgt; }
+
+  /*!
+   * \brief Check if the wall weight is balanced as a second ParMETIS constraint.
+   */
+  bool GetParMETIS_MultiConstraint() const { return ParMETIS_multiConstraint; }
+
+  /*!
+   * \brief Check if the partitioning weights are calibrated with costs measured by the solver.
+   */
+  bool GetParMETIS_Calibration() const { return ParMETIS_calibration; }
+
+  /*!
+   * \brief Get the name of the file of measured partitioning costs.
+   */
+  const string& GetParMETIS_Calibration_FileName() const { return ParMETIS_calibrationFile; }
+
+  /*!
+   * \brief Get the number of time iterations between checks of the measured load imbalance (0 disables rebalancing).
+   */
+  unsigned long GetParMETIS_Rebalance_Freq() const { return ParMETIS_rebalanceFreq; }
+
+  /*!
+   * \brief Get the measured load imbalance (max/avg) above which the grid is repartitioned during the run.
+   */
+  su2double GetParMETIS_Rebalance_Threshold() const { return ParMETIS_rebalanceThreshold; }
+
+  /*!
+   * \brief Get the kind of reordering of the points of each partition (RCM or a space filling curve).
+   */
+  POINT_ORDERING GetKind_PointOrdering() const { return Kind_PointOrdering; }
+
+  /*!
+   * \brief Check if the geometry preprocessing results are cached (and replayed) across runs.
+   */
+  bool GetGeometry_Cache() const { return Geometry_Cache; }
+
+  /*!
+   * \brief Get the prefix of the geometry cache files.
+   */
+  const string& GetGeometry_Cache_FileName() const { return Geometry_Cache_FileName; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -188,32 +188,43 @@ class AccessorImpl {
   }
 
   /*!
-   * Vectors provide both [] and () with the same behavior.
+   * Vectors provide both [] and () with the same behavior, (,) is also
+   * available for generic code that treats them as 1xN or Nx1 matrices.
    */
-#define VECTOR_ACCESSORS(M, ROWMAJOR)                          \
-  UNIV_ACCESSORS                                               \
-  Index_t rows() const noexcept { return ROWMAJOR ? 1 : M; }   \
-  Index_t cols() const noexcept { return ROWMAJOR ? M : 1; }   \
-  size_t size() const noexcept { return M; }                   \
-                                                               \
-  Scalar_t& operator()(const Index_t i) noexcept {             \
-    assert(i >= 0 && i < M);                                   \
-    return m_data[i];                                          \
-  }                                                            \
-                                                               \
-  const Scalar_t& operator()(const Index_t i) const noexcept { \
-    assert(i >= 0 && i < M);                                   \
-    return m_data[i];                                          \
-  }                                                            \
-                                                               \
-  Scalar_t& operator[](const Index_t i) noexcept {             \
-    assert(i >= 0 && i < M);                                   \
-    return m_data[i];                                          \
-  }                                                            \
-                                                               \
-  const Scalar_t& operator[](const Index_t i) const noexcept { \
-    assert(i >= 0 && i < M);                                   \
-    return m_data[i];                                          \
+#define VECTOR_ACCESSORS(M, ROWMAJOR)                                           \
+  UNIV_ACCESSORS                                                                \
+  Index_t rows() const noexcept { return ROWMAJOR ? 1 : M; }                    \
+  Index_t cols() const noexcept { return ROWMAJOR ? M : 1; }                    \
+  size_t size() const noexcept { return M; }                                    \
+                                                                                \
+  Scalar_t& operator()(const Index_t i) noexcept {                              \
+    assert(i >= 0 && i < M);                                                    \
+    return m_data[i];                                                           \
+  }                                                                             \
+                                                                                \
+  const Scalar_t& operator()(const Index_t i) const noexcept {                  \
+    assert(i >= 0 && i < M);                                                    \
+    return m_data[i];                                                           \
+  }                                                                             \
+                                                                                \
+  Scalar_t& operator[](const Index_t i) noexcept {                              \
+    assert(i >= 0 && i < M);                                                    \
+    return m_data[i];                                                           \
+  }                                                                             \
+                                                                                \
+  const Scalar_t& operator[](const Index_t i) const noexcept {                  \
+    assert(i >= 0 && i < M);                                                    \
+    return m_data[i];                                                           \
+  }                                                                             \
+                                                                                \
+  Scalar_t& operator()(const Index_t i, const Index_t j) noexcept {             \
+    assert((ROWMAJOR ? i : j) == 0);                                            \
+    return (*this)(ROWMAJOR ? j : i);                                           \
+  }                                                                             \
+                                                                                \
+  const Scalar_t& operator()(const Index_t i, const Index_t j) const noexcept { \
+    assert((ROWMAJOR ? i : j) == 0);                                            \
+    return (*this)(ROWMAJOR ? j : i);                                           \
   }
 
   MATRIX_ACCESSORS(StaticRows, StaticCols)
@@ -715,6 +715,17 @@ class CFEMStandardElement : public CFEMStandardElementBase {
                                             functions   in the integration points. As such second derivatives can be
                                             computed   using one call to the BLAS routines. */
 
+  unsigned short nDOFs1D;        /*!< \brief Number of DOFs in one direction of a tensor product element. It is 0
+                                              when the sum factorization kernels are not used for this element. */
+  unsigned short nIntegration1D; /*!< \brief Number of integration points in one direction of a tensor product
+                                              element. */
+  vector<su2double> lagBasisIntegration1D;   /*!< \brief 1D Lagrangian basis functions in the 1D integration points,
+                                                         stored as nIntegration1D x nDOFs1D. */
+  vector<su2double> drLagBasisIntegration1D; /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D
+                                                         integration points, stored as nIntegration1D x nDOFs1D. */
+  vector<su2double> lagBasisIntegration1DTrans;   /*!< \brief Transpose of lagBasisIntegration1D. */
+  vector<su2double> drLagBasisIntegration1DTrans; /*!< \brief Transpose of drLagBasisIntegration1D. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs
                                        is such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs
@@ -861,6 +872,41 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   */
   inline const su2double* GetMat2ndDerBasisFunctionsInt(void) const { return mat2ndDerBasisInt.data(); }
 
+  /*!
+   * \brief Function, which indicates whether or not the sum factorization kernels can be used for this element.
+   * \return True for quadrilaterals and hexahedra with a polynomial degree of at least 2, false otherwise.
+   */
+  inline bool GetSumFactorization(void) const { return nDOFs1D > 0; }
+
+  /*!
+  * \brief Function, which interpolates data from the DOFs to the integration points, or computes its
+           derivative w.r.t. one of the parametric coordinates, via sum factorization. It is equivalent
+           to a multiplication with the corresponding block of matBasisIntegration.
+  * \param[in]  NPad     - Padded number of entities, which are contiguous in memory per point.
+  * \param[in]  derDir   - 0 for the interpolation, 1, 2 or 3 for the r-, s- or t-derivative.
+  * \param[in]  dataDOFs - Data in the DOFs, nDOFs x NPad.
+  * \param[out] dataInt  - Data in the integration points, nIntegration x NPad.
+  * \param[out] work     - Work array of at least 2*nIntegration*NPad entries.
+  */
+  void SumFactDOFsToIntegration(const unsigned short NPad, const unsigned short derDir, const su2double* dataDOFs,
+                                su2double* dataInt, su2double* work) const;
+
+  /*!
+  * \brief Function, which multiplies data in the integration points with the transpose of the basis functions
+           or the transpose of one of its parametric derivatives via sum factorization. It is equivalent to a
+           multiplication with the transpose of the corresponding block of matBasisIntegration.
+  * \param[in]  NPad      - Padded number of entities, which are contiguous in memory per point.
+  * \param[in]  derDir    - 0 for the basis functions, 1, 2 or 3 for the r-, s- or t-derivative.
+  * \param[in]  ldInt     - Leading dimension (stride) of dataInt between two integration points.
+  * \param[in]  dataInt   - Data in the integration points.
+  * \param[out] dataDOFs  - Result in the DOFs, nDOFs x NPad.
+  * \param[out] work      - Work array of at least 2*nIntegration*NPad entries.
+  * \param[in]  addToDOFs - Whether the result must be added to or stored in dataDOFs.
+  */
+  void SumFactIntegrationToDOFs(const unsigned short NPad, const unsigned short derDir, const unsigned short ldInt,
+                                const su2double* dataInt, su2double* dataDOFs, su2double* work,
+                                const bool addToDOFs) const;
+
   /*!
    * \brief Function, which makes available the connectivity of face 0.
    * \return  The pointer to data, which stores the connectivity of face 0.
@@ -1022,6 +1068,32 @@ class CFEMStandardElement : public CFEMStandardElementBase {
    */
   void Copy(const CFEMStandardElement& other);
 
+  /*!
+   * \brief Function, which creates the 1D data for the sum factorization kernels, if possible.
+   */
+  void CreateSumFactorizationData(void);
+
+  /*!
+  * \brief Function, which carries out the contraction of a tensor in one parametric direction
+           with a 1D matrix. The index of the input data is ((outer*nIn + b)*nInner + inner),
+           of the output data ((outer*nOut + a)*nInner + inner). For contiguous input data
+           this is a strided batch of nOuter matrix products with the same 1D matrix.
+  * \param[in]  NPad     - Number of entities per point, which are contiguous in memory.
+  * \param[in]  nOuter   - Number of points in the directions stored slower than the contracted one.
+  * \param[in]  nIn      - Number of points in the contracted direction of the input.
+  * \param[in]  nOut     - Number of points in the contracted direction of the output.
+  * \param[in]  nInner   - Number of points in the directions stored faster than the contracted one.
+  * \param[in]  mat      - 1D matrix, nOut x nIn (row major).
+  * \param[in]  ldIn     - Stride of the input data between two points.
+  * \param[in]  dataIn   - Input data.
+  * \param[out] dataOut  - Output data, stored with a stride of NPad.
+  * \param[in]  addToOut - Whether the result must be added to or stored in dataOut.
+  */
+  static void TensorContraction1D(const unsigned short NPad, const unsigned short nOuter, const unsigned short nIn,
+                                  const unsigned short nOut, const unsigned short nInner, const su2double* mat,
+                                  const unsigned short ldIn, const su2double* dataIn, su2double* dataOut,
+                                  const bool addToOut);
+
   /*!
   * \brief Function, which creates the basis functions and the matrix containing
            the derivatives of the basis functions in the given location of the
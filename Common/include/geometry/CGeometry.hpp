@@ -66,6 +66,8 @@ extern "C" {
 
 using namespace std;
 
+class CGeometryCache;
+
 /*!
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry,
@@ -284,9 +286,25 @@ class CGeometry {
   su2double* bufD_P2PSend{nullptr};  /*!< \brief Data structure for su2double point-to-point send. */
   unsigned short* bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short* bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
+  float* bufF_P2PRecv{nullptr};           /*!< \brief Data structure for compressed (float) point-to-point receive. */
+  float* bufF_P2PSend{nullptr};           /*!< \brief Data structure for compressed (float) point-to-point send. */
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*!
+   * \brief Persistent requests of the point-to-point comms for one data type, packet size, and direction.
+   */
+  struct CPersistentP2P {
+    unsigned short commType, countPerPoint;
+    bool reverse;
+    vector<SU2_MPI::Request> send, recv;
+  };
+  mutable vector<CPersistentP2P> persistentP2P; /*!< \brief Persistent requests set up so far (PERSISTENT_P2P_COMMS). */
+
+  passivedouble timeP2P{0.0};     /*!< \brief Time spent packing, exchanging, and unpacking solver halo data. */
+  unsigned long bytesP2PFull{0};  /*!< \brief Bytes the solver halo exchanges would send in full precision. */
+  unsigned long bytesP2PSent{0};  /*!< \brief Bytes actually sent by the solver halo exchanges (HALO_COMPRESSION). */
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0}; /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -384,6 +402,21 @@ class CGeometry {
   void PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType, unsigned short countPerPoint,
                     int val_iMessage, bool val_reverse) const;
 
+  /*!
+   * \brief Get the persistent requests for a combination of data type, packet size, and direction, they are set up on
+   *        first use and bound to the current point-to-point buffers (with the layout of PostP2PRecvs/Sends).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return The send and recv requests, in the order of the messages.
+   */
+  const CPersistentP2P& GetPersistentP2P(unsigned short commType, unsigned short countPerPoint, bool reverse) const;
+
+  /*!
+   * \brief Free the persistent point-to-point requests, e.g. before the buffers they are bound to are reallocated.
+   */
+  void FreePersistentP2P() const;
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -698,10 +731,11 @@ class CGeometry {
   inline virtual void SetPoint_Connectivity() {}
 
   /*!
-   * \brief Orders the RCM.
+   * \brief Renumber the points for memory locality (RCM or space filling curve, see POINT_ORDERING).
    * \param[in] config - Definition of the particular problem.
+   * \param[in,out] cache - Optional cache from which the ordering is replayed, or where it is recorded.
    */
-  inline virtual void SetRCM_Ordering(CConfig* config) {}
+  inline virtual void SetPoint_Ordering(CConfig* config, CGeometryCache* cache = nullptr) {}
 
   /*!
    * \brief Connects elements  .
@@ -862,8 +896,21 @@ class CGeometry {
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
+   * \param[in,out] cache - Optional cache from which the partitioning is replayed, or where it is recorded.
+   */
+  inline virtual void SetColorGrid_Parallel(const CConfig* config, CGeometryCache* cache = nullptr) {}
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] volumeTime - Time measured on this rank for the point and edge work.
+   * \param[in] wallTime - Time measured on this rank for the wall work.
+   * \return New rank of each domain point.
    */
-  inline virtual void SetColorGrid_Parallel(const CConfig* config) {}
+  inline virtual vector<unsigned long> ComputeRebalancedPartition(const CConfig* config, passivedouble volumeTime,
+                                                                  passivedouble wallTime) const {
+    return {};
+  }
 
   /*!
    * \brief A virtual member.
@@ -0,0 +1,172 @@
+/*!
+ * \file CGeometryCache.hpp
+ * \brief Header of the class that caches the expensive results of the geometry preprocessing.
+ *        The implementations are in the <i>CGeometryCache.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../CConfig.hpp"
+
+/*!
+ * \class CGeometryCache
+ * \brief Per-rank cache of the geometry preprocessing decisions that are expensive to compute: the graph
+ *        partitioning (ParMETIS colors), the Reverse Cuthill-McKee ordering, and the multigrid agglomeration.
+ * \note The cache is keyed by a hash of the mesh file contents, the number of ranks, the zone/instance, and the
+ *       options that affect those results (partitioning weights, boundary conditions). When a matching cache is found
+ *       on every rank, the results are replayed and the searches are skipped, the data structures (halos, dual grid,
+ *       coarse grids) and the edge coloring are not cached, they are rebuilt from them as usual. Otherwise the
+ *       results are recorded and written at the end of the preprocessing. A partitioning can also be imposed
+ *       (dynamic load balancing), in which case only the ordering and the agglomeration are recomputed.
+ */
+class CGeometryCache {
+ public:
+  /*!
+   * \brief Agglomeration of one multigrid level (coarse domain points only, the halos are communicated).
+   */
+  struct Agglomeration {
+    unsigned long nPointFine = 0;      /*!< \brief Number of points of the fine grid, used as a consistency check. */
+    vector<unsigned long> childrenPtr; /*!< \brief Start of the children of each coarse point (CSR format). */
+    vector<unsigned long> children;    /*!< \brief Fine grid points agglomerated into each coarse point. */
+    vector<char> indirect;             /*!< \brief Indirect agglomeration flag of each coarse point. */
+  };
+
+ private:
+  const int rank; /*!< \brief MPI rank. */
+  const int size; /*!< \brief MPI size. */
+
+  uint64_t key = 0;      /*!< \brief Hash of the mesh and of the relevant options. */
+  string fileName;       /*!< \brief Cache file of this rank. */
+  bool persistent;       /*!< \brief The cache is backed by a file (GEOMETRY_CACHE= YES). */
+  bool loaded = false;   /*!< \brief The cache was read (on all ranks) and its results are replayed. */
+  bool imposed = false;  /*!< \brief The partitioning was imposed, the rest is recomputed. */
+  bool modified = false; /*!< \brief Results were recorded and the file needs to be (re)written. */
+
+  vector<unsigned long> partition;     /*!< \brief Colors of the points in the initial linear partition. */
+  vector<unsigned long> ordering;      /*!< \brief Ordering of the points of the partitioned grid. */
+  vector<Agglomeration> agglomeration; /*!< \brief Agglomeration of the multigrid levels (index 0 is MESH_1). */
+
+  /*!
+   * \brief Hash the contents of the mesh file, each rank hashes a slice.
+   * \param[in] meshFileName - Name of the mesh file.
+   */
+  void HashMeshFile(const string& meshFileName);
+
+  /*!
+   * \brief Mix a value into the key.
+   */
+  void Mix(uint64_t value);
+
+  /*!
+   * \brief Read the cache file of this rank.
+   * \return True if the file exists and matches the key.
+   */
+  bool Read();
+
+ public:
+  /*!
+   * \brief Compute the key and try to load the cache (collective call).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] usesFile - Whether the cache is read from and written to a file, otherwise it only holds an imposed
+   *            partitioning for the current preprocessing.
+   */
+  explicit CGeometryCache(const CConfig* config, bool usesFile = true);
+
+  /*!
+   * \brief Whether the results are replayed from the cache.
+   */
+  inline bool IsLoaded() const { return loaded; }
+
+  /*!
+   * \brief Whether a partitioning is available, either replayed or imposed.
+   */
+  inline bool HasPartition() const { return loaded || imposed; }
+
+  /*!
+   * \brief Whether the partitioning was imposed instead of loaded.
+   */
+  inline bool IsImposed() const { return imposed; }
+
+  /*!
+   * \brief Impose the partitioning, the cached ordering and agglomeration are discarded and recorded again.
+   * \param[in] colors - Colors of the points of the initial linear partition.
+   */
+  void ImposePartition(vector<unsigned long> colors);
+
+  /*!
+   * \brief Write the cache file of this rank if new results were recorded.
+   */
+  void Write() const;
+
+  /*!
+   * \brief Get the cached partitioning (colors of the points of the initial linear partition).
+   */
+  inline const vector<unsigned long>& GetPartition() const { return partition; }
+
+  /*!
+   * \brief Record the partitioning.
+   */
+  inline void SetPartition(vector<unsigned long> colors) {
+    partition = std::move(colors);
+    modified = true;
+  }
+
+  /*!
+   * \brief Get the cached point ordering (old index of each new point).
+   */
+  inline const vector<unsigned long>& GetOrdering() const { return ordering; }
+
+  /*!
+   * \brief Record the point ordering.
+   */
+  inline void SetOrdering(vector<unsigned long> newToOld) {
+    ordering = std::move(newToOld);
+    modified = true;
+  }
+
+  /*!
+   * \brief Get the cached agglomeration of a multigrid level.
+   * \param[in] iMesh - Multigrid level (1 or greater).
+   * \return Pointer to the agglomeration, nullptr if it is not cached.
+   */
+  inline const Agglomeration* GetAgglomeration(unsigned short iMesh) const {
+    return (loaded && iMesh <= agglomeration.size()) ? &agglomeration[iMesh - 1] : nullptr;
+  }
+
+  /*!
+   * \brief Record the agglomeration of a multigrid level, the coarser levels must be recorded in order.
+   * \param[in] iMesh - Multigrid level (1 or greater).
+   * \param[in] data - Agglomeration of the level.
+   */
+  inline void SetAgglomeration(unsigned short iMesh, Agglomeration data) {
+    if (iMesh != agglomeration.size() + 1) return;
+    agglomeration.push_back(std::move(data));
+    modified = true;
+  }
+};
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CGeometry.hpp"
+#include "CGeometryCache.hpp"
 
 /*!
  * \class CMultiGridGeometry
@@ -37,6 +38,27 @@
  */
 class CMultiGridGeometry final : public CGeometry {
  private:
+  /*!
+   * \brief Agglomerate the domain points of the fine grid into the coarse points of this grid.
+   * \param[in,out] fine_grid - Geometrical definition of the problem (its parent indices are set).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AgglomerateDomain(CGeometry* fine_grid, const CConfig* config);
+
+  /*!
+   * \brief Set the agglomeration of the domain points from a cached one, instead of AgglomerateDomain.
+   * \param[in] data - Cached agglomeration.
+   * \param[in,out] fine_grid - Geometrical definition of the problem (its parent indices are set).
+   */
+  void ReplayAgglomeration(const CGeometryCache::Agglomeration& data, CGeometry* fine_grid);
+
+  /*!
+   * \brief Extract the agglomeration of the domain points for the cache.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \return Agglomeration of this level.
+   */
+  CGeometryCache::Agglomeration RecordAgglomeration(const CGeometry* fine_grid) const;
+
   /*!
    * \brief Determine if a CVPoint van be agglomerated, if it have the same marker point as the seed.
    * \param[in] CVPoint - Control volume to be agglomerated.
@@ -78,8 +100,9 @@ class CMultiGridGeometry final : public CGeometry {
    * \param[in] fine_grid - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] iMesh - Level of the multigrid.
+   * \param[in,out] cache - Optional cache from which the agglomeration is replayed, or where it is recorded.
    */
-  CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, unsigned short iMesh);
+  CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, unsigned short iMesh, CGeometryCache* cache = nullptr);
 
   /*!
    * \brief Set boundary vertex.
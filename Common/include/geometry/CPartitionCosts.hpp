@@ -0,0 +1,106 @@
+/*!
+ * \file CPartitionCosts.hpp
+ * \brief Header of the cost model used to weight the graph partitioning.
+ *        The implementations are in the <i>CPartitionCosts.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "../CConfig.hpp"
+
+/*!
+ * \class CPartitionCosts
+ * \brief Per point cost model used to weight the graph partitioning (ParMETIS vertex weights).
+ * \note The cost of a point is point + neighbor * (number of neighbors) + wall * (point is on a viscous wall).
+ *       The coefficients are the PARMETIS_*_WEIGHT options, unless PARMETIS_CALIBRATION is set and a previous
+ *       run wrote the costs it measured (time per point, per neighbor, and per wall vertex). The measured costs are
+ *       scaled such that one neighbor weighs 1. The weights are real, see IntegerScale for the conversion to
+ *       the integer weights of ParMETIS.
+ */
+class CPartitionCosts {
+ public:
+  /*! \brief Categories of the measured costs. */
+  enum COST_TYPE : int {
+    POINT_COST,    /*!< \brief Point loops (source terms, dual time). */
+    NEIGHBOR_COST, /*!< \brief Edge loops (convective and viscous fluxes), two neighbors per edge. */
+    WALL_COST,     /*!< \brief Strong (wall) boundary conditions. */
+    N_COST_TYPES
+  };
+
+  /*! \brief Integer weight of a neighbor (or of the largest weight without neighbor weight) for ParMETIS. */
+  enum : long { WEIGHT_BASE = 1000 };
+
+  passivedouble point = 0.0;    /*!< \brief Weight of a point. */
+  passivedouble neighbor = 1.0; /*!< \brief Weight of each neighbor of a point. */
+  passivedouble wall = 0.0;     /*!< \brief Additional weight of points on viscous walls. */
+  bool calibrated = false;      /*!< \brief The weights come from measured costs. */
+
+  /*!
+   * \brief Set the weights from the config or from the calibration file (collective in that case).
+   * \param[in] config - Definition of the particular problem.
+   */
+  explicit CPartitionCosts(const CConfig* config);
+
+  /*!
+   * \brief Weight of the point and edge work of a point.
+   * \param[in] nNeighbor - Number of neighbors of the point.
+   */
+  inline passivedouble VolumeWeight(unsigned long nNeighbor) const { return point + neighbor * nNeighbor; }
+
+  /*!
+   * \brief Weight of the wall work of a point.
+   * \param[in] onWall - Whether the point is on a viscous wall.
+   */
+  inline passivedouble WallWeight(bool onWall) const { return onWall ? wall : 0.0; }
+
+  /*!
+   * \brief Factor applied to the weights before they are rounded to integers.
+   * \note A neighbor weighs WEIGHT_BASE, such that the small terms (e.g. measured point and wall costs) are not
+   *       rounded to 0, unless the total weight of the graph would then exceed the largest integer of ParMETIS.
+   * \param[in] totalWeight - Sum of the weights of all the points of the graph.
+   * \param[in] maxTotal - Largest total integer weight.
+   */
+  passivedouble IntegerScale(passivedouble totalWeight, passivedouble maxTotal) const;
+
+  /*!
+   * \brief Reduce the times and counts measured by the ranks and write the resulting costs to the calibration file.
+   * \note Collective, each rank passes its own times and counts.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] time - Time spent on each type of work.
+   * \param[in] count - Number of items (points, neighbors, wall vertices) of each type.
+   */
+  static void WriteCalibration(const CConfig* config, const std::array<passivedouble, N_COST_TYPES>& time,
+                               const std::array<unsigned long, N_COST_TYPES>& count);
+
+ private:
+  /*!
+   * \brief Name of the calibration file of the zone.
+   */
+  static string FileName(const CConfig* config);
+};
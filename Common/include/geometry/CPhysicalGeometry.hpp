@@ -360,10 +360,25 @@ class CPhysicalGeometry final : public CGeometry {
   void SetPoint_Connectivity() override;
 
   /*!
-   * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
+   * \brief Compute the Reverse Cuthill-McKee ordering of the points (halo points are kept at the end).
+   * \return Old index of each point in the new ordering.
+   */
+  vector<unsigned long> ComputeRCM_Ordering() const;
+
+  /*!
+   * \brief Compute the ordering of the points along a space filling curve through their coordinates (halo points
+   *        are kept at the end). The edges follow since they are numbered in the order of their first point.
+   * \param[in] kind - Type of curve, HILBERT or MORTON.
+   * \return Old index of each point in the new ordering.
+   */
+  vector<unsigned long> ComputeSFC_Ordering(POINT_ORDERING kind) const;
+
+  /*!
+   * \brief Set a renumbering of the points, Reverse Cuthill-McKee or space filling curve (POINT_ORDERING).
    * \param[in] config - Definition of the particular problem.
+   * \param[in,out] cache - Optional cache from which the ordering is replayed, or where it is recorded.
    */
-  void SetRCM_Ordering(CConfig* config) override;
+  void SetPoint_Ordering(CConfig* config, CGeometryCache* cache = nullptr) override;
 
   /*!
    * \brief Set elements which surround an element.
@@ -490,8 +505,21 @@ class CPhysicalGeometry final : public CGeometry {
   /*!
    * \brief Set the domains for grid grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
+   * \param[in,out] cache - Optional cache from which the partitioning is replayed, or where it is recorded.
+   */
+  void SetColorGrid_Parallel(const CConfig* config, CGeometryCache* cache = nullptr) override;
+
+  /*!
+   * \brief Repartition the partitioned grid with ParMETIS adaptive repartitioning, to rebalance the load during a run.
+   * \note The weights of the initial partitioning are scaled, on each rank, by the ratio of the measured times to the
+   *       modelled costs. The current partition is the starting point, so that few points change rank.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] volumeTime - Time measured on this rank for the point and edge work.
+   * \param[in] wallTime - Time measured on this rank for the wall work.
+   * \return New rank of each domain point.
    */
-  void SetColorGrid_Parallel(const CConfig* config) override;
+  vector<unsigned long> ComputeRebalancedPartition(const CConfig* config, passivedouble volumeTime,
+                                                   passivedouble wallTime) const override;
 
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
@@ -492,6 +492,11 @@ class CPoint {
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the distance to the nearest wall of all points.
+   */
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -506,6 +511,11 @@ class CPoint {
    */
   inline su2double GetRoughnessHeight(unsigned long iPoint) const { return RoughnessHeight(iPoint); }
 
+  /*!
+   * \brief Get the roughness of the nearest wall of all points.
+   */
+  inline const su2activevector& GetRoughnessHeight() const { return RoughnessHeight; }
+
   /*!
    * \brief Set the value of the distance to a sharp edge.
    * \param[in] iPoint - Index of the point.
@@ -557,6 +567,11 @@ class CPoint {
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
 
+  /*!
+   * \brief Get the area or volume of all control volumes.
+   */
+  inline const su2activevector& GetVolume() const { return Volume; }
+
   /*!
    * \brief Set the volume of the control volume.
    * \param[in] iPoint - Index of the point.
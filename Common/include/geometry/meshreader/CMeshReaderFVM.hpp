@@ -30,6 +30,7 @@
 #pragma once
 
 #include <string.h>
+#include <functional>
 
 #include "../../parallelization/mpi_structure.hpp"
 #include "../../CConfig.hpp"
@@ -90,6 +91,22 @@ class CMeshReaderFVM {
    */
   inline const vector<vector<passivedouble> >& GetLocalPointCoordinates() const { return localPointCoordinates; }
 
+  /*!
+   * \brief Pass each local point to a function, in order, and release the coordinates held by the reader.
+   * \note Readers that parse the points on demand (e.g. from a memory mapped file) override this to avoid holding
+   *       all the coordinates at once, the default goes through the stored coordinates.
+   * \param[in] task - Called with the local index of the point and a pointer to its coordinates.
+   */
+  virtual void StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task);
+
+  /*!
+   * \brief Pass each local volume element to a function, in order, and release the connectivity held by the reader.
+   * \note Same idea as StreamLocalPoints.
+   * \param[in] task - Called with the local index of the element and a pointer to its SU2_CONN_SIZE entries
+   *                   [globalID vtkType n0 ... n7].
+   */
+  virtual void StreamLocalVolumeElements(const std::function<void(unsigned long, const unsigned long*)>& task);
+
   /*!
    * \brief Get the surface element connectivity for the specified marker. Only the master node owns the surface
    * connectivity. \param[in] val_iMarker - current marker index. \returns Surface element connecitivity for a marker
@@ -29,8 +29,10 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include "CMeshReaderFVM.hpp"
+#include "../../toolboxes/CMemoryMappedFile.hpp"
 
 /*!
  * \class CSU2ASCIIMeshReaderFVM
@@ -50,6 +52,11 @@ class CSU2ASCIIMeshReaderFVM : public CMeshReaderFVM {
 
   bool actuator_disk; /*!< \brief Boolean for whether we have an actuator disk to split. */
 
+  std::unique_ptr<CMemoryMappedFile> mappedFile; /*!< \brief Mapping of the file, used to parse the points and the
+                                                    elements on demand in single-rank runs (lazy reading). */
+  unsigned long pointsOffset = 0;   /*!< \brief Position in the file of the first point (lazy reading). */
+  unsigned long elementsOffset = 0; /*!< \brief Position in the file of the first element (lazy reading). */
+
   unsigned long ActDiskNewPoints =
       0; /*!< \brief Total number of new grid points to add due to actuator disk splitting. */
 
@@ -108,9 +115,35 @@ class CSU2ASCIIMeshReaderFVM : public CMeshReaderFVM {
    */
   void FastForwardToMyZone();
 
+  /*!
+   * \brief Find the start of the next line in the memory mapped file.
+   * \param[in] position - Any position in the current line.
+   * \returns Start of the next line.
+   */
+  const char* NextLine(const char* position) const;
+
+  /*!
+   * \brief Skip the lines of a section using the memory mapped file, instead of parsing them.
+   * \param[in] nLines - Number of lines in the section.
+   * \returns Position in the file of the first line of the section.
+   */
+  unsigned long SkipSection(unsigned long nLines);
+
  public:
   /*!
    * \brief Constructor of the CSU2ASCIIMeshReaderFVM class.
    */
   CSU2ASCIIMeshReaderFVM(CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Pass each local point to a function, parsing it from the memory mapped file if possible.
+   * \param[in] task - Called with the local index of the point and a pointer to its coordinates.
+   */
+  void StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task) override;
+
+  /*!
+   * \brief Pass each local volume element to a function, parsing it from the memory mapped file if possible.
+   * \param[in] task - Called with the local index of the element and a pointer to its connectivity.
+   */
+  void StreamLocalVolumeElements(const std::function<void(unsigned long, const unsigned long*)>& task) override;
 };
@@ -0,0 +1,145 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "CMeshReaderFVM.hpp"
+#include "../../toolboxes/CMemoryMappedFile.hpp"
+
+/*!
+ * \namespace SU2BinaryMesh
+ * \brief Layout of the native SU2 binary mesh format (one zone per file, native byte order).
+ * \note The file starts with a header of HEADER_SIZE int64, followed by the point coordinates (nDim doubles per
+ *       point), the volume elements (ELEM_RECORD_SIZE int64 per element, VTK type followed by the nodes, padded with
+ *       zeros), and the markers (MARKER_NAME_SIZE chars for the name, one int64 for the number of elements, and
+ *       BOUND_RECORD_SIZE int64 per surface element). All blocks have fixed-width records so that any slice can be
+ *       located from the header alone.
+ */
+namespace SU2BinaryMesh {
+constexpr int64_t MAGIC_NUMBER = 0x53553242; /*!< \brief "SU2B", also used to detect a byte order mismatch. */
+constexpr int64_t VERSION = 1;               /*!< \brief Version of the layout. */
+
+/*! \brief Entries of the header. */
+enum HEADER_ENTRY : int {
+  MAGIC,          /*!< \brief Magic number. */
+  FORMAT_VERSION, /*!< \brief Version of the layout. */
+  NDIM,           /*!< \brief Physical dimension. */
+  NPOINT,         /*!< \brief Number of points. */
+  NELEM,          /*!< \brief Number of volume elements. */
+  NMARKER,        /*!< \brief Number of markers. */
+  ELEM_OFFSET,    /*!< \brief Offset (bytes) of the volume elements. */
+  MARKER_OFFSET,  /*!< \brief Offset (bytes) of the markers. */
+  HEADER_SIZE
+};
+
+constexpr int ELEM_RECORD_SIZE = 1 + N_POINTS_MAXIMUM;       /*!< \brief Entries per volume element. */
+constexpr int BOUND_RECORD_SIZE = 1 + N_POINTS_QUADRILATERAL; /*!< \brief Entries per surface element. */
+constexpr int MARKER_NAME_SIZE = 64;                         /*!< \brief Fixed length of the marker names. */
+
+/*! \brief File extension. */
+constexpr char FILE_EXT[] = ".su2b";
+}  // namespace SU2BinaryMesh
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note Each rank reads its slice of the points and of the elements directly from the file, the elements are then
+ *       sent to the ranks that own their points (the same distribution as the ASCII reader). The master reads the
+ *       markers. In single-rank runs the points and elements are instead read on demand from a memory mapping.
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief File object for the mesh file. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief File object for the mesh file. */
+#endif
+
+  int64_t header[SU2BinaryMesh::HEADER_SIZE] = {}; /*!< \brief Header of the file. */
+
+  std::unique_ptr<CMemoryMappedFile> mappedFile; /*!< \brief Mapping of the file, used to read the points and the
+                                                    elements on demand in single-rank runs (lazy reading). */
+
+  /*!
+   * \brief Independent (non collective) read of a block of the file.
+   * \param[in] offset - Position of the block in bytes.
+   * \param[in] nBytes - Size of the block.
+   * \param[out] buffer - Where to read the block to.
+   */
+  void ReadAt(unsigned long offset, unsigned long nBytes, void* buffer);
+
+  /*!
+   * \brief Reads and checks the header of the file.
+   */
+  void ReadHeader();
+
+  /*!
+   * \brief Reads the linear partition of points of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the elements and sends them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements on the master rank.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Pass each local point to a function, reading it from the memory mapped file if possible.
+   * \param[in] task - Called with the local index of the point and a pointer to its coordinates.
+   */
+  void StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task) override;
+
+  /*!
+   * \brief Pass each local volume element to a function, reading it from the memory mapped file if possible.
+   * \param[in] task - Called with the local index of the element and a pointer to its connectivity.
+   */
+  void StreamLocalVolumeElements(const std::function<void(unsigned long, const unsigned long*)>& task) override;
+
+  /*!
+   * \brief Reads the dimension of the problem from the header of a binary mesh file.
+   * \param[in] val_filename - Name of the mesh file.
+   * \return Dimension of the problem.
+   */
+  static unsigned short GetnDim(const string& val_filename);
+};
@@ -0,0 +1,217 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Aggregation-based algebraic multigrid for block-sparse (BCSR) matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+class CConfig;
+class CGeometry;
+template <class T>
+class CSysVector;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Aggregation-based AMG V-cycle used as a preconditioner for CSysMatrix.
+ *
+ * The hierarchy is built directly from the BCSR layout of the matrix (row_ptr, col_ind, dia_ptr, values).
+ * Points are grouped into aggregates using a strength of connection based on the Frobenius norm of the
+ * blocks, the prolongation is piecewise constant (block identity), and the coarse operators are Galerkin
+ * products (R A P with R = P^T). Smoothing is done with damped block-Jacobi sweeps.
+ *
+ * Aggregates do not cross MPI ranks. On the finest level the smoother and the residual use the full rows of
+ * the matrix (i.e. including halo columns) with the usual halo exchange of CSysMatrix, on the coarse levels
+ * the couplings to other ranks are dropped, as done by the ILU and LU_SGS preconditioners.
+ *
+ * The aggregation is computed the first time the preconditioner is built and is then reused, subsequent
+ * builds only recompute the numerical values of the coarse operators (the sparse pattern is fixed).
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  enum : unsigned long { MAXNVAR = 20 };          /*!< \brief Same as in CSysMatrix. */
+  enum : unsigned long { OMP_MAX_SIZE = 512 };    /*!< \brief Max. chunk size used in the parallel loops. */
+  enum : unsigned long { MAX_DIRECT_SIZE = 512 }; /*!< \brief Max. number of unknowns solved directly. */
+  enum : unsigned long { NO_INDEX = ~0ul };       /*!< \brief Flag for unassigned points and dropped non zeros. */
+
+  /*!
+   * \brief One level of the hierarchy, the finest level only points to the data of CSysMatrix.
+   */
+  struct CLevel {
+    unsigned long nRow = 0;           /*!< \brief Number of (block) rows, excludes halos. */
+    unsigned long omp_chunk_size = 1; /*!< \brief Chunk size for parallel loops over rows. */
+    const unsigned long* row_ptr = nullptr;
+    const unsigned long* col_ind = nullptr;
+    const unsigned long* dia_ptr = nullptr;
+    const ScalarType* values = nullptr;
+
+    /*--- Storage for the sparse pattern and values of coarse levels. ---*/
+    std::vector<unsigned long> row_ptr_, col_ind_, dia_ptr_;
+    std::vector<ScalarType> values_;
+
+    std::vector<ScalarType> invDiag; /*!< \brief Inverse of the diagonal blocks for the block smoother. */
+
+    /*--- Transfer to the next (coarser) level. ---*/
+    std::vector<unsigned long> agg_ptr;    /*!< \brief Start of each aggregate in agg_pts (CSR-like). */
+    std::vector<unsigned long> agg_pts;    /*!< \brief Points of each aggregate. */
+    std::vector<unsigned long> point2agg;  /*!< \brief Aggregate (coarse point) of each point. */
+    std::vector<unsigned long> nnz2coarse; /*!< \brief Coarse non zero where each non zero is accumulated. */
+
+    /*--- Working vectors (the finest level uses the vectors passed to the solve method). ---*/
+    mutable std::vector<ScalarType> rhs, sol, res;
+
+    /*!
+     * \brief Point the public pointers to the owned storage.
+     */
+    void SetPointers() {
+      row_ptr = row_ptr_.data();
+      col_ind = col_ind_.data();
+      dia_ptr = dia_ptr_.data();
+      values = values_.data();
+    }
+  };
+
+  unsigned long nVar = 0;   /*!< \brief Size of the (square) blocks. */
+  unsigned long nPoint = 0; /*!< \brief Number of points of the finest level including halos. */
+
+  unsigned short maxLevels = 0; /*!< \brief Maximum number of levels (including the finest). */
+  unsigned short nSweeps = 0;   /*!< \brief Number of pre and post smoothing sweeps. */
+  ScalarType strength = 0;      /*!< \brief Threshold for strong connections. */
+  ScalarType omega = 0;         /*!< \brief Relaxation of the block-Jacobi smoother. */
+
+  std::vector<CLevel> levels; /*!< \brief The hierarchy, levels[0] is the finest. */
+
+  std::vector<ScalarType> coarseLU;       /*!< \brief Dense LU factorization of the coarsest operator. */
+  std::vector<unsigned long> coarsePivot; /*!< \brief Row permutation of the dense LU factorization. */
+  bool directCoarse = false;              /*!< \brief If the coarsest level is solved directly. */
+
+  bool issetup = false; /*!< \brief Signals that the matrix data has been provided. */
+  bool isbuilt = false; /*!< \brief Signals that the aggregation (sparse patterns) have been computed. */
+
+  mutable std::vector<ScalarType> fineRes; /*!< \brief Residual on the finest level. */
+
+  /*!
+   * \brief Square of the Frobenius norm of a block.
+   */
+  inline ScalarType BlockNorm2(const ScalarType* block) const {
+    ScalarType sum = 0;
+    for (auto k = 0ul; k < nVar * nVar; ++k) sum += block[k] * block[k];
+    return sum;
+  }
+
+  /*!
+   * \brief Group the points of a level into aggregates.
+   * \param[in] iLevel - Index of the fine level.
+   */
+  void Aggregate(unsigned long iLevel);
+
+  /*!
+   * \brief Create the sparse pattern of the next level and the map from fine to coarse non zeros.
+   * \param[in] iLevel - Index of the fine level.
+   */
+  void SetCoarsePattern(unsigned long iLevel);
+
+  /*!
+   * \brief Compute the Galerkin product to obtain the values of the next (coarser) level.
+   * \param[in] iLevel - Index of the fine level.
+   */
+  void ComputeCoarseValues(unsigned long iLevel);
+
+  /*!
+   * \brief Invert the diagonal blocks of a level.
+   * \param[in] iLevel - Index of the level.
+   */
+  void InvertDiagonal(unsigned long iLevel);
+
+  /*!
+   * \brief Assemble the coarsest operator into a dense matrix and factorize it.
+   */
+  void FactorizeCoarsest();
+
+  /*!
+   * \brief Apply damped block-Jacobi sweeps to a level.
+   * \param[in] iLevel - Index of the level.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution, has nPoint blocks on the finest level.
+   * \param[out] r - Working vector for the residual.
+   * \param[in] sweeps - Number of sweeps.
+   * \param[in] xIsZero - Initial solution is zero, saves one product.
+   * \param[in] fineSol - The finest level solution, to perform halo exchanges, nullptr on coarse levels.
+   */
+  void Smooth(unsigned long iLevel, const ScalarType* b, ScalarType* x, ScalarType* r, unsigned short sweeps,
+              bool xIsZero, CSysVector<ScalarType>* fineSol, CGeometry* geometry, const CConfig* config) const;
+
+  /*!
+   * \brief Compute r = b - A x for the rows of a level.
+   */
+  void Residual(unsigned long iLevel, const ScalarType* b, const ScalarType* x, ScalarType* r) const;
+
+  /*!
+   * \brief Recursive V-cycle, x is initialized (to zero) by the cycle.
+   */
+  void Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x, CSysVector<ScalarType>* fineSol,
+             CGeometry* geometry, const CConfig* config) const;
+
+ public:
+  /*!
+   * \brief Set the (finest) matrix data, only once.
+   * \param[in] nVar - Size of the square blocks.
+   * \param[in] nPoint - Total number of points including halos.
+   * \param[in] nPointDomain - Number of internal points.
+   * \param[in] rowptr - Array, where column index data starts for each matrix row.
+   * \param[in] colidx - Non zeros column indices.
+   * \param[in] diaptr - Position of the diagonal block of each row.
+   * \param[in] values - Matrix coefficients.
+   */
+  void SetMatrix(unsigned long nVar, unsigned long nPoint, unsigned long nPointDomain, const unsigned long* rowptr,
+                 const unsigned long* colidx, const unsigned long* diaptr, const ScalarType* values);
+
+  /*!
+   * \brief Build the hierarchy (aggregation only on the first call) and the smoothers.
+   * \note Must be called by all threads of a parallel region (if in one).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(const CConfig* config);
+
+  /*!
+   * \brief Apply one V-cycle to rhs with zero initial guess, the halos of the result are not updated.
+   * \note Must be called by all threads of a parallel region (if in one).
+   * \param[in] rhs - Right hand side.
+   * \param[out] sol - Result of the cycle.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solve(const CSysVector<ScalarType>& rhs, CSysVector<ScalarType>& sol, CGeometry* geometry,
+             const CConfig* config) const;
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+};
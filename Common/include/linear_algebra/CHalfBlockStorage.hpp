@@ -0,0 +1,295 @@
+/*!
+ * \file CHalfBlockStorage.hpp
+ * \brief Storage of small dense blocks in 16-bit floating point formats (IEEE half or bfloat16).
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../basic_types/datatype_structure.hpp"
+#include "../option_structure.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+/*!
+ * \namespace HalfPrecision
+ * \brief Conversions between float and 16-bit formats, rounding to nearest even.
+ */
+namespace HalfPrecision {
+
+/*! \brief Round to bfloat16 (the 16 most significant bits of a float). */
+inline uint16_t FloatToBF16(float f) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(float));
+  if ((bits & 0x7fffffffu) > 0x7f800000u) return static_cast<uint16_t>((bits >> 16) | 0x40u);  // NaN stays NaN.
+  bits += 0x7fffu + ((bits >> 16) & 1u);
+  return static_cast<uint16_t>(bits >> 16);
+}
+
+/*! \brief Expand bfloat16 to float (exact). */
+inline float BF16ToFloat(uint16_t h) {
+  const uint32_t bits = static_cast<uint32_t>(h) << 16;
+  float f;
+  memcpy(&f, &bits, sizeof(float));
+  return f;
+}
+
+/*! \brief Round to IEEE 754 half precision (portable implementation). */
+inline uint16_t FloatToFP16Soft(float f) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(float));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+  const uint32_t absBits = bits & 0x7fffffffu;
+
+  if (absBits >= 0x7f800000u) return sign | ((absBits > 0x7f800000u) ? 0x7e00u : 0x7c00u);  // NaN, Inf.
+  if (absBits >= 0x477ff000u) return sign | 0x7c00u;                                         // Overflow.
+
+  if (absBits < 0x38800000u) {
+    /*--- Subnormal (or zero) result, shift the mantissa with the implicit bit and round. ---*/
+    if (absBits < 0x33000000u) return sign;
+    const uint32_t exponent = absBits >> 23;
+    const uint32_t mantissa = (absBits & 0x7fffffu) | 0x800000u;
+    const uint32_t shift = 126 - exponent;
+    uint32_t half = mantissa >> shift;
+    const uint32_t rest = mantissa & ((1u << shift) - 1u);
+    const uint32_t halfway = 1u << (shift - 1);
+    if ((rest > halfway) || ((rest == halfway) && (half & 1u))) ++half;
+    return sign | static_cast<uint16_t>(half);
+  }
+  /*--- Normal result, rebias the exponent and round the mantissa (a carry correctly bumps the exponent). ---*/
+  uint32_t half = ((absBits - 0x38000000u) >> 13);
+  const uint32_t rest = absBits & 0x1fffu;
+  if ((rest > 0x1000u) || ((rest == 0x1000u) && (half & 1u))) ++half;
+  return sign | static_cast<uint16_t>(half);
+}
+
+/*! \brief Expand IEEE 754 half precision to float (exact, portable implementation). */
+inline float FP16ToFloatSoft(uint16_t h) {
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+  const uint32_t exponent = (h >> 10) & 0x1fu;
+  uint32_t mantissa = h & 0x3ffu;
+  uint32_t bits;
+
+  if (exponent == 0x1fu) {
+    bits = sign | 0x7f800000u | (mantissa << 13);
+  } else if (exponent != 0) {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  } else if (mantissa == 0) {
+    bits = sign;
+  } else {
+    /*--- Subnormal, normalize. ---*/
+    uint32_t e = 113;
+    while (!(mantissa & 0x400u)) {
+      mantissa <<= 1;
+      --e;
+    }
+    bits = sign | (e << 23) | ((mantissa & 0x3ffu) << 13);
+  }
+  float f;
+  memcpy(&f, &bits, sizeof(float));
+  return f;
+}
+
+/*! \brief Round to IEEE 754 half precision. */
+inline uint16_t FloatToFP16(float f) {
+#ifdef __F16C__
+  return _cvtss_sh(f, 0);
+#else
+  return FloatToFP16Soft(f);
+#endif
+}
+
+/*! \brief Expand IEEE 754 half precision to float (exact). */
+inline float FP16ToFloat(uint16_t h) {
+#ifdef __F16C__
+  return _cvtsh_ss(h);
+#else
+  return FP16ToFloatSoft(h);
+#endif
+}
+
+/*! \brief Expand n bfloat16 values to float. */
+inline void BF16ToFloat(const uint16_t* h, float* f, unsigned long n) {
+  for (auto k = 0ul; k < n; ++k) f[k] = BF16ToFloat(h[k]);
+}
+
+/*! \brief Expand n IEEE 754 half precision values to float, 8 at a time with F16C, otherwise with a table. */
+inline void FP16ToFloat(const uint16_t* h, float* f, unsigned long n) {
+  auto k = 0ul;
+#ifdef __F16C__
+  for (; k + 8 <= n; k += 8) {
+    _mm256_storeu_ps(f + k, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(h + k))));
+  }
+  for (; k < n; ++k) f[k] = _cvtsh_ss(h[k]);
+#else
+  /*--- The 2^16 values (256 KiB) avoid the branches of the conversion. ---*/
+  static const std::vector<float> table = []() {
+    std::vector<float> t(1ul << 16);
+    for (auto i = 0ul; i < t.size(); ++i) t[i] = FP16ToFloatSoft(static_cast<uint16_t>(i));
+    return t;
+  }();
+  for (; k < n; ++k) f[k] = table[h[k]];
+#endif
+}
+}  // namespace HalfPrecision
+
+/*!
+ * \class CHalfBlockStorage
+ * \ingroup SpLinSys
+ * \brief Array of small dense row-major blocks stored with 16 bits per entry.
+ *
+ * Each block has a (float) scale factor. For FP16 the block is scaled to make its largest entry 2^14, to use the
+ * range of the format (about 9 orders of magnitude within a block) and avoid overflow. BF16 has the range of float
+ * and the scale is 1. The products with vectors accumulate in float.
+ */
+class CHalfBlockStorage {
+ private:
+  enum : unsigned long { MAXNCOLS = 20 };      /*!< \brief Max. block size, same as MAXNVAR of CSysMatrix. */
+  static constexpr float FP16_TARGET = 16384; /*!< \brief Scaled magnitude of the largest entry (FP16). */
+
+  unsigned long nRows = 0;      /*!< \brief Number of rows of the blocks. */
+  unsigned long nCols = 0;      /*!< \brief Number of columns of the blocks. */
+  bool isBF16 = false;          /*!< \brief Format of the entries, BF16 or FP16. */
+  std::vector<uint16_t> values; /*!< \brief Encoded entries. */
+  std::vector<float> scales;    /*!< \brief Scale of each block. */
+
+  inline uint16_t Encode(float x) const {
+    return isBF16 ? HalfPrecision::FloatToBF16(x) : HalfPrecision::FloatToFP16(x);
+  }
+
+  /*!
+   * \brief Decode the (scaled) entries of a block.
+   */
+  template <bool BF16>
+  inline void DecodeBlock(unsigned long iBlk, float* a) const {
+    const auto blkSize = nRows * nCols;
+    if (BF16)
+      HalfPrecision::BF16ToFloat(&values[iBlk * blkSize], a, blkSize);
+    else
+      HalfPrecision::FP16ToFloat(&values[iBlk * blkSize], a, blkSize);
+  }
+
+  /*!
+   * \brief Generic implementation of y (+/-)= A x, the block is decoded once and then multiplied in float (the
+   *        format is a template parameter to keep the branch out of the loops).
+   */
+  template <int Mode, bool BF16, class T>
+  inline void Product(unsigned long iBlk, const T* x, T* y) const {
+    float a[MAXNCOLS * MAXNCOLS], xf[MAXNCOLS];
+    DecodeBlock<BF16>(iBlk, a);
+    const float scale = scales[iBlk];
+    for (auto j = 0ul; j < nCols; ++j) xf[j] = float(SU2_TYPE::GetValue(x[j]));
+    for (auto i = 0ul; i < nRows; ++i) {
+      float acc = 0;
+      for (auto j = 0ul; j < nCols; ++j) acc += a[i * nCols + j] * xf[j];
+      acc *= scale;
+      if (Mode == 0) y[i] = acc;
+      if (Mode > 0) y[i] += acc;
+      if (Mode < 0) y[i] -= acc;
+    }
+  }
+
+  template <int Mode, class T>
+  inline void Product(unsigned long iBlk, const T* x, T* y) const {
+    if (isBF16)
+      Product<Mode, true>(iBlk, x, y);
+    else
+      Product<Mode, false>(iBlk, x, y);
+  }
+
+ public:
+  /*!
+   * \brief Allocate the storage.
+   * \param[in] nBlk - Number of blocks.
+   * \param[in] nrows - Number of rows of the blocks.
+   * \param[in] ncols - Number of columns of the blocks.
+   * \param[in] format - FP16 or BF16.
+   */
+  void Initialize(unsigned long nBlk, unsigned long nrows, unsigned long ncols, PREC_STORAGE format) {
+    nRows = nrows;
+    nCols = ncols;
+    isBF16 = (format == PREC_STORAGE::BF16);
+    values.assign(nBlk * nRows * nCols, 0);
+    scales.assign(nBlk, 1.0f);
+  }
+
+  /*!
+   * \brief Whether the storage is allocated.
+   */
+  inline bool empty() const { return scales.empty(); }
+
+  /*!
+   * \brief Encode a block.
+   */
+  template <class T>
+  void Set(unsigned long iBlk, const T* block) {
+    const auto blkSize = nRows * nCols;
+    float scale = 1;
+    if (!isBF16) {
+      float maxAbs = 0;
+      for (auto k = 0ul; k < blkSize; ++k) maxAbs = fmax(maxAbs, fabs(float(SU2_TYPE::GetValue(block[k]))));
+      if (maxAbs > 0) scale = maxAbs / FP16_TARGET;
+    }
+    scales[iBlk] = scale;
+    const float invScale = 1 / scale;
+    for (auto k = 0ul; k < blkSize; ++k) {
+      values[iBlk * blkSize + k] = Encode(float(SU2_TYPE::GetValue(block[k])) * invScale);
+    }
+  }
+
+  /*!
+   * \brief Decode a block.
+   */
+  template <class T>
+  void Get(unsigned long iBlk, T* block) const {
+    float a[MAXNCOLS * MAXNCOLS];
+    if (isBF16)
+      DecodeBlock<true>(iBlk, a);
+    else
+      DecodeBlock<false>(iBlk, a);
+    for (auto k = 0ul; k < nRows * nCols; ++k) block[k] = a[k] * scales[iBlk];
+  }
+
+  /*!
+   * \brief y = A x.
+   */
+  template <class T>
+  inline void MatVec(unsigned long iBlk, const T* x, T* y) const {
+    Product<0>(iBlk, x, y);
+  }
+
+  /*!
+   * \brief y -= A x.
+   */
+  template <class T>
+  inline void MatVecSub(unsigned long iBlk, const T* x, T* y) const {
+    Product<-1>(iBlk, x, y);
+  }
+};
@@ -0,0 +1,151 @@
+/*!
+ * \file CSlicedEllMatrix.hpp
+ * \brief Sliced ELLPACK (SELL-C-sigma) copy of a block-sparse (BCSR) matrix for SIMD products.
+ *        The implementation is in <i>CSlicedEllMatrix.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+/*!
+ * \class CSlicedEllMatrix
+ * \ingroup SpLinSys
+ * \brief Block SELL-C-sigma layout of the owned rows of a CSysMatrix, used for its SIMD products.
+ *
+ * The rows are grouped in chunks of C rows, C being the SIMD length of ScalarType. Within each chunk the blocks
+ * are stored column-major ("slot" by "slot"), and the C values of each block entry are contiguous, such that one
+ * vector instruction processes the same entry of the blocks of C different rows. Shorter rows are padded with
+ * zero blocks up to the length of the longest row in the chunk. To minimize the padding, the rows are sorted by
+ * length within windows of sigma rows (which keeps the accesses to the vectors local).
+ *
+ * The sparse pattern is computed once, the values are copied from the BCSR matrix by SetValues. The BCSR values
+ * can be modified in many ways (block setters, pointers to blocks, boundary conditions, etc.) so the copy is only
+ * considered valid during a linear solve, CSysSolve updates it at the start and invalidates it at the end.
+ */
+template <class ScalarType>
+class CSlicedEllMatrix {
+ private:
+  enum : unsigned long { MAXNVAR = 20 };        /*!< \brief Same as in CSysMatrix. */
+  enum : unsigned long { SIGMA_CHUNKS = 16 };   /*!< \brief Rows are sorted within windows of this many chunks. */
+  enum : unsigned long { OMP_MAX_SIZE = 64 };   /*!< \brief Max. chunk size (in SIMD chunks) of parallel loops. */
+  enum : unsigned long { NO_INDEX = ~0ul };     /*!< \brief Flag for padding. */
+
+  unsigned long nRow = 0;            /*!< \brief Number of (block) rows, excludes halos. */
+  unsigned long nVar = 0;            /*!< \brief Number of rows of the blocks. */
+  unsigned long nEqn = 0;            /*!< \brief Number of columns of the blocks. */
+  unsigned long nChunk = 0;          /*!< \brief Number of SIMD chunks. */
+  unsigned long omp_chunk_size = 1;  /*!< \brief Chunk size of the parallel loops over SIMD chunks. */
+  bool valid = false;                /*!< \brief If the values are consistent with the BCSR matrix. */
+  bool validInvDiag = false;         /*!< \brief If invDiag is consistent with the inverse diagonal of CSysMatrix. */
+
+  std::vector<unsigned long> row_perm;  /*!< \brief BCSR row of each lane of each chunk, NO_INDEX for padding. */
+  std::vector<unsigned long> chunk_ptr; /*!< \brief First slot of each chunk. */
+  std::vector<unsigned long> src_idx;   /*!< \brief BCSR block of each slot and lane, NO_INDEX for padding. */
+  std::vector<unsigned long> col_off;   /*!< \brief Offset (column times nEqn) in the vector, per slot and lane. */
+
+  ScalarType* values = nullptr;  /*!< \brief Interleaved block values. */
+  ScalarType* invDiag = nullptr; /*!< \brief Interleaved inverse of the diagonal blocks (for Jacobi). */
+
+ public:
+  CSlicedEllMatrix() = default;
+  CSlicedEllMatrix(const CSlicedEllMatrix&) = delete;
+  CSlicedEllMatrix& operator=(const CSlicedEllMatrix&) = delete;
+
+  /*!
+   * \brief Destructor.
+   */
+  ~CSlicedEllMatrix();
+
+  /*!
+   * \brief SIMD length (number of rows per chunk) used for ScalarType.
+   */
+  static unsigned long ChunkSize();
+
+  /*!
+   * \brief Compute the layout from the sparse pattern of the matrix (only the owned rows are considered).
+   * \note Only the master thread should call this method, calling it again discards the previous layout.
+   * \param[in] nrow - Number of owned rows.
+   * \param[in] nvar - Number of rows of the blocks.
+   * \param[in] neqn - Number of columns of the blocks.
+   * \param[in] row_ptr - Row pointer of the BCSR matrix.
+   * \param[in] col_ind - Column indices of the BCSR matrix.
+   */
+  void Initialize(unsigned long nrow, unsigned long nvar, unsigned long neqn, const unsigned long* row_ptr,
+                  const unsigned long* col_ind);
+
+  /*!
+   * \brief Whether the layout has been initialized.
+   */
+  inline bool IsInitialized() const { return nChunk != 0; }
+
+  /*!
+   * \brief Whether the values are consistent with those of the BCSR matrix.
+   */
+  inline bool IsValid() const { return valid; }
+
+  /*!
+   * \brief Flag the values as inconsistent with the BCSR matrix.
+   * \note The caller is responsible for the synchronization of the threads.
+   */
+  inline void Invalidate() { valid = false; }
+
+  /*!
+   * \brief Whether the inverse of the diagonal blocks is consistent with that of the BCSR matrix.
+   */
+  inline bool IsValidInvDiagonal() const { return validInvDiag; }
+
+  /*!
+   * \brief Flag the inverse of the diagonal blocks as inconsistent with that of the BCSR matrix.
+   * \note The caller is responsible for the synchronization of the threads.
+   */
+  inline void InvalidateInvDiagonal() { validInvDiag = false; }
+
+  /*!
+   * \brief Copy the values of the BCSR matrix (thread-parallel).
+   * \param[in] matrix - Values of the BCSR matrix.
+   */
+  void SetValues(const ScalarType* matrix);
+
+  /*!
+   * \brief Copy the inverse of the diagonal blocks (thread-parallel).
+   * \param[in] invM - Inverse diagonal blocks of the owned rows, contiguous.
+   */
+  void SetInvDiagonal(const ScalarType* invM);
+
+  /*!
+   * \brief Product y = A x for the owned rows (thread-parallel, no communication).
+   * \param[in] x - Input vector, including halos.
+   * \param[out] y - Output vector.
+   */
+  void MatrixVectorProduct(const ScalarType* x, ScalarType* y) const;
+
+  /*!
+   * \brief Product y = D^{-1} x for the owned rows (thread-parallel, no communication).
+   * \param[in] x - Input vector.
+   * \param[out] y - Output vector.
+   */
+  void InvDiagonalProduct(const ScalarType* x, ScalarType* y) const;
+};
@@ -31,6 +31,10 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
+#include "CSlicedEllMatrix.hpp"
+#include "CHalfBlockStorage.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -152,8 +156,17 @@ class CSysMatrix {
   const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  CCompressedSparsePatternUL ilu_lower_levels; /*!< \brief Level sets of the ILU factorization and forward solve. */
+  CCompressedSparsePatternUL ilu_upper_levels; /*!< \brief Level sets of the ILU backward solve. */
+
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  CHalfBlockStorage ILU_half;  /*!< \brief 16-bit entries of the ILU sparse matrix (replaces ILU_matrix). */
+  CHalfBlockStorage invM_half; /*!< \brief 16-bit inverse of the diagonal blocks (replaces invM). */
+
+  CSlicedEllMatrix<ScalarType> sliced; /*!< \brief SIMD-friendly (SELL-C-sigma) copy of the matrix. */
+  bool lusgs_inv_diag;                 /*!< \brief If LU_SGS uses the stored inverse of the diagonal blocks. */
+
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
   mutable vector<vector<const ScalarType*> >
       LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
@@ -179,6 +192,8 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg; /*!< \brief Hierarchy of the AMG preconditioner. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -304,6 +319,58 @@ class CSysMatrix {
    */
   inline void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType* invBlock) const;
 
+  /*!
+   * \brief Performs the product prod -= A_ilu(index) * vec, with the ILU block in full or 16-bit storage.
+   * \param[in] index - Position of the block in the ILU sparse pattern.
+   * \param[in] vec - Vector to be multiplied.
+   * \param[in,out] prod - Result of the product.
+   */
+  inline void ILUBlockProductSub(unsigned long index, const ScalarType* vec, ScalarType* prod) const;
+
+  /*!
+   * \brief Performs the product prod = inv(D_i) * vec, with the inverse block in full or 16-bit storage.
+   * \param[in] block_i - Index of the diagonal block.
+   * \param[in] vec - Vector to be multiplied.
+   * \param[out] prod - Result of the product.
+   */
+  inline void InvDiagonalBlockProduct(unsigned long block_i, const ScalarType* vec, ScalarType* prod) const;
+
+  /*!
+   * \brief ILU factorization (in-place) of a row within the sub matrix [begin, end[, the rows above it (in that
+   *        range) must have been factorized.
+   * \param[in] iPoint - Row index.
+   * \param[in] begin - First row of the sub matrix.
+   * \param[in] end - End of the sub matrix (one past the last row).
+   */
+  void ILURowFactorization(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief ILU factorization of a row with 16-bit storage of the factors, the row is factorized in a full
+   *        precision buffer, using the (decoded) rows above it, and then encoded.
+   * \param[in] iPoint - Row index.
+   * \param[in] begin - First row of the sub matrix.
+   * \param[in] end - End of the sub matrix (one past the last row).
+   * \param[in,out] rowBuffer - Working memory.
+   */
+  void CompressedILURowFactorization(unsigned long iPoint, unsigned long begin, unsigned long end,
+                                     vector<ScalarType>& rowBuffer);
+
+  /*!
+   * \brief Apply a function to all rows, level by level, the rows of each level are divided among the threads.
+   * \param[in] levels - Level sets (see levelSchedulePattern).
+   * \param[in] rowFunc - Function of the row index.
+   */
+  template <class F>
+  void ForEachRowByLevel(const CCompressedSparsePatternUL& levels, const F& rowFunc) const {
+    for (auto iLevel = 0ul; iLevel < levels.getOuterSize(); ++iLevel) {
+      const auto nRows = levels.getNumNonZeros(iLevel);
+      const auto rows = levels.innerIdx(iLevel);
+      SU2_OMP_FOR_STAT(roundUpDiv(nRows, omp_get_num_threads()))
+      for (auto k = 0ul; k < nRows; ++k) rowFunc(rows[k]);
+      END_SU2_OMP_FOR
+    }
+  }
+
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -838,6 +905,19 @@ class CSysMatrix {
   void MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                            const CConfig* config) const;
 
+  /*!
+   * \brief Update the sliced (SELL-C-sigma) copy of the matrix used by the SIMD products, if that storage mode is
+   *        enabled. The values can be modified in many ways (e.g. via pointers to blocks), hence the copy is always
+   *        updated, this is done by CSysSolve at the start of each linear solve.
+   */
+  void BuildSlicedMatrix();
+
+  /*!
+   * \brief Stop using the sliced copy of the matrix, the products use the BCSR values until the next call to
+   *        BuildSlicedMatrix. This is done by CSysSolve at the end of each linear solve.
+   */
+  void InvalidateSlicedMatrix();
+
   /*!
    * \brief Build the Jacobi preconditioner.
    */
@@ -868,6 +948,12 @@ class CSysMatrix {
   void ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                 const CConfig* config) const;
 
+  /*!
+   * \brief Build the LU_SGS preconditioner, the inverse of the diagonal blocks is only stored with the sliced
+   *        storage mode, otherwise the blocks are factorized on the fly and there is nothing to build.
+   */
+  void BuildLU_SGSPreconditioner();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -917,4 +1003,20 @@ class CSysMatrix {
    */
   void ComputePastixPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
+
+  /*!
+   * \brief Build the algebraic multigrid preconditioner (the aggregation is only computed the first time).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig* config);
+
+  /*!
+   * \brief Apply one AMG V-cycle to CSysVec.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
 };
@@ -209,3 +209,21 @@ FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<Scalar
                                                          ScalarType* prod) const {
   MatrixVectorProduct(&matrix[dia_ptr[row_i] * nVar * nEqn], &vec[row_i * nEqn], prod);
 }
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ILUBlockProductSub(unsigned long index, const ScalarType* vec,
+                                                            ScalarType* prod) const {
+  if (ILU_half.empty())
+    MatrixVectorProductSub(&ILU_matrix[index * nVar * nVar], vec, prod);
+  else
+    ILU_half.MatVecSub(index, vec, prod);
+}
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::InvDiagonalBlockProduct(unsigned long block_i, const ScalarType* vec,
+                                                                 ScalarType* prod) const {
+  if (invM_half.empty())
+    MatrixVectorProduct(&invM[block_i * nVar * nVar], vec, prod);
+  else
+    invM_half.MatVec(block_i, vec, prod);
+}
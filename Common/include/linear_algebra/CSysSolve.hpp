@@ -100,6 +100,16 @@ class CSysSolve {
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<ScalarType> pipe_dots; /*!< \brief Local and global dot products of pipelined FGMRES. */
+  mutable typename SelectMPIWrapper<ScalarType>::W::Request pipe_request; /*!< \brief Request of the reduction. */
+  mutable std::vector<ScalarType> block_dots; /*!< \brief Local and global dot products of BlockDot. */
+
+  std::vector<VectorType> RecU;  /*!< \brief Recycled subspace of GCRO-DR (solution space). */
+  std::vector<VectorType> RecC;  /*!< \brief Orthonormal image of the recycled subspace, RecC = A * RecU. */
+  std::vector<VectorType> RecUv; /*!< \brief Recycled subspace in the preconditioned space (to select it). */
+  unsigned long rec_size = 0;    /*!< \brief Current size of the recycled subspace. */
+  bool sameMatrix = false;       /*!< \brief If the matrix is the same as in the previous solve (see SetSameMatrix). */
+
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType
@@ -184,6 +194,46 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Start the (non-blocking) global reduction of the dot products of w with v[0:n-1], of w with itself,
+   *        and of v[n-1] with itself (to monitor the orthogonality of the basis).
+   * \note The local products are all computed in one pass over the vectors, and only one reduction is used.
+   * \param[in] w - The vector being orthogonalized.
+   * \param[in] n - Number of vectors of v.
+   * \param[in] v - The orthonormal basis.
+   */
+  void StartPipelinedDots(const VectorType& w, int n, const std::vector<VectorType>& v) const;
+
+  /*!
+   * \brief Complete the reduction started by StartPipelinedDots.
+   * \param[in] n - Number of vectors of v passed to StartPipelinedDots.
+   * \return Pointer to the n+2 global dot products (shared by all threads).
+   */
+  const ScalarType* FinishPipelinedDots(int n) const;
+
+  /*!
+   * \brief Compute all the dot products between two sets of vectors, with one pass and one global reduction.
+   * \param[in] x - First set of vectors.
+   * \param[in] y - Second set of vectors.
+   * \param[out] xy - Matrix of dot products, xy(i,j) = x[i] . y[j] (the same in all threads).
+   */
+  void BlockDot(const std::vector<const VectorType*>& x, const std::vector<const VectorType*>& y,
+                su2matrix<ScalarType>& xy) const;
+
+  /*!
+   * \brief Update the recycled subspace of GCRO-DR with the Krylov subspace of the last solve.
+   * \note The new subspace is spanned by the k vectors of [RecU Z] that minimize |A u| / |u| (measured in the
+   *       preconditioned space). These are computed from the small matrix G of the Arnoldi relation
+   *       A [RecU Z] = [RecC V] G, and so the image of the new subspace does not require products with A.
+   * \param[in] m - Number of Arnoldi iterations done.
+   * \param[in] Hbar - Hessenberg matrix of the deflated operator (before the Givens rotations).
+   * \param[in] B - Projections of A Z on RecC.
+   * \param[in] basis - Z (flexible) or V, the preconditioned basis vectors.
+   * \param[in] kMax - Maximum size of the recycled subspace.
+   */
+  void UpdateRecycledSubspace(unsigned long m, const su2matrix<ScalarType>& Hbar, const su2matrix<ScalarType>& B,
+                              const std::vector<VectorType>& basis, unsigned long kMax);
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -326,6 +376,26 @@ class CSysSolve {
                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                  bool monitoring, const CConfig* config) const;
 
+  /*!
+   * \brief Pipelined FGMRES, the global reduction of each Arnoldi step is overlapped with the next preconditioner
+   *        application and matrix-vector product (p(1)-GMRES, Ghysels et al. 2013).
+   * \note The orthogonalization uses classical Gram-Schmidt with a single reduction per iteration, a second
+   *       (blocking) pass is done only when cancellation is detected. The preconditioner must be a linear operator,
+   *       since its application to the new basis vector is obtained by recurrence.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                  bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Flexible Generalized Minimal Residual method with restarts (frequency comes from config).
    */
@@ -333,6 +403,26 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config);
 
+  /*!
+   * \brief FGMRES with a recycled (deflation) subspace carried between calls, GCRO-DR (Parks et al. 2006).
+   * \note The Krylov subspace is built for the operator projected out of the image of the recycled subspace. At the
+   *       end of each call the recycled subspace is updated with the Krylov subspace. Its image is recomputed (with
+   *       k products) only if the matrix changed since the previous call.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] newMatrix - Whether the matrix changed since the last call.
+   */
+  unsigned long GCRODR_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                 const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                 bool monitoring, const CConfig* config, bool newMatrix);
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -419,4 +509,11 @@ class CSysSolve {
    * \brief Set the screen output frequency during monitoring.
    */
   inline void SetMonitoringFrequency(bool frequency) { monitorFreq = frequency; }
+
+  /*!
+   * \brief Inform that the matrix of the next call to Solve is the same as in the previous call, GCRO-DR then reuses
+   *        the image of its recycled subspace. The flag is reset by Solve, by default the matrix is assumed to change.
+   * \note Only the master thread should call this.
+   */
+  inline void SetSameMatrix(bool same) { sameMatrix = same; }
 };
@@ -63,6 +63,26 @@ class CBlasStructure {
   void gemm(const int M, const int N, const int K, const su2double* A, const su2double* B, su2double* C,
             const CConfig* config);
 
+  /*!
+   * \brief Function, which carries out a batch of dense matrix products of the
+            same size, C_i = A_i*B_i, where the matrices of the batch are stored
+            with a constant stride. A stride of zero means that the same matrix
+            is used for the entire batch, e.g. the basis functions of a standard
+            element applied to a group of elements.
+   * \param[in]  M       - Number of rows of A and C.
+   * \param[in]  N       - Number of columns of B and C.
+   * \param[in]  K       - Number of columns of A and number of rows of B.
+   * \param[in]  nBatch  - Number of matrix products in the batch.
+   * \param[in]  A       - Input matrices in the multiplication.
+   * \param[in]  strideA - Distance between two consecutive matrices A.
+   * \param[in]  B       - Input matrices in the multiplication.
+   * \param[in]  strideB - Distance between two consecutive matrices B.
+   * \param[out] C       - Results of the matrix products A*B.
+   * \param[in]  strideC - Distance between two consecutive matrices C.
+   */
+  void gemm_batched(const int M, const int N, const int K, const int nBatch, const su2double* A, const long strideA,
+                    const su2double* B, const long strideB, su2double* C, const long strideC, const CConfig* config);
+
   /*!
    * \brief Function, which carries out a dense matrix vector product
             y = A x. It is a limited version of the BLAS gemv functionality.
@@ -543,5 +563,36 @@ class CBlasStructure {
    */
   void gemm_arbitrary(int m, int n, int k, const su2double* a, int lda, const su2double* b, int ldb, su2double* c,
                       int ldc);
+
+  /*!
+   * \brief Microkernel, which computes a MR x NR tile of the column major matrix c.
+            The sizes of the tile are template parameters, such that the accumulators
+            can be kept in registers and the inner loops are vectorized.
+   * \param[in]  k   - Number of columns of a and number of rows of b.
+   * \param[in]  a   - Input matrix in the multiplication, MR rows.
+   * \param[in]  lda - Leading dimension of the matrix a.
+   * \param[in]  b   - Input matrix in the multiplication, NR columns.
+   * \param[in]  ldb - Leading dimension of the matrix b.
+   * \param[out] c   - Tile of the matrix c to which a*b is added.
+   * \param[in]  ldc - Leading dimension of the matrix c.
+   */
+  template <int MR, int NR>
+  static void gemm_micro(const int k, const su2double* a, const int lda, const su2double* b, const int ldb,
+                         su2double* c, const int ldc) {
+    su2double acc[NR][MR];
+    for (int j = 0; j < NR; ++j)
+      for (int i = 0; i < MR; ++i) acc[j][i] = 0.0;
+
+    for (int p = 0; p < k; ++p) {
+      const su2double* ap = a + p * lda;
+      for (int j = 0; j < NR; ++j) {
+        const su2double bpj = b[j * ldb + p];
+        for (int i = 0; i < MR; ++i) acc[j][i] += ap[i] * bpj;
+      }
+    }
+
+    for (int j = 0; j < NR; ++j)
+      for (int i = 0; i < MR; ++i) c[j * ldc + i] += acc[j][i];
+  }
 #endif
 };
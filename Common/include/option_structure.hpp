@@ -119,6 +119,7 @@ const unsigned short COMM_TYPE_DOUBLE         = 4;  /*!< \brief Communication ty
 const unsigned short COMM_TYPE_CHAR           = 5;  /*!< \brief Communication type for char. */
 const unsigned short COMM_TYPE_SHORT          = 6;  /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7;  /*!< \brief Communication type for int. */
+const unsigned short COMM_TYPE_FLOAT          = 8;  /*!< \brief Communication type for float. */
 
 /*!
  * \brief Types of geometric entities based on VTK nomenclature
@@ -291,6 +292,20 @@ static const MapType<std::string, ENUM_MULTIZONE> Multizone_Map = {
   MakePair("BLOCK_JACOBI", ENUM_MULTIZONE::MZ_BLOCK_JACOBI)
 };
 
+/*!
+ * \brief Reordering of the points of each partition, for memory locality.
+ */
+enum class POINT_ORDERING {
+  RCM,      /*!< \brief Reverse Cuthill-McKee, minimizes the bandwidth of the matrices. */
+  HILBERT,  /*!< \brief Hilbert space filling curve through the coordinates of the points. */
+  MORTON,   /*!< \brief Morton (Z-order) space filling curve through the coordinates of the points. */
+};
+static const MapType<std::string, POINT_ORDERING> PointOrdering_Map = {
+  MakePair("RCM", POINT_ORDERING::RCM)
+  MakePair("HILBERT", POINT_ORDERING::HILBERT)
+  MakePair("MORTON", POINT_ORDERING::MORTON)
+};
+
 /*!
  * \brief Material geometric conditions
  */
@@ -2061,13 +2076,15 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 binary input format (fixed-width blocks read in parallel). */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 
@@ -2086,6 +2103,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2111,6 +2129,7 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
@@ -2299,12 +2318,16 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_FGMRES,     /*!< \brief FGMRES with global reductions overlapped with the preconditioner and product. */
+  GCRODR,               /*!< \brief FGMRES with a recycled subspace carried between linear solves (GCRO-DR). */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("GCRODR", GCRODR)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -2364,6 +2387,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2373,11 +2397,26 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
 };
 
+/*!
+ * \brief Floating point format used to store the factors of the linear preconditioners.
+ */
+enum class PREC_STORAGE {
+  FULL,  /*!< \brief Same type as the linear solver. */
+  FP16,  /*!< \brief IEEE 754 half precision (with one scale factor per block). */
+  BF16,  /*!< \brief bfloat16, range of single precision with 8 bits of mantissa. */
+};
+static const MapType<std::string, PREC_STORAGE> Prec_Storage_Map = {
+  MakePair("FULL", PREC_STORAGE::FULL)
+  MakePair("FP16", PREC_STORAGE::FP16)
+  MakePair("BF16", PREC_STORAGE::BF16)
+};
+
 /*!
  * \brief Types of analytic definitions for various geometries
  */
@@ -2550,6 +2589,7 @@ enum class MPI_QUANTITIES {
   PRIMITIVE_GRADIENT   ,  /*!< \brief Primitive gradient communication. */
   PRIMITIVE_GRAD_REC   ,  /*!< \brief Primitive reconstruction gradient communication. */
   PRIMITIVE_LIMITER    ,  /*!< \brief Primitive limiter communication. */
+  PRIMITIVE_RECONSTRUCTION, /*!< \brief Primitive reconstruction gradient and limiter communication. */
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
@@ -2582,6 +2622,18 @@ static const MapType<std::string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Compression of the halo (point-to-point) comms.
+ */
+enum class HALO_COMPRESSION {
+  NONE,     /*!< \brief All halo data is exchanged in full precision. */
+  FLOAT32,  /*!< \brief Gradients and limiters are exchanged in single precision. */
+};
+static const MapType<std::string, HALO_COMPRESSION> HaloCompression_Map = {
+  MakePair("NONE", HALO_COMPRESSION::NONE)
+  MakePair("FLOAT32", HALO_COMPRESSION::FLOAT32)
+};
+
 /*!
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
@@ -173,6 +173,20 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int nrequests, Request* request) { MPI_Startall(nrequests, request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
@@ -208,6 +222,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -376,6 +395,26 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Irecv(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm), request);
   }
 
+  /*--- Persistent requests are not differentiated, they are only used by the primal solvers. ---*/
+
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not supported in AD builds.", CURRENT_FUNCTION);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not supported in AD builds.", CURRENT_FUNCTION);
+  }
+
+  static inline void Start(Request* request) {
+    Error("Persistent requests are not supported in AD builds.", CURRENT_FUNCTION);
+  }
+
+  static inline void Startall(int nrequests, Request* request) {
+    Error("Persistent requests are not supported in AD builds.", CURRENT_FUNCTION);
+  }
+
   static inline void Wait(SU2_MPI::Request* request, Status* status) { AMPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return AMPI_Request_free(request); }
@@ -413,6 +452,11 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    AMPI_Iallreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm), request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
@@ -539,6 +583,16 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int nrequests, Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request* request) { return 0; }
@@ -562,6 +616,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, count, datatype);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    CopyData(sendbuf, recvbuf, count, datatype);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
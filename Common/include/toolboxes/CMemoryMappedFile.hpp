@@ -0,0 +1,82 @@
+/*!
+ * \file CMemoryMappedFile.hpp
+ * \brief Header file for the class CMemoryMappedFile.
+ *        The implementations are in the <i>CMemoryMappedFile.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*!
+ * \class CMemoryMappedFile
+ * \brief Read-only memory mapping of a file, for sequential parsing without intermediate copies.
+ * \note Only available on POSIX systems, elsewhere (or if mapping fails) the object is empty and callers
+ *       should fall back to regular I/O.
+ */
+class CMemoryMappedFile {
+ private:
+  const char* fileData = nullptr; /*!< \brief Start of the mapping. */
+  size_t fileSize = 0;            /*!< \brief Size of the file. */
+
+ public:
+  /*!
+   * \brief Map a file, the object is empty if that is not possible.
+   * \param[in] filename - Name of the file.
+   */
+  explicit CMemoryMappedFile(const std::string& filename);
+
+  /*!
+   * \brief Unmap the file.
+   */
+  ~CMemoryMappedFile();
+
+  CMemoryMappedFile(const CMemoryMappedFile&) = delete;
+  CMemoryMappedFile& operator=(const CMemoryMappedFile&) = delete;
+
+  /*!
+   * \brief Whether the file is mapped.
+   */
+  inline bool IsMapped() const { return fileData != nullptr; }
+
+  /*!
+   * \brief Start of the file contents.
+   */
+  inline const char* data() const { return fileData; }
+
+  /*!
+   * \brief Size of the file in bytes.
+   */
+  inline size_t size() const { return fileSize; }
+
+  /*!
+   * \brief Drop the pages within a range from memory (they are read again from the file if accessed).
+   * \note Used while streaming through the file to keep the resident memory bounded, only whole pages are dropped.
+   * \param[in] begin - Start of the range that is no longer needed.
+   * \param[in] end - End of the range.
+   */
+  void Release(size_t begin, size_t end) const;
+};
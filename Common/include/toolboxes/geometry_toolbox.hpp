@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 namespace GeometryToolbox {
 /// \addtogroup GeometryToolbox
@@ -216,5 +217,58 @@ inline void TangentProjection(Int nDim, const Mat& tensor, const Scalar* vector,
 
   for (Int iDim = 0; iDim < nDim; iDim++) proj[iDim] -= normalProj * vector[iDim];
 }
+
+/*!
+ * \brief Position of a point along the Morton (Z-order) space filling curve.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] coord - Integer coordinates of the point, with at most 64/nDim significant bits.
+ * \return Key obtained by interleaving the bits of the coordinates (the first coordinate is the most significant).
+ */
+template <typename Int>
+inline uint64_t MortonKey(Int nDim, const uint32_t* coord) {
+  const int nBits = 64 / nDim;
+  uint64_t key = 0;
+  for (int iBit = nBits - 1; iBit >= 0; --iBit)
+    for (Int iDim = 0; iDim < nDim; ++iDim) key = (key << 1) | ((coord[iDim] >> iBit) & 1u);
+  return key;
+}
+
+/*!
+ * \brief Position of a point along the Hilbert space filling curve.
+ * \note Uses the transpose form of J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004), the
+ *       coordinates are transformed such that interleaving their bits gives the Hilbert index.
+ * \param[in] nDim - Number of dimensions (at most 3).
+ * \param[in] coord - Integer coordinates of the point, with at most 64/nDim significant bits.
+ * \return Key along the curve.
+ */
+template <typename Int>
+inline uint64_t HilbertKey(Int nDim, const uint32_t* coord) {
+  const int nBits = 64 / nDim;
+  uint32_t X[3] = {0, 0, 0};
+  for (Int iDim = 0; iDim < nDim; ++iDim) X[iDim] = coord[iDim];
+
+  /*--- Inverse undo. ---*/
+  for (uint32_t Q = uint32_t(1) << (nBits - 1); Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (Int iDim = 0; iDim < nDim; ++iDim) {
+      if (X[iDim] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[iDim]) & P;
+        X[0] ^= t;
+        X[iDim] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (Int iDim = 1; iDim < nDim; ++iDim) X[iDim] ^= X[iDim - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = uint32_t(1) << (nBits - 1); Q > 1; Q >>= 1)
+    if (X[nDim - 1] & Q) t ^= Q - 1;
+  for (Int iDim = 0; iDim < nDim; ++iDim) X[iDim] ^= t;
+
+  return MortonKey(nDim, X);
+}
 /// @}
 }  // namespace GeometryToolbox
@@ -594,6 +594,53 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
   return T(std::move(colorPtr), std::move(outerIdx));
 }
 
+/*!
+ * \brief Compute the level sets (wavefronts) of the lower or upper triangular part of a sparse pattern.
+ * \note  In the lower part, row i depends on the rows j < i in its pattern (e.g. forward substitution), its level
+ *        is one more than the maximum level of those rows. In the upper part the dependencies are the rows j > i.
+ *        The rows of a level only depend on rows of previous levels, and so they can be processed in parallel.
+ *        As for colorings, the result is a compressed sparse pattern where the levels are outer indices, and
+ *        the rows of each level are inner indices (in ascending order).
+ * \param[in] pattern - Sparse pattern (row-major).
+ * \param[in] nOuter - Only the first nOuter rows and columns are considered (e.g. to exclude halos).
+ * \param[in] upper - Whether to schedule the upper triangular part.
+ * \return Level sets in the same type of the input pattern.
+ */
+template <class T, class Index_t = typename T::IndexType>
+T levelSchedulePattern(const T& pattern, Index_t nOuter, bool upper) {
+  std::vector<Index_t> level(nOuter, 0);
+  Index_t nLevel = 0;
+
+  auto setLevel = [&](Index_t iOuter) {
+    Index_t lvl = 0;
+    for (auto iInner : pattern.getInnerIter(iOuter)) {
+      const bool dependency = upper ? (iInner > iOuter && iInner < nOuter) : (iInner < iOuter);
+      if (dependency) lvl = std::max(lvl, level[iInner] + 1);
+    }
+    level[iOuter] = lvl;
+    nLevel = std::max(nLevel, lvl + 1);
+  };
+
+  if (upper) {
+    for (Index_t iOuter = nOuter; iOuter > 0; --iOuter) setLevel(iOuter - 1);
+  } else {
+    for (Index_t iOuter = 0; iOuter < nOuter; ++iOuter) setLevel(iOuter);
+  }
+
+  /*--- Compress the level information (bucket sort of the rows). ---*/
+
+  su2vector<Index_t> levelPtr(nLevel + 1);
+  levelPtr = 0;
+  for (Index_t iOuter = 0; iOuter < nOuter; ++iOuter) ++levelPtr(level[iOuter] + 1);
+  for (Index_t iLevel = 0; iLevel < nLevel; ++iLevel) levelPtr(iLevel + 1) += levelPtr(iLevel);
+
+  su2vector<Index_t> outerIdx(nOuter);
+  std::vector<Index_t> pos(levelPtr.data(), levelPtr.data() + nLevel);
+  for (Index_t iOuter = 0; iOuter < nOuter; ++iOuter) outerIdx(pos[level[iOuter]]++) = iOuter;
+
+  return T(std::move(levelPtr), std::move(outerIdx));
+}
+
 /*!
  * \brief A way to represent one grid color that allows range-for syntax.
  */
@@ -33,6 +33,7 @@
 
 #include "../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../include/fem/fem_geometry_structure.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
@@ -703,6 +704,11 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
       nZone = 1;
       break;
     }
+    case SU2_BINARY: {
+      /*--- The binary format stores one zone per file. ---*/
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -813,6 +819,10 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+      nDim = CSU2BinaryMeshReaderFVM::GetnDim(val_mesh_filename);
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -1173,6 +1183,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_RESTART_OVERWRITE", Wrt_Restart_Overwrite, true);
+  /*!\brief RESTART_AGGREGATORS \n DESCRIPTION: Number of ranks that gather the binary restart data of groups of consecutive ranks and write it in large chunks, 0 for all ranks. \ingroup Config */
+  addUnsignedLongOption("RESTART_AGGREGATORS", Restart_Aggregators, 0);
+  /*!\brief RESTART_ASYNC \n DESCRIPTION: Write the binary restart data from a background thread while the solver continues. \n Options: NO, YES \ingroup Config */
+  addBoolOption("RESTART_ASYNC", Restart_Async, false);
   /*!\brief WRT_SURFACE_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
@@ -1759,6 +1773,10 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Max. number of iterations that reuse the Jacobian and preconditioner (0 updates every iteration). */
+  addUnsignedShortOption("NEWTON_KRYLOV_MAX_JACOBIAN_AGE", NK_MaxJacobianAge, 0);
+  /* DESCRIPTION: Growth of the linear iterations, or decrease of the residual drop, that forces a Jacobian update. */
+  addDoubleOption("NEWTON_KRYLOV_REUSE_TOLERANCE", NK_ReuseTolerance, 1.5);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1850,12 +1868,28 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of levels (including the finest) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 8);
+  /* DESCRIPTION: Number of pre and post smoothing (block-Jacobi) sweeps of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 2);
+  /* DESCRIPTION: Strength of connection threshold used to form the aggregates of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
+  /* DESCRIPTION: Relaxation factor of the block-Jacobi smoother of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_RELAXATION", Linear_Solver_AMG_Relaxation, 0.7);
+  /* DESCRIPTION: Keep a sliced ELLPACK copy of the matrix for SIMD matrix-vector products and Jacobi/LU_SGS */
+  addBoolOption("LINEAR_SOLVER_SELL_STORAGE", Linear_Solver_SELL, false);
+  /* DESCRIPTION: Format of the stored ILU factors and inverse diagonal blocks (FULL, FP16, BF16) */
+  addEnumOption("LINEAR_SOLVER_PREC_STORAGE", Linear_Solver_Prec_Storage, Prec_Storage_Map, PREC_STORAGE::FULL);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of vectors of the subspace recycled between linear solves by GCRODR */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 8);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Parallelize ILU by level scheduling (same factor as serial ILU) instead of by partitioning. */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Levels, false);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1938,6 +1972,12 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Gather the neighbor min/max for the flow limiters in the same pass as the reconstruction gradients. DEFAULT: NO \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", Fused_Gradient_Limiter, false);
+  /*!\brief OVERLAP_HALO_COMMS
+   *  \n DESCRIPTION: Exchange the halos of the flow reconstruction gradients and limiters while the fluxes of the edges between owned points are computed. DEFAULT: NO \ingroup Config*/
+  addBoolOption("OVERLAP_HALO_COMMS", Overlap_Halo_Comms, false);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -2205,6 +2245,10 @@ void CConfig::SetConfig_Options() {
   /*!\brief COMM_LEVEL
    *  \n DESCRIPTION: Level of MPI communications during runtime  \ingroup Config*/
   addEnumOption("COMM_LEVEL", Comm_Level, Comm_Map, COMM_FULL);
+  /* DESCRIPTION: Set up the point-to-point (halo) comms once as persistent requests and then only start them. */
+  addBoolOption("PERSISTENT_P2P_COMMS", Persistent_P2P_Comms, false);
+  /* DESCRIPTION: Compression of the halo comms, FLOAT32 exchanges the gradients and limiters in single precision. */
+  addEnumOption("HALO_COMPRESSION", Kind_Halo_Compression, HaloCompression_Map, HALO_COMPRESSION::NONE);
 
   /*!\par CONFIG_CATEGORY: Dynamic mesh definition \ingroup Config*/
   /*--- Options related to dynamic meshes ---*/
@@ -2428,6 +2472,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("FEA_FILENAME", FEA_FileName, string("default_element_properties.dat"));
   /* DESCRIPTION: Determine if advanced features are used from the element-based FEA analysis (NO, YES = experimental) */
   addBoolOption("FEA_ADVANCED_MODE", FEAAdvancedMode, false);
+  /* DESCRIPTION: Apply the tangent operator element by element in the linear solver instead of assembling the Jacobian (NO, YES) */
+  addBoolOption("FEA_MATRIX_FREE", FEA_MatrixFree, false);
+  /* DESCRIPTION: Compute the element stiffness matrices for SIMD-width batches of elements of the same type (NO, YES) */
+  addBoolOption("FEA_VECTORIZATION", FEA_Vectorization, false);
 
   /* DESCRIPTION: Modulus of elasticity */
   addDoubleListOption("ELASTICITY_MODULUS", nElasticityMod, ElasticityMod);
@@ -2845,6 +2893,34 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: ParMETIS load balancing weight added to points on viscous walls */
+  addLongOption("PARMETIS_WALL_WEIGHT", ParMETIS_wallWgt, 0);
+
+  /* DESCRIPTION: Balance the wall weight as a separate ParMETIS constraint */
+  addBoolOption("PARMETIS_MULTI_CONSTRAINT", ParMETIS_multiConstraint, false);
+
+  /* DESCRIPTION: Weight the partitioning with the costs measured by the previous run, and measure them again */
+  addBoolOption("PARMETIS_CALIBRATION", ParMETIS_calibration, false);
+
+  /* DESCRIPTION: File of the measured partitioning costs */
+  addStringOption("PARMETIS_CALIBRATION_FILENAME", ParMETIS_calibrationFile, string("partition_costs.dat"));
+
+  /* DESCRIPTION: Time iterations between checks of the measured load imbalance, 0 disables the dynamic rebalancing */
+  addUnsignedLongOption("PARMETIS_REBALANCE_FREQ", ParMETIS_rebalanceFreq, 0);
+
+  /* DESCRIPTION: Measured load imbalance (max/avg) that triggers a repartitioning during the run */
+  addDoubleOption("PARMETIS_REBALANCE_THRESHOLD", ParMETIS_rebalanceThreshold, 1.1);
+
+  /* DESCRIPTION: Reordering of the points of each partition for memory locality (RCM, HILBERT, MORTON) */
+  addEnumOption("POINT_ORDERING", Kind_PointOrdering, PointOrdering_Map, POINT_ORDERING::RCM);
+
+  /* DESCRIPTION: Cache the partitioning, point ordering and agglomeration of the geometry preprocessing (per rank),
+   * the edge coloring is not cached and is recomputed */
+  addBoolOption("GEOMETRY_CACHE", Geometry_Cache, false);
+
+  /* DESCRIPTION: Prefix of the geometry cache files */
+  addStringOption("GEOMETRY_CACHE_FILENAME", Geometry_Cache_FileName, string("geometry_cache"));
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -3869,6 +3945,12 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     if (Kind_Struct_Solver == STRUCT_DEFORMATION::SMALL){
       MinLogResidual = log10(Linear_Solver_Error);
     }
+    /*--- Without the matrix only Krylov methods can be used. ---*/
+    if (FEA_MatrixFree && (Kind_Linear_Solver != CONJUGATE_GRADIENT) && (Kind_Linear_Solver != BCGSTAB) &&
+        (Kind_Linear_Solver != FGMRES) && (Kind_Linear_Solver != RESTARTED_FGMRES)) {
+      SU2_MPI::Error("FEA_MATRIX_FREE requires LINEAR_SOLVER= CONJUGATE_GRADIENT, BCGSTAB, FGMRES, or RESTARTED_FGMRES.",
+                     CURRENT_FUNCTION);
+    }
   }
 
   Radiation = (Kind_Radiation != RADIATION_MODEL::NONE);
@@ -5275,6 +5357,20 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       SU2_MPI::Error("COMM_LEVEL = NONE not yet implemented.", CURRENT_FUNCTION);
   }
 
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  /*--- Persistent requests are not differentiated, AD builds use the regular comms. ---*/
+  Persistent_P2P_Comms = false;
+  /*--- The adjoint of the halo exchanges needs the full precision data. ---*/
+  Kind_Halo_Compression = HALO_COMPRESSION::NONE;
+  /*--- The linear solver of the FEA adjoint is the transposed assembled Jacobian. ---*/
+  FEA_MatrixFree = false;
+  /*--- The batched element kernels are not pre-accumulated, use the scalar ones. ---*/
+  FEA_Vectorization = false;
+  /*--- The migration of the state between ranks is passive, it would lose the derivatives. ---*/
+  if (ParMETIS_rebalanceFreq > 0)
+    SU2_MPI::Error("PARMETIS_REBALANCE_FREQ is not available in AD builds.", CURRENT_FUNCTION);
+#endif
+
   /*--- Check the conductivity model. Deactivate the turbulent component
    if we are not running RANS. ---*/
 
@@ -5599,6 +5695,19 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (Kind_Regime == ENUM_REGIME::COMPRESSIBLE && GetBounded_Scalar()) {
     SU2_MPI::Error("BOUNDED_SCALAR discretization can only be used for incompressible problems.", CURRENT_FUNCTION);
   }
+
+  /*--- The dynamic load balancing rebuilds the zone between time steps, it is limited to the cases where
+   *    the solution variables are the complete state (no grid motion, no adjoints, no coupling). ---*/
+  if (ParMETIS_rebalanceFreq > 0) {
+    if (!GetFluidProblem() || !Time_Domain || Multizone_Problem || GetDynamic_Grid() || DiscreteAdjoint ||
+        GetBoolTurbomachinery()) {
+      SU2_MPI::Error("PARMETIS_REBALANCE_FREQ is only available for single-zone, time-domain fluid simulations\n"
+                     "on static meshes.", CURRENT_FUNCTION);
+    }
+    if (ParMETIS_rebalanceThreshold <= 1.0) {
+      SU2_MPI::Error("PARMETIS_REBALANCE_THRESHOLD must be greater than 1.", CURRENT_FUNCTION);
+    }
+  }
 }
 
 void CConfig::SetMarkers(SU2_COMPONENT val_software) {
@@ -7082,12 +7191,20 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_FGMRES:
+            case GCRODR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == GCRODR)
+                cout << "GCRO-DR (FGMRES with " << Linear_Solver_Recycle_Size
+                     << " recycled vectors) is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG: cout << "Using an AMG (" << Linear_Solver_AMG_Levels << " levels max.) preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
@@ -7096,6 +7213,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An AMG"; break;
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
@@ -7128,8 +7246,14 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
-              cout << "FGMRES is used for solving the linear system." << endl;
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_FGMRES: case GCRODR:
+              if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == GCRODR)
+                cout << "GCRO-DR (FGMRES with " << Linear_Solver_Recycle_Size
+                     << " recycled vectors) is used for solving the linear system." << endl;
+              else
+                cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
@@ -1884,6 +1884,69 @@ CFEMStandardElement::CFEMStandardElement(unsigned short val_VTK_Type, unsigned s
       mat2ndDerBasisIntPoint = mat2ndDerBasisIntPoint + offsetDerInt;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Create the 1D data for the sum factorization kernels, if these     ---*/
+  /*--- kernels can be used for this element.                              ---*/
+  /*--------------------------------------------------------------------------*/
+
+  CreateSumFactorizationData();
+}
+
+void CFEMStandardElement::SumFactDOFsToIntegration(const unsigned short NPad, const unsigned short derDir,
+                                                   const su2double* dataDOFs, su2double* dataInt,
+                                                   su2double* work) const {
+  /*--- Set the 1D matrices for the three parametric directions. The derivative
+        matrix is only used in the direction indicated by derDir. ---*/
+  const unsigned short P = nDOFs1D;
+  const unsigned short M = nIntegration1D;
+
+  const su2double* matR = (derDir == 1) ? drLagBasisIntegration1D.data() : lagBasisIntegration1D.data();
+  const su2double* matS = (derDir == 2) ? drLagBasisIntegration1D.data() : lagBasisIntegration1D.data();
+  const su2double* matT = (derDir == 3) ? drLagBasisIntegration1D.data() : lagBasisIntegration1D.data();
+
+  if (VTK_Type == QUADRILATERAL) {
+    /*--- Quadrilateral. First sweep in r-direction, (P,P) -> (M,P), followed
+          by the sweep in s-direction, (M,P) -> (M,M). ---*/
+    TensorContraction1D(NPad, P, P, M, 1, matR, NPad, dataDOFs, work, false);
+    TensorContraction1D(NPad, 1, P, M, M, matS, NPad, work, dataInt, false);
+  } else {
+    /*--- Hexahedron. The intermediate results of the sweeps in r- and s-direction
+          never exceed the size of the final result, because M >= P. Hence the
+          output array itself can be used for the first sweep. ---*/
+    TensorContraction1D(NPad, P * P, P, M, 1, matR, NPad, dataDOFs, dataInt, false);
+    TensorContraction1D(NPad, P, P, M, M, matS, NPad, dataInt, work, false);
+    TensorContraction1D(NPad, 1, P, M, M * M, matT, NPad, work, dataInt, false);
+  }
+}
+
+void CFEMStandardElement::SumFactIntegrationToDOFs(const unsigned short NPad, const unsigned short derDir,
+                                                   const unsigned short ldInt, const su2double* dataInt,
+                                                   su2double* dataDOFs, su2double* work, const bool addToDOFs) const {
+  /*--- Set the transposed 1D matrices for the three parametric directions,
+        such that the sums are taken over the integration points. ---*/
+  const unsigned short P = nDOFs1D;
+  const unsigned short M = nIntegration1D;
+
+  const su2double* matR = (derDir == 1) ? drLagBasisIntegration1DTrans.data() : lagBasisIntegration1DTrans.data();
+  const su2double* matS = (derDir == 2) ? drLagBasisIntegration1DTrans.data() : lagBasisIntegration1DTrans.data();
+  const su2double* matT = (derDir == 3) ? drLagBasisIntegration1DTrans.data() : lagBasisIntegration1DTrans.data();
+
+  if (VTK_Type == QUADRILATERAL) {
+    /*--- Quadrilateral. Sweep in r-direction, (M,M) -> (P,M), followed by
+          the sweep in s-direction, (P,M) -> (P,P). ---*/
+    TensorContraction1D(NPad, M, M, P, 1, matR, ldInt, dataInt, work, false);
+    TensorContraction1D(NPad, 1, M, P, P, matS, NPad, work, dataDOFs, addToDOFs);
+  } else {
+    /*--- Hexahedron. Sweeps in r-, s- and t-direction, (M,M,M) -> (P,M,M)
+          -> (P,P,M) -> (P,P,P). The two intermediate results are stored
+          in two different parts of the work array. ---*/
+    su2double* work2 = work + nIntegration * NPad;
+
+    TensorContraction1D(NPad, M * M, M, P, 1, matR, ldInt, dataInt, work, false);
+    TensorContraction1D(NPad, M, M, P, P, matS, NPad, work, work2, false);
+    TensorContraction1D(NPad, 1, M, P, P * P, matT, NPad, work2, dataDOFs, addToDOFs);
+  }
 }
 
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double* parCoor, vector<su2double>& lagBasis) {
@@ -2062,6 +2125,106 @@ void CFEMStandardElement::Copy(const CFEMStandardElement& other) {
   matDerBasisSolDOFs = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt = other.mat2ndDerBasisInt;
+
+  nDOFs1D = other.nDOFs1D;
+  nIntegration1D = other.nIntegration1D;
+  lagBasisIntegration1D = other.lagBasisIntegration1D;
+  drLagBasisIntegration1D = other.drLagBasisIntegration1D;
+  lagBasisIntegration1DTrans = other.lagBasisIntegration1DTrans;
+  drLagBasisIntegration1DTrans = other.drLagBasisIntegration1DTrans;
+}
+
+void CFEMStandardElement::CreateSumFactorizationData() {
+  /*--- Initialize the number of 1D DOFs and integration points to zero,
+        which indicates that the sum factorization kernels are not used. ---*/
+  nDOFs1D = nIntegration1D = 0;
+
+  /*--- Sum factorization is only possible for the tensor product elements.
+        For a linear element it is not beneficial compared to the matrix
+        multiplications with the full basis functions. ---*/
+  if ((VTK_Type != QUADRILATERAL) && (VTK_Type != HEXAHEDRON)) return;
+  if (nPoly < 2) return;
+
+  /*--- Determine the number of integration points in 1D. The kernels assume
+        that the number of 1D integration points is not smaller than the number
+        of 1D DOFs, such that the intermediate results never need more memory
+        than the data in the integration points. ---*/
+  const unsigned short M = orderExact / 2 + 1;
+  if (M < nPoly + 1) return;
+
+  const unsigned short nIntTensor = (VTK_Type == QUADRILATERAL) ? M * M : M * M * M;
+  if (nIntTensor != nIntegration) return;
+
+  /*--- The 1D integration points are the first M integration points of the
+        element, because the r-coordinate runs fastest. Compute the 1D
+        Lagrangian basis functions and its derivatives in these points. ---*/
+  vector<su2double> rInt1D(rIntegration.begin(), rIntegration.begin() + M);
+
+  unsigned short nDOFsLine;
+  vector<su2double> rDOFsLine, matVandermondeInvLine;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, rInt1D, nDOFsLine, rDOFsLine, matVandermondeInvLine,
+                                            lagBasisIntegration1D, drLagBasisIntegration1D);
+
+  CheckSumLagrangianBasisFunctions(M, nDOFsLine, lagBasisIntegration1D);
+  CheckSumDerivativesLagrangianBasisFunctions(M, nDOFsLine, drLagBasisIntegration1D);
+
+  /*--- Create the transpose of the 1D matrices, which are needed for the
+        contractions from the integration points to the DOFs. ---*/
+  lagBasisIntegration1DTrans.resize(lagBasisIntegration1D.size());
+  drLagBasisIntegration1DTrans.resize(drLagBasisIntegration1D.size());
+
+  for (unsigned short j = 0; j < nDOFsLine; ++j) {
+    for (unsigned short i = 0; i < M; ++i) {
+      lagBasisIntegration1DTrans[j * M + i] = lagBasisIntegration1D[i * nDOFsLine + j];
+      drLagBasisIntegration1DTrans[j * M + i] = drLagBasisIntegration1D[i * nDOFsLine + j];
+    }
+  }
+
+  /*--- Set the number of 1D DOFs and integration points, which indicates
+        that the sum factorization kernels can be used. ---*/
+  nDOFs1D = nDOFsLine;
+  nIntegration1D = M;
+}
+
+void CFEMStandardElement::TensorContraction1D(const unsigned short NPad, const unsigned short nOuter,
+                                              const unsigned short nIn, const unsigned short nOut,
+                                              const unsigned short nInner, const su2double* mat,
+                                              const unsigned short ldIn, const su2double* dataIn, su2double* dataOut,
+                                              const bool addToOut) {
+  /*--- If the input data is contiguous and the result is not added, the contraction
+        is a strided batch of nOuter matrix products of the 1D matrix with a matrix
+        of nIn x (nInner*NPad). The last argument is NULL, such that these gemm calls
+        are ignored in the profiling and the kernels can be called by multiple threads. ---*/
+  if ((ldIn == NPad) && !addToOut) {
+    CBlasStructure blasFunctions;
+    const int N = nInner * NPad;
+    blasFunctions.gemm_batched(nOut, N, nIn, nOuter, mat, 0, dataIn, (long)nIn * N, dataOut, (long)nOut * N,
+                               nullptr);
+    return;
+  }
+
+  /*--- General case. Loop over the outer and inner indices of the tensor, which
+        are not affected by this contraction, and the new index in the contracted
+        direction. ---*/
+  for (unsigned short outer = 0; outer < nOuter; ++outer) {
+    for (unsigned short a = 0; a < nOut; ++a) {
+      for (unsigned short inner = 0; inner < nInner; ++inner) {
+        su2double* out = dataOut + ((unsigned long)(outer * nOut + a) * nInner + inner) * NPad;
+        if (!addToOut)
+          for (unsigned short m = 0; m < NPad; ++m) out[m] = 0.0;
+
+        /*--- Carry out the contraction in the 1D direction. The NPad entries
+              are contiguous in memory, such that the inner loop vectorizes. ---*/
+        for (unsigned short b = 0; b < nIn; ++b) {
+          const su2double c = mat[a * nIn + b];
+          const su2double* in = dataIn + ((unsigned long)(outer * nIn + b) * nInner + inner) * ldIn;
+
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (unsigned short m = 0; m < NPad; ++m) out[m] += c * in[m];
+        }
+      }
+    }
+  }
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -94,12 +94,17 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  FreePersistentP2P();
+
   delete[] bufD_P2PRecv;
   delete[] bufD_P2PSend;
 
   delete[] bufS_P2PRecv;
   delete[] bufS_P2PSend;
 
+  delete[] bufF_P2PRecv;
+  delete[] bufF_P2PSend;
+
   delete[] req_P2PSend;
   delete[] req_P2PRecv;
 
@@ -277,6 +282,9 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
   bufS_P2PSend = nullptr;
   bufS_P2PRecv = nullptr;
 
+  bufF_P2PSend = nullptr;
+  bufF_P2PRecv = nullptr;
+
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
   if (nP2PSend > 0) {
@@ -346,6 +354,10 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     maxCountPerPoint = countPerPoint;
 
+    /*--- The persistent requests refer to the old buffers. ---*/
+
+    FreePersistentP2P();
+
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
     delete[] bufD_P2PSend;
@@ -359,6 +371,12 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     delete[] bufS_P2PRecv;
     bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+
+    delete[] bufF_P2PSend;
+    bufF_P2PSend = new float[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+
+    delete[] bufF_P2PRecv;
+    bufF_P2PRecv = new float[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
@@ -370,6 +388,14 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
    the data and send from the neighbor ranks. ---*/
 
   SU2_OMP_MASTER
+  if (config->GetPersistent_P2P_Comms()) {
+    /*--- The buffers, counts, and sources were bound to persistent requests on first use, we only start them. ---*/
+
+    const auto& requests = GetPersistentP2P(commType, countPerPoint, val_reverse);
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) req_P2PRecv[iRecv] = requests.recv[iRecv];
+    SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+
+  } else
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
 
@@ -412,6 +438,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iRecv]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PSend[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iRecv]));
+          break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
           break;
@@ -447,6 +477,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iMessage]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iMessage]));
+          break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
           break;
@@ -465,7 +499,13 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
    send nodes become the recv nodes and vice-versa. ---*/
 
   SU2_OMP_MASTER
-  if (val_reverse) {
+  if (config->GetPersistent_P2P_Comms()) {
+    /*--- Start the persistent request of this message. ---*/
+
+    req_P2PSend[val_iSend] = GetPersistentP2P(commType, countPerPoint, val_reverse).send[val_iSend];
+    SU2_MPI::Start(&req_P2PSend[val_iSend]);
+
+  } else if (val_reverse) {
     /*--- Compute our location in the buffer using the recv data
      structure since we are reversing the comms. ---*/
 
@@ -500,6 +540,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
         break;
@@ -535,6 +579,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PSend[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
         break;
@@ -543,6 +591,83 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
   END_SU2_OMP_MASTER
 }
 
+const CGeometry::CPersistentP2P& CGeometry::GetPersistentP2P(unsigned short commType, unsigned short countPerPoint,
+                                                             bool reverse) const {
+  for (const auto& requests : persistentP2P) {
+    if (requests.commType == commType && requests.countPerPoint == countPerPoint && requests.reverse == reverse)
+      return requests;
+  }
+
+  /*--- In reverse comms the send data structures describe the recvs and vice-versa, as in PostP2PRecvs/Sends. ---*/
+
+  const int* nPointRecv = reverse ? nPoint_P2PSend : nPoint_P2PRecv;
+  const int* nPointSend = reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+  const int* sources = reverse ? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const int* dests = reverse ? Neighbors_P2PRecv : Neighbors_P2PSend;
+
+  persistentP2P.push_back({commType, countPerPoint, reverse, {}, {}});
+  auto& requests = persistentP2P.back();
+  requests.recv.resize(nP2PRecv);
+  requests.send.resize(nP2PSend);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto offset = countPerPoint * nPointRecv[iRecv];
+    const auto count = countPerPoint * (nPointRecv[iRecv + 1] - nPointRecv[iRecv]);
+    const auto source = sources[iRecv];
+
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        SU2_MPI::Recv_init(&((reverse ? bufD_P2PSend : bufD_P2PRecv)[offset]), count, MPI_DOUBLE, source, source + 1,
+                           SU2_MPI::GetComm(), &requests.recv[iRecv]);
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        SU2_MPI::Recv_init(&((reverse ? bufS_P2PSend : bufS_P2PRecv)[offset]), count, MPI_UNSIGNED_SHORT, source,
+                           source + 1, SU2_MPI::GetComm(), &requests.recv[iRecv]);
+        break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Recv_init(&((reverse ? bufF_P2PSend : bufF_P2PRecv)[offset]), count, MPI_FLOAT, source, source + 1,
+                           SU2_MPI::GetComm(), &requests.recv[iRecv]);
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const auto offset = countPerPoint * nPointSend[iSend];
+    const auto count = countPerPoint * (nPointSend[iSend + 1] - nPointSend[iSend]);
+    const auto dest = dests[iSend];
+
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        SU2_MPI::Send_init(&((reverse ? bufD_P2PRecv : bufD_P2PSend)[offset]), count, MPI_DOUBLE, dest, rank + 1,
+                           SU2_MPI::GetComm(), &requests.send[iSend]);
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        SU2_MPI::Send_init(&((reverse ? bufS_P2PRecv : bufS_P2PSend)[offset]), count, MPI_UNSIGNED_SHORT, dest,
+                           rank + 1, SU2_MPI::GetComm(), &requests.send[iSend]);
+        break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Send_init(&((reverse ? bufF_P2PRecv : bufF_P2PSend)[offset]), count, MPI_FLOAT, dest, rank + 1,
+                           SU2_MPI::GetComm(), &requests.send[iSend]);
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+  return requests;
+}
+
+void CGeometry::FreePersistentP2P() const {
+  for (auto& requests : persistentP2P) {
+    for (auto& request : requests.recv) SU2_MPI::Request_free(&request);
+    for (auto& request : requests.send) SU2_MPI::Request_free(&request);
+  }
+  persistentP2P.clear();
+}
+
 void CGeometry::GetCommCountAndType(const CConfig* config, MPI_QUANTITIES commType, unsigned short& COUNT_PER_POINT,
                                     unsigned short& MPI_TYPE) const {
   switch (commType) {
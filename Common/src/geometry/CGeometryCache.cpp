@@ -0,0 +1,212 @@
+/*!
+ * \file CGeometryCache.cpp
+ * \brief Implementation of the cache of the geometry preprocessing.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CGeometryCache.hpp"
+#include "../../include/geometry/CPartitionCosts.hpp"
+#include "../../include/toolboxes/CLinearPartitioner.hpp"
+
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+
+namespace {
+/*--- The key and the header are 64-bit on all platforms (unsigned long is 32-bit on LLP64). ---*/
+constexpr uint64_t CACHE_MAGIC = UINT64_C(0x5355324743414348);  // "SU2GCACH"
+constexpr uint64_t CACHE_VERSION = 2;
+constexpr uint64_t HASH_SEED = UINT64_C(14695981039346656037);
+constexpr uint64_t HASH_PRIME = UINT64_C(1099511628211);
+
+/*--- Helpers to (de)serialize arrays of trivial types. ---*/
+
+template <class T>
+void WriteArray(ofstream& file, const vector<T>& data) {
+  const unsigned long n = data.size();
+  file.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  file.write(reinterpret_cast<const char*>(data.data()), n * sizeof(T));
+}
+
+template <class T>
+bool ReadArray(ifstream& file, vector<T>& data) {
+  unsigned long n = 0;
+  if (!file.read(reinterpret_cast<char*>(&n), sizeof(n))) return false;
+  data.resize(n);
+  return static_cast<bool>(file.read(reinterpret_cast<char*>(data.data()), n * sizeof(T)));
+}
+}  // namespace
+
+CGeometryCache::CGeometryCache(const CConfig* config, bool usesFile)
+    : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()), persistent(usesFile) {
+  if (!persistent) return;
+
+  /*--- The key combines the mesh contents with everything else that changes the cached results. ---*/
+
+  HashMeshFile(config->GetMesh_FileName());
+
+  Mix(size);
+  Mix(config->GetiZone());
+  Mix(config->GetiInst());
+  Mix(config->GetMesh_FileFormat());
+  Mix(config->GetMultizone_Mesh());
+  Mix(config->GetActDisk_DoubleSurface());
+
+  /*--- The partitioning depends on the weights, which may have been measured by a previous run. ---*/
+
+  const CPartitionCosts costs(config);
+  for (const passivedouble value : {config->GetParMETIS_Tolerance(), costs.point, costs.neighbor, costs.wall}) {
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(value));
+    Mix(bits);
+  }
+  Mix(config->GetParMETIS_MultiConstraint());
+
+  /*--- The ordering, and thus the agglomeration, depend on the type of reordering. ---*/
+
+  Mix(static_cast<uint64_t>(config->GetKind_PointOrdering()));
+
+  /*--- The agglomeration depends on the type of boundary condition of each marker. ---*/
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_CfgFile(); ++iMarker) {
+    const auto tag = config->GetMarker_CfgFile_TagBound(iMarker);
+    for (const auto c : tag) Mix(c);
+    Mix(config->GetMarker_CfgFile_KindBC(tag));
+  }
+
+  char hex[17];
+  SPRINTF(hex, "%016" PRIx64, key);
+  fileName = config->GetGeometry_Cache_FileName() + "_" + hex + "_" + to_string(size) + "_" + to_string(rank) + ".dat";
+
+  /*--- Use the cache only if all ranks have it. ---*/
+
+  int found = Read(), allFound = 0;
+  SU2_MPI::Allreduce(&found, &allFound, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  loaded = allFound;
+
+  if (!loaded) {
+    partition.clear();
+    ordering.clear();
+    agglomeration.clear();
+  }
+  if (rank == MASTER_NODE) {
+    if (loaded) cout << "Replaying the geometry preprocessing from the cache (" << hex << ")." << endl;
+    else cout << "No geometry cache found, it will be written after the preprocessing (" << hex << ")." << endl;
+  }
+}
+
+void CGeometryCache::ImposePartition(vector<unsigned long> colors) {
+  partition = std::move(colors);
+  ordering.clear();
+  agglomeration.clear();
+  loaded = false;
+  imposed = true;
+  modified = true;
+}
+
+void CGeometryCache::Mix(uint64_t value) { key = (key ^ value) * HASH_PRIME; }
+
+void CGeometryCache::HashMeshFile(const string& meshFileName) {
+  ifstream file(meshFileName, ios::binary | ios::ate);
+  if (!file) {
+    SU2_MPI::Error("The geometry cache requires a mesh file, " + meshFileName + " was not found.", CURRENT_FUNCTION);
+  }
+  const unsigned long fileSize = file.tellg();
+
+  /*--- Each rank hashes a slice of the file 8 bytes at a time, the hashes of the slices are then combined. ---*/
+
+  CLinearPartitioner bytePartitioner(fileSize, 0);
+  auto remaining = bytePartitioner.GetSizeOnRank(rank);
+  file.seekg(bytePartitioner.GetFirstIndexOnRank(rank));
+
+  uint64_t hash = HASH_SEED;
+  vector<uint64_t> block(1ul << 19);
+
+  while (remaining > 0) {
+    const auto nBytes = min<unsigned long>(remaining, block.size() * sizeof(uint64_t));
+    const auto nWords = (nBytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    block[nWords - 1] = 0;  // zero padding of a partial last word
+    file.read(reinterpret_cast<char*>(block.data()), nBytes);
+    for (auto i = 0ul; i < nWords; ++i) hash = (hash ^ block[i]) * HASH_PRIME;
+    remaining -= nBytes;
+  }
+
+  /*--- Gathered as bytes, there is no 64-bit integer type in the serial MPI stubs. ---*/
+  vector<uint64_t> hashes(size);
+  CBaseMPIWrapper::Allgather(&hash, sizeof(hash), MPI_CHAR, hashes.data(), sizeof(hash), MPI_CHAR,
+                             SU2_MPI::GetComm());
+
+  key = HASH_SEED;
+  Mix(fileSize);
+  for (const auto h : hashes) Mix(h);
+}
+
+bool CGeometryCache::Read() {
+  ifstream file(fileName, ios::binary);
+  if (!file) return false;
+
+  uint64_t header[5] = {};
+  if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+  if (header[0] != CACHE_MAGIC || header[1] != CACHE_VERSION || header[2] != key ||
+      header[3] != static_cast<uint64_t>(size) || header[4] != static_cast<uint64_t>(rank)) {
+    return false;
+  }
+  if (!ReadArray(file, partition) || !ReadArray(file, ordering)) return false;
+
+  unsigned long nLevels = 0;
+  if (!file.read(reinterpret_cast<char*>(&nLevels), sizeof(nLevels))) return false;
+  agglomeration.resize(nLevels);
+
+  for (auto& level : agglomeration) {
+    if (!file.read(reinterpret_cast<char*>(&level.nPointFine), sizeof(level.nPointFine))) return false;
+    if (!ReadArray(file, level.childrenPtr) || !ReadArray(file, level.children) || !ReadArray(file, level.indirect))
+      return false;
+  }
+  return true;
+}
+
+void CGeometryCache::Write() const {
+  if (!modified || !persistent) return;
+
+  ofstream file(fileName, ios::binary);
+  if (!file) {
+    SU2_MPI::Error("Could not write the geometry cache file " + fileName, CURRENT_FUNCTION);
+  }
+  const uint64_t header[5] = {CACHE_MAGIC, CACHE_VERSION, key, static_cast<uint64_t>(size),
+                              static_cast<uint64_t>(rank)};
+  file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  WriteArray(file, partition);
+  WriteArray(file, ordering);
+
+  const unsigned long nLevels = agglomeration.size();
+  file.write(reinterpret_cast<const char*>(&nLevels), sizeof(nLevels));
+
+  for (const auto& level : agglomeration) {
+    file.write(reinterpret_cast<const char*>(&level.nPointFine), sizeof(level.nPointFine));
+    WriteArray(file, level.childrenPtr);
+    WriteArray(file, level.children);
+    WriteArray(file, level.indirect);
+  }
+  if (rank == MASTER_NODE) cout << "Geometry cache written (" << fileName << " on the master rank)." << endl;
+}
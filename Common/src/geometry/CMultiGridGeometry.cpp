@@ -30,7 +30,9 @@
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
-CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, unsigned short iMesh) : CGeometry() {
+CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, unsigned short iMesh,
+                                       CGeometryCache* cache)
+    : CGeometry() {
   nDim = fine_grid->GetnDim();  // Write the number of dimensions of the coarse grid.
 
   /*--- Create a queue system to do the agglomeration
@@ -58,13 +60,165 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
     }
   }
 
-  /*--- Create the coarse grid structure using as baseline the fine grid ---*/
+  /*--- Create the coarse grid structure using as baseline the fine grid,
+   the domain points are agglomerated, or the cached agglomeration is replayed. ---*/
+
+  nodes = new CPoint(fine_grid->GetnPoint(), nDim, iMesh, config);
+
+  const auto* cached = cache ? cache->GetAgglomeration(iMesh) : nullptr;
+
+  if (cached) {
+    ReplayAgglomeration(*cached, fine_grid);
+  } else {
+    AgglomerateDomain(fine_grid, config);
+    if (cache) cache->SetAgglomeration(iMesh, RecordAgglomeration(fine_grid));
+  }
+  unsigned long Index_CoarseCV = nPointDomain;
+
+#ifdef HAVE_MPI
+  /*--- Dealing with MPI parallelization, the objective is that the received nodes must be agglomerated
+   in the same way as the donor (send) nodes. Send the node agglomeration information of the donor
+   (parent and children). The agglomerated halos of this rank are set according to the rank where
+   they are domain points. ---*/
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) && (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      const auto MarkerS = iMarker;
+      const auto MarkerR = iMarker + 1;
+
+      const auto send_to = config->GetMarker_All_SendRecv(MarkerS) - 1;
+      const auto receive_from = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
+
+      const auto nVertexS = fine_grid->nVertex[MarkerS];
+      const auto nVertexR = fine_grid->nVertex[MarkerR];
+
+      /*--- Allocate Receive and Send buffers  ---*/
+
+      vector<unsigned long> Buffer_Receive_Children(nVertexR);
+      vector<unsigned long> Buffer_Send_Children(nVertexS);
+
+      vector<unsigned long> Buffer_Receive_Parent(nVertexR);
+      vector<unsigned long> Buffer_Send_Parent(nVertexS);
+
+      /*--- Copy the information that should be sent, child and parent indices. ---*/
+
+      for (auto iVertex = 0ul; iVertex < nVertexS; iVertex++) {
+        const auto iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+        Buffer_Send_Children[iVertex] = iPoint;
+        Buffer_Send_Parent[iVertex] = fine_grid->nodes->GetParent_CV(iPoint);
+      }
+
+      /*--- Send/Receive information. ---*/
+
+      SU2_MPI::Sendrecv(Buffer_Send_Children.data(), nVertexS, MPI_UNSIGNED_LONG, send_to, 0,
+                        Buffer_Receive_Children.data(), nVertexR, MPI_UNSIGNED_LONG, receive_from, 0,
+                        SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+      SU2_MPI::Sendrecv(Buffer_Send_Parent.data(), nVertexS, MPI_UNSIGNED_LONG, send_to, 1,
+                        Buffer_Receive_Parent.data(), nVertexR, MPI_UNSIGNED_LONG, receive_from, 1, SU2_MPI::GetComm(),
+                        MPI_STATUS_IGNORE);
+
+      /*--- Create a list of the parent nodes without duplicates. ---*/
+
+      auto Aux_Parent = Buffer_Receive_Parent;
+
+      sort(Aux_Parent.begin(), Aux_Parent.end());
+      auto it1 = unique(Aux_Parent.begin(), Aux_Parent.end());
+      Aux_Parent.resize(it1 - Aux_Parent.begin());
+
+      /*--- Create the local and remote vector for the parents and children CVs. ---*/
+
+      const auto& Parent_Remote = Buffer_Receive_Parent;
+      vector<unsigned long> Parent_Local(nVertexR);
+      vector<unsigned long> Children_Local(nVertexR);
+
+      for (auto iVertex = 0ul; iVertex < nVertexR; iVertex++) {
+        /*--- We use the same sorting as in the donor domain, i.e. the local parents
+         are numbered according to their order in the remote rank. ---*/
+
+        for (auto jVertex = 0ul; jVertex < Aux_Parent.size(); jVertex++) {
+          if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
+            Parent_Local[iVertex] = jVertex + Index_CoarseCV;
+            break;
+          }
+        }
+        Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
+      }
+
+      Index_CoarseCV += Aux_Parent.size();
+
+      vector<unsigned short> nChildren_MPI(Index_CoarseCV, 0);
+
+      /*--- Create the final structure ---*/
+      for (auto iVertex = 0ul; iVertex < nVertexR; iVertex++) {
+        const auto iPoint_Coarse = Parent_Local[iVertex];
+        const auto iPoint_Fine = Children_Local[iVertex];
+
+        /*--- Be careful, it is possible that a node changes the agglomeration configuration,
+         the priority is always when receiving the information. ---*/
+        fine_grid->nodes->SetParent_CV(iPoint_Fine, iPoint_Coarse);
+        nodes->SetChildren_CV(iPoint_Coarse, nChildren_MPI[iPoint_Coarse], iPoint_Fine);
+        nChildren_MPI[iPoint_Coarse]++;
+        nodes->SetnChildren_CV(iPoint_Coarse, nChildren_MPI[iPoint_Coarse]);
+        nodes->SetDomain(iPoint_Coarse, false);
+      }
+    }
+  }
+#endif  // HAVE_MPI
+
+  /*--- Update the number of points after the MPI agglomeration ---*/
+
+  nPoint = Index_CoarseCV;
+
+  /*--- Console output with the summary of the agglomeration ---*/
+
+  unsigned long nPointFine = fine_grid->GetnPoint();
+  unsigned long Global_nPointCoarse, Global_nPointFine;
+
+  SU2_MPI::Allreduce(&nPoint, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  SetGlobal_nPointDomain(Global_nPointCoarse);
+
+  if (iMesh != MESH_0) {
+    const su2double factor = 1.5;
+    const su2double Coeff = pow(su2double(Global_nPointFine) / Global_nPointCoarse, 1.0 / nDim);
+    const su2double CFL = factor * config->GetCFL(iMesh - 1) / Coeff;
+    config->SetCFL(iMesh, CFL);
+  }
+
+  const su2double ratio = su2double(Global_nPointFine) / su2double(Global_nPointCoarse);
+
+  if (((nDim == 2) && (ratio < 2.5)) || ((nDim == 3) && (ratio < 2.5))) {
+    config->SetMGLevels(iMesh - 1);
+  } else if (rank == MASTER_NODE) {
+    PrintingToolbox::CTablePrinter MGTable(&std::cout);
+    MGTable.AddColumn("MG Level", 10);
+    MGTable.AddColumn("CVs", 10);
+    MGTable.AddColumn("Aggl. Rate", 10);
+    MGTable.AddColumn("CFL", 10);
+    MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+    if (iMesh == MESH_1) {
+      MGTable.PrintHeader();
+      MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh - 1);
+    }
+    stringstream ss;
+    ss << "1/" << std::setprecision(3) << ratio;
+    MGTable << iMesh << Global_nPointCoarse << ss.str() << config->GetCFL(iMesh);
+    if (iMesh == config->GetnMGLevels()) {
+      MGTable.PrintFooter();
+    }
+  }
+
+  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+}
+
+void CMultiGridGeometry::AgglomerateDomain(CGeometry* fine_grid, const CConfig* config) {
+  /*--- Priority queue of the fine grid points for the agglomeration of the interior. ---*/
 
   CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
   vector<unsigned long> Suitable_Indirect_Neighbors;
 
-  nodes = new CPoint(fine_grid->GetnPoint(), nDim, iMesh, config);
-
   unsigned long Index_CoarseCV = 0;
 
   /*--- The first step is the boundary agglomeration. ---*/
@@ -367,143 +521,42 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
   /*--- Reset the neighbor information. ---*/
 
   nodes->ResetPoints();
+}
 
-#ifdef HAVE_MPI
-  /*--- Dealing with MPI parallelization, the objective is that the received nodes must be agglomerated
-   in the same way as the donor (send) nodes. Send the node agglomeration information of the donor
-   (parent and children). The agglomerated halos of this rank are set according to the rank where
-   they are domain points. ---*/
-
-  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) && (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      const auto MarkerS = iMarker;
-      const auto MarkerR = iMarker + 1;
-
-      const auto send_to = config->GetMarker_All_SendRecv(MarkerS) - 1;
-      const auto receive_from = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
-
-      const auto nVertexS = fine_grid->nVertex[MarkerS];
-      const auto nVertexR = fine_grid->nVertex[MarkerR];
-
-      /*--- Allocate Receive and Send buffers  ---*/
-
-      vector<unsigned long> Buffer_Receive_Children(nVertexR);
-      vector<unsigned long> Buffer_Send_Children(nVertexS);
-
-      vector<unsigned long> Buffer_Receive_Parent(nVertexR);
-      vector<unsigned long> Buffer_Send_Parent(nVertexS);
-
-      /*--- Copy the information that should be sent, child and parent indices. ---*/
-
-      for (auto iVertex = 0ul; iVertex < nVertexS; iVertex++) {
-        const auto iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Children[iVertex] = iPoint;
-        Buffer_Send_Parent[iVertex] = fine_grid->nodes->GetParent_CV(iPoint);
-      }
-
-      /*--- Send/Receive information. ---*/
-
-      SU2_MPI::Sendrecv(Buffer_Send_Children.data(), nVertexS, MPI_UNSIGNED_LONG, send_to, 0,
-                        Buffer_Receive_Children.data(), nVertexR, MPI_UNSIGNED_LONG, receive_from, 0,
-                        SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-      SU2_MPI::Sendrecv(Buffer_Send_Parent.data(), nVertexS, MPI_UNSIGNED_LONG, send_to, 1,
-                        Buffer_Receive_Parent.data(), nVertexR, MPI_UNSIGNED_LONG, receive_from, 1, SU2_MPI::GetComm(),
-                        MPI_STATUS_IGNORE);
-
-      /*--- Create a list of the parent nodes without duplicates. ---*/
-
-      auto Aux_Parent = Buffer_Receive_Parent;
-
-      sort(Aux_Parent.begin(), Aux_Parent.end());
-      auto it1 = unique(Aux_Parent.begin(), Aux_Parent.end());
-      Aux_Parent.resize(it1 - Aux_Parent.begin());
-
-      /*--- Create the local and remote vector for the parents and children CVs. ---*/
-
-      const auto& Parent_Remote = Buffer_Receive_Parent;
-      vector<unsigned long> Parent_Local(nVertexR);
-      vector<unsigned long> Children_Local(nVertexR);
-
-      for (auto iVertex = 0ul; iVertex < nVertexR; iVertex++) {
-        /*--- We use the same sorting as in the donor domain, i.e. the local parents
-         are numbered according to their order in the remote rank. ---*/
-
-        for (auto jVertex = 0ul; jVertex < Aux_Parent.size(); jVertex++) {
-          if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
-            Parent_Local[iVertex] = jVertex + Index_CoarseCV;
-            break;
-          }
-        }
-        Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
-      }
-
-      Index_CoarseCV += Aux_Parent.size();
-
-      vector<unsigned short> nChildren_MPI(Index_CoarseCV, 0);
-
-      /*--- Create the final structure ---*/
-      for (auto iVertex = 0ul; iVertex < nVertexR; iVertex++) {
-        const auto iPoint_Coarse = Parent_Local[iVertex];
-        const auto iPoint_Fine = Children_Local[iVertex];
-
-        /*--- Be careful, it is possible that a node changes the agglomeration configuration,
-         the priority is always when receiving the information. ---*/
-        fine_grid->nodes->SetParent_CV(iPoint_Fine, iPoint_Coarse);
-        nodes->SetChildren_CV(iPoint_Coarse, nChildren_MPI[iPoint_Coarse], iPoint_Fine);
-        nChildren_MPI[iPoint_Coarse]++;
-        nodes->SetnChildren_CV(iPoint_Coarse, nChildren_MPI[iPoint_Coarse]);
-        nodes->SetDomain(iPoint_Coarse, false);
-      }
-    }
+void CMultiGridGeometry::ReplayAgglomeration(const CGeometryCache::Agglomeration& data, CGeometry* fine_grid) {
+  if (data.nPointFine != fine_grid->GetnPoint() || data.childrenPtr.empty()) {
+    SU2_MPI::Error("The geometry cache does not match the mesh, please delete it.", CURRENT_FUNCTION);
   }
-#endif  // HAVE_MPI
-
-  /*--- Update the number of points after the MPI agglomeration ---*/
-
-  nPoint = Index_CoarseCV;
-
-  /*--- Console output with the summary of the agglomeration ---*/
-
-  unsigned long nPointFine = fine_grid->GetnPoint();
-  unsigned long Global_nPointCoarse, Global_nPointFine;
-
-  SU2_MPI::Allreduce(&nPoint, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-  SU2_MPI::Allreduce(&nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
-
-  SetGlobal_nPointDomain(Global_nPointCoarse);
+  nPointDomain = data.childrenPtr.size() - 1;
+  nPoint = nPointDomain;
 
-  if (iMesh != MESH_0) {
-    const su2double factor = 1.5;
-    const su2double Coeff = pow(su2double(Global_nPointFine) / Global_nPointCoarse, 1.0 / nDim);
-    const su2double CFL = factor * config->GetCFL(iMesh - 1) / Coeff;
-    config->SetCFL(iMesh, CFL);
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPointDomain; iCoarsePoint++) {
+    unsigned short nChildren = 0;
+    for (auto k = data.childrenPtr[iCoarsePoint]; k < data.childrenPtr[iCoarsePoint + 1]; ++k) {
+      fine_grid->nodes->SetParent_CV(data.children[k], iCoarsePoint);
+      nodes->SetChildren_CV(iCoarsePoint, nChildren, data.children[k]);
+      nChildren++;
+    }
+    nodes->SetnChildren_CV(iCoarsePoint, nChildren);
+    nodes->SetAgglomerate_Indirect(iCoarsePoint, data.indirect[iCoarsePoint]);
   }
+}
 
-  const su2double ratio = su2double(Global_nPointFine) / su2double(Global_nPointCoarse);
+CGeometryCache::Agglomeration CMultiGridGeometry::RecordAgglomeration(const CGeometry* fine_grid) const {
+  CGeometryCache::Agglomeration data;
+  data.nPointFine = fine_grid->GetnPoint();
+  data.childrenPtr.reserve(nPointDomain + 1);
+  data.childrenPtr.push_back(0);
+  data.indirect.resize(nPointDomain);
 
-  if (((nDim == 2) && (ratio < 2.5)) || ((nDim == 3) && (ratio < 2.5))) {
-    config->SetMGLevels(iMesh - 1);
-  } else if (rank == MASTER_NODE) {
-    PrintingToolbox::CTablePrinter MGTable(&std::cout);
-    MGTable.AddColumn("MG Level", 10);
-    MGTable.AddColumn("CVs", 10);
-    MGTable.AddColumn("Aggl. Rate", 10);
-    MGTable.AddColumn("CFL", 10);
-    MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
-
-    if (iMesh == MESH_1) {
-      MGTable.PrintHeader();
-      MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh - 1);
-    }
-    stringstream ss;
-    ss << "1/" << std::setprecision(3) << ratio;
-    MGTable << iMesh << Global_nPointCoarse << ss.str() << config->GetCFL(iMesh);
-    if (iMesh == config->GetnMGLevels()) {
-      MGTable.PrintFooter();
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPointDomain; iCoarsePoint++) {
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      data.children.push_back(nodes->GetChildren_CV(iCoarsePoint, iChildren));
     }
+    data.childrenPtr.push_back(data.children.size());
+    data.indirect[iCoarsePoint] = nodes->GetAgglomerate_Indirect(iCoarsePoint);
   }
-
-  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  return data;
 }
 
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, const CGeometry* fine_grid,
@@ -0,0 +1,104 @@
+/*!
+ * \file CPartitionCosts.cpp
+ * \brief Implementation of the cost model of the graph partitioning.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CPartitionCosts.hpp"
+
+#include <fstream>
+#include <iomanip>
+
+namespace {
+/*--- Keys of the calibration file, in the order of COST_TYPE. ---*/
+const string COST_KEYS[CPartitionCosts::N_COST_TYPES] = {"POINT=", "NEIGHBOR=", "WALL="};
+}  // namespace
+
+string CPartitionCosts::FileName(const CConfig* config) {
+  return config->GetMultizone_FileName(config->GetParMETIS_Calibration_FileName(), config->GetiZone(), ".dat");
+}
+
+CPartitionCosts::CPartitionCosts(const CConfig* config)
+    : point(config->GetParMETIS_PointWeight()),
+      neighbor(config->GetParMETIS_EdgeWeight()),
+      wall(config->GetParMETIS_WallWeight()) {
+  if (!config->GetParMETIS_Calibration()) return;
+
+  /*--- The master reads the measured costs, the last entry flags whether they were found. ---*/
+
+  passivedouble costs[N_COST_TYPES + 1] = {0.0};
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    ifstream file(FileName(config));
+    string key;
+    passivedouble value;
+    while (file >> key) {
+      if (key[0] == '%') {
+        getline(file, key);
+        continue;
+      }
+      if (!(file >> value)) break;
+      for (int iCost = 0; iCost < N_COST_TYPES; ++iCost) {
+        if (key == COST_KEYS[iCost]) costs[iCost] = value;
+      }
+    }
+    costs[N_COST_TYPES] = file.eof() && costs[NEIGHBOR_COST] > 0.0;
+  }
+  CBaseMPIWrapper::Bcast(costs, N_COST_TYPES + 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (costs[N_COST_TYPES] == 0.0) return;
+
+  const passivedouble scale = 1.0 / costs[NEIGHBOR_COST];
+  point = scale * costs[POINT_COST];
+  neighbor = 1.0;
+  wall = scale * costs[WALL_COST];
+  calibrated = true;
+}
+
+passivedouble CPartitionCosts::IntegerScale(passivedouble totalWeight, passivedouble maxTotal) const {
+  const passivedouble unit = (neighbor > 0.0) ? neighbor : max(point, wall);
+  passivedouble scale = (unit > 0.0) ? WEIGHT_BASE / unit : 1.0;
+  if (totalWeight * scale > maxTotal) scale = maxTotal / totalWeight;
+  return scale;
+}
+
+void CPartitionCosts::WriteCalibration(const CConfig* config, const array<passivedouble, N_COST_TYPES>& time,
+                                       const array<unsigned long, N_COST_TYPES>& count) {
+  array<passivedouble, N_COST_TYPES> totalTime;
+  array<unsigned long, N_COST_TYPES> totalCount;
+  CBaseMPIWrapper::Allreduce(time.data(), totalTime.data(), N_COST_TYPES, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(count.data(), totalCount.data(), N_COST_TYPES, MPI_UNSIGNED_LONG, MPI_SUM,
+                     SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() != MASTER_NODE || totalCount[NEIGHBOR_COST] == 0) return;
+
+  ofstream file(FileName(config));
+  file << "% Costs (seconds per item) measured by the last run, used to weight the graph partitioning.\n";
+  file << setprecision(8) << scientific;
+  for (int iCost = 0; iCost < N_COST_TYPES; ++iCost) {
+    const auto cost = totalCount[iCost] ? totalTime[iCost] / totalCount[iCost] : 0.0;
+    file << COST_KEYS[iCost] << " " << cost << "\n";
+  }
+  cout << "Partitioning costs written to " << FileName(config) << "." << endl;
+}
@@ -26,12 +26,15 @@
  */
 
 #include "../../include/geometry/CPhysicalGeometry.hpp"
+#include "../../include/geometry/CGeometryCache.hpp"
+#include "../../include/geometry/CPartitionCosts.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
@@ -95,6 +98,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
   } else {
     switch (val_format) {
       case SU2:
+      case SU2_BINARY:
       case CGNS_GRID:
       case RECTANGLE:
       case BOX:
@@ -3469,6 +3473,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
     case SU2:
       MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
       break;
@@ -3534,10 +3541,6 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
 }
 
 void CPhysicalGeometry::LoadLinearlyPartitionedPoints(CConfig* config, CMeshReaderFVM* mesh) {
-  /*--- Get the linearly partitioned coordinates from the mesh object. ---*/
-
-  const auto& gridCoords = mesh->GetLocalPointCoordinates();
-
   /*--- Initialize point counts and the grid node data structure. ---*/
 
   nodes = new CPoint(nPoint, nDim);
@@ -3545,15 +3548,17 @@ void CPhysicalGeometry::LoadLinearlyPartitionedPoints(CConfig* config, CMeshRead
   /*--- Loop over the CGNS grid nodes and load into the SU2 data
    structure. Note that since we have performed a linear partitioning
    of the grid nodes, we can simply initialize the global index to
-   the first node that lies on our rank and increment. ---*/
+   the first node that lies on our rank and increment. The points are
+   streamed from the mesh object, which releases them as they are
+   consumed (or parses them on demand). ---*/
 
   CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
-  unsigned long GlobalIndex = pointPartitioner.GetFirstIndexOnRank(rank);
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-    for (unsigned short iDim = 0; iDim < nDim; ++iDim) nodes->SetCoord(iPoint, iDim, gridCoords[iDim][iPoint]);
-    nodes->SetGlobalIndex(iPoint, GlobalIndex);
-    ++GlobalIndex;
-  }
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  mesh->StreamLocalPoints([&](unsigned long iPoint, const passivedouble* coords) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) nodes->SetCoord(iPoint, iDim, coords[iDim]);
+    nodes->SetGlobalIndex(iPoint, firstIndex + iPoint);
+  });
 }
 
 void CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements(CConfig* config, CMeshReaderFVM* mesh) {
@@ -3561,34 +3566,31 @@ void CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements(CConfig* config, C
 
   Global_to_Local_Elem.clear();
 
-  /*--- Get the volume connectivity from the mesh object. ---*/
-
-  auto& connElems = mesh->GetLocalVolumeElementConnectivity();
-
   /*--- Allocate space for the CGNS interior elements in our SU2 data
    structure. Note that we only instantiate our rank's local set. ---*/
 
   elem = new CPrimalGrid*[nElem]();
 
-  /*--- Loop over all of the internal, local volumetric elements. ---*/
+  /*--- Loop over all of the internal, local volumetric elements,
+   streamed from the mesh object as for the points. ---*/
 
-  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+  mesh->StreamLocalVolumeElements([&](unsigned long iElem, const unsigned long* connElem) {
     /*--- Get the global ID for this element. This is stored in
      the first entry of our connectivity stucture. ---*/
 
-    const auto Global_Index_Elem = connElems[iElem * SU2_CONN_SIZE + 0];
+    const auto Global_Index_Elem = connElem[0];
     Global_to_Local_Elem[Global_Index_Elem] = iElem;
 
     /*--- Get the VTK type for this element. This is stored in the
      second entry of the connectivity structure. ---*/
 
-    const auto vtk_type = static_cast<int>(connElems[iElem * SU2_CONN_SIZE + 1]);
+    const auto vtk_type = static_cast<int>(connElem[1]);
 
     /*--- Instantiate this element in the proper SU2 data structure.
      During this loop, we also set the global to local element map
      for later use and increment the element counts for all types. ---*/
 
-    auto connectivity = &connElems[iElem * SU2_CONN_SIZE + SU2_CONN_SKIP];
+    const auto connectivity = &connElem[SU2_CONN_SKIP];
 
     switch (vtk_type) {
       case TRIANGLE:
@@ -3627,7 +3629,7 @@ void CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements(CConfig* config, C
         SU2_MPI::Error("Element type not supported!", CURRENT_FUNCTION);
         break;
     }
-  }
+  });
 
   /*--- Reduce the global counts of all element types found in
    the CGNS grid with all ranks. ---*/
@@ -4463,7 +4465,7 @@ void CPhysicalGeometry::SetPoint_Connectivity() {
   END_SU2_OMP_PARALLEL
 }
 
-void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
+vector<unsigned long> CPhysicalGeometry::ComputeRCM_Ordering() const {
   /*--- The result is the RCM ordering, during the process it is also used as
    * the queue of new points considered by the algorithm. This is possible
    * because points move from the front of the queue to the back of the result,
@@ -4537,6 +4539,66 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
   for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
     Result.push_back(iPoint);
   }
+  return Result;
+}
+
+vector<unsigned long> CPhysicalGeometry::ComputeSFC_Ordering(POINT_ORDERING kind) const {
+  /*--- Bounding box of the domain points, the same scale is used in all directions to map the coordinates
+   * to the integers of the curve (64/nDim bits per coordinate). ---*/
+  passivedouble minCoord[MAXNDIM] = {0.0}, range = 0.0;
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    passivedouble minVal = numeric_limits<passivedouble>::max();
+    passivedouble maxVal = numeric_limits<passivedouble>::lowest();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      const passivedouble coord = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+      minVal = min(minVal, coord);
+      maxVal = max(maxVal, coord);
+    }
+    minCoord[iDim] = minVal;
+    range = max(range, maxVal - minVal);
+  }
+  const passivedouble maxInt = static_cast<passivedouble>((uint64_t(1) << (64 / nDim)) - 1);
+  const passivedouble scale = (range > 0.0) ? maxInt / range : 0.0;
+
+  /*--- Sort the points by their position along the curve, ties keep the current order. ---*/
+  vector<pair<uint64_t, unsigned long>> keys(nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    uint32_t intCoord[MAXNDIM] = {0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const passivedouble x = (SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - minCoord[iDim]) * scale;
+      intCoord[iDim] = static_cast<uint32_t>(min(max(x, 0.0), maxInt));
+    }
+    const auto key = (kind == POINT_ORDERING::HILBERT) ? GeometryToolbox::HilbertKey(nDim, intCoord)
+                                                        : GeometryToolbox::MortonKey(nDim, intCoord);
+    keys[iPoint] = make_pair(key, iPoint);
+  }
+  sort(keys.begin(), keys.end());
+
+  vector<unsigned long> Result;
+  Result.reserve(nPoint);
+  for (const auto& key : keys) Result.push_back(key.second);
+
+  /*--- Add the MPI points ---*/
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    Result.push_back(iPoint);
+  }
+  return Result;
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig* config, CGeometryCache* cache) {
+  /*--- Replay the ordering from the cache if possible, the search is the expensive part. ---*/
+
+  vector<unsigned long> Result;
+  if (cache && cache->IsLoaded()) {
+    Result = cache->GetOrdering();
+    if (Result.size() != nPoint) {
+      SU2_MPI::Error("The geometry cache does not match the mesh, please delete it.", CURRENT_FUNCTION);
+    }
+  } else {
+    const auto kind = config->GetKind_PointOrdering();
+    Result = (kind == POINT_ORDERING::RCM) ? ComputeRCM_Ordering() : ComputeSFC_Ordering(kind);
+    if (cache) cache->SetOrdering(Result);
+  }
 
   /*--- Reset old data structures ---*/
 
@@ -7728,7 +7790,46 @@ void CPhysicalGeometry::SetBoundTecPlot(char mesh_filename[MAX_STRING_SIZE], boo
   Tecplot_File.close();
 }
 
-void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+namespace {
+/*!
+ * \brief Largest total integer weight of the graph (with margin, ParMETIS sums the weights of the parts as idx_t).
+ */
+passivedouble MaxTotalWeight() { return 0.25 * std::numeric_limits<idx_t>::max(); }
+
+/*!
+ * \brief Report the load imbalance (max / average) of a partitioning, estimated with the weights of each constraint.
+ * \param[in] part - Part of each vertex.
+ * \param[in] vwgt - Weights of the vertices (ncon per vertex).
+ * \param[in] ncon - Number of constraints, the second one is the wall work.
+ */
+void ReportLoadImbalance(const vector<idx_t>& part, const vector<idx_t>& vwgt, idx_t ncon) {
+  const int size = SU2_MPI::GetSize();
+
+  vector<unsigned long> localLoad(size * ncon, 0), load(size * ncon);
+  for (size_t iVertex = 0; iVertex < part.size(); iVertex++) {
+    for (idx_t iCon = 0; iCon < ncon; iCon++) localLoad[part[iVertex] * ncon + iCon] += vwgt[iVertex * ncon + iCon];
+  }
+  SU2_MPI::Allreduce(localLoad.data(), load.data(), size * ncon, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    cout << "Estimated load imbalance (max/avg):";
+    for (idx_t iCon = 0; iCon < ncon; iCon++) {
+      unsigned long maxLoad = 0, totalLoad = 0;
+      for (int iPart = 0; iPart < size; iPart++) {
+        maxLoad = max(maxLoad, load[iPart * ncon + iCon]);
+        totalLoad += load[iPart * ncon + iCon];
+      }
+      const su2double imbalance = totalLoad ? su2double(maxLoad) * size / totalLoad : 1.0;
+      cout << (iCon ? ", " : " ") << imbalance << (iCon ? " (walls)" : (ncon > 1 ? " (volume)" : ""));
+    }
+    cout << "." << endl;
+  }
+}
+}  // namespace
+#endif
+
+void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config, CGeometryCache* cache) {
   /*--- We need to have parallel support with MPI and have the ParMETIS
    library compiled and linked for parallel graph partitioning. ---*/
 
@@ -7738,18 +7839,52 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 
   if (size == SINGLE_NODE) return;
 
+  /*--- Replay the partitioning from the cache if possible. ---*/
+
+  if (cache && cache->HasPartition()) {
+    const auto& colors = cache->GetPartition();
+    if (colors.size() != nPoint) {
+      SU2_MPI::Error("The geometry cache does not match the mesh, please delete it.", CURRENT_FUNCTION);
+    }
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) nodes->SetColor(iPoint, colors[iPoint]);
+
+    if (rank == MASTER_NODE) {
+      if (cache->IsImposed()) cout << "Graph partitioning imposed by the load rebalancing." << endl;
+      else cout << "Graph partitioning loaded from the geometry cache." << endl;
+    }
+
+    decltype(xadj)().swap(xadj);
+    decltype(adjacency)().swap(adjacency);
+    return;
+  }
+
   MPI_Comm comm = SU2_MPI::GetComm();
 
   /*--- Linear partitioner object to help prepare parmetis data. ---*/
 
   CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
 
+  /*--- Per point cost model, the wall work is a separate constraint if requested. ---*/
+
+  const CPartitionCosts costs(config);
+  const bool wallWeights = (costs.WallWeight(true) > 0);
+  const bool multiConstraint = wallWeights && config->GetParMETIS_MultiConstraint();
+
+  if (rank == MASTER_NODE && config->GetParMETIS_Calibration()) {
+    if (costs.calibrated) {
+      cout << "Partitioning weights from the measured costs: point " << costs.point << ", neighbor " << costs.neighbor
+           << ", wall " << costs.wall << "." << endl;
+    } else {
+      cout << "No measured partitioning costs yet, using the PARMETIS_*_WEIGHT options." << endl;
+    }
+  }
+
   /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
   idx_t wgtflag = 2;
   idx_t numflag = 0;
-  idx_t ncon = 1;
-  real_t ubvec = 1.0 + config->GetParMETIS_Tolerance();
+  idx_t ncon = multiConstraint ? 2 : 1;
+  vector<real_t> ubvec(ncon, 1.0 + config->GetParMETIS_Tolerance());
   idx_t nparts = size;
   idx_t options[METIS_NOPTIONS];
   METIS_SetDefaultOptions(options);
@@ -7757,7 +7892,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 
   /*--- Fill the necessary ParMETIS input data arrays. ---*/
 
-  vector<real_t> tpwgts(size, 1.0 / size);
+  vector<real_t> tpwgts(size * ncon, 1.0 / size);
 
   vector<idx_t> vtxdist(size + 1);
   vtxdist[0] = 0;
@@ -7765,18 +7900,60 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     vtxdist[i + 1] = pointPartitioner.GetLastIndexOnRank(i);
   }
 
+  /*--- Flag the points of this rank that are on viscous walls, the master has all the markers. ---*/
+
+  vector<char> onWall(nPoint, false);
+
+  if (wallWeights) {
+    vector<unsigned long> wallPoints;
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (!config->GetViscous_Wall(iMarker)) continue;
+      for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          wallPoints.push_back(bound[iMarker][iElem]->GetNode(iNode));
+        }
+      }
+    }
+    sort(wallPoints.begin(), wallPoints.end());
+    wallPoints.erase(unique(wallPoints.begin(), wallPoints.end()), wallPoints.end());
+
+    unsigned long nWallPoints = wallPoints.size();
+    SU2_MPI::Bcast(&nWallPoints, 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+    wallPoints.resize(nWallPoints);
+    SU2_MPI::Bcast(wallPoints.data(), nWallPoints, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+
+    const auto firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+    const auto lastPoint = pointPartitioner.GetLastIndexOnRank(rank);
+    for (const auto globalPoint : wallPoints) {
+      if (globalPoint >= firstPoint && globalPoint < lastPoint) onWall[globalPoint - firstPoint] = true;
+    }
+  }
+
   /*--- For most FVM-type operations the amount of work is proportional to the
    * number of edges, for a few however it is proportional to the number of points.
    * Therefore, for (static) load balancing we consider a weighted function of points
    * and number of edges (or neighbors) per point, giving more importance to the latter
-   * skews the partitioner towards evenly distributing the total number of edges. ---*/
+   * skews the partitioner towards evenly distributing the total number of edges.
+   * Points on viscous walls carry the extra work of the wall boundary conditions.
+   * The weights are scaled before being rounded to the integers of ParMETIS. ---*/
 
-  const auto wp = config->GetParMETIS_PointWeight();
-  const auto we = config->GetParMETIS_EdgeWeight();
+  passivedouble localWeight = 0.0, totalWeight = 0.0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    localWeight += costs.VolumeWeight(xadj[iPoint + 1] - xadj[iPoint]) + costs.WallWeight(onWall[iPoint]);
+  }
+  CBaseMPIWrapper::Allreduce(&localWeight, &totalWeight, 1, MPI_DOUBLE, MPI_SUM, comm);
+  const passivedouble scale = costs.IntegerScale(totalWeight, MaxTotalWeight());
 
-  vector<idx_t> vwgt(nPoint);
+  vector<idx_t> vwgt(nPoint * ncon);
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
-    vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
+    const idx_t volume = lround(costs.VolumeWeight(xadj[iPoint + 1] - xadj[iPoint]) * scale);
+    const idx_t wall = lround(costs.WallWeight(onWall[iPoint]) * scale);
+    if (multiConstraint) {
+      vwgt[2 * iPoint] = volume;
+      vwgt[2 * iPoint + 1] = wall;
+    } else {
+      vwgt[iPoint] = volume + wall;
+    }
   }
 
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
@@ -7789,12 +7966,14 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
   auto err =
       ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag, &numflag,
-                           &ncon, &nparts, tpwgts.data(), &ubvec, options, &edgecut, part.data(), &comm);
+                           &ncon, &nparts, tpwgts.data(), ubvec.data(), options, &edgecut, part.data(), &comm);
   if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
   if (rank == MASTER_NODE) {
     cout << " graph partitioning complete (" << edgecut << " edge cuts)." << endl;
   }
 
+  ReportLoadImbalance(part, vwgt, ncon);
+
   /*--- Store the results of the partitioning (note that this is local
    since each processor is calling ParMETIS in parallel and storing the
    results for its initial piece of the grid. ---*/
@@ -7802,6 +7981,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
+  if (cache) cache->SetPartition(vector<unsigned long>(part.begin(), part.end()));
 
   /*--- Force free the connectivity. ---*/
 
@@ -7811,6 +7991,142 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 #endif
 }
 
+vector<unsigned long> CPhysicalGeometry::ComputeRebalancedPartition(const CConfig* config, passivedouble volumeTime,
+                                                                     passivedouble wallTime) const {
+  vector<unsigned long> destination(nPointDomain, rank);
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  if (size == SINGLE_NODE) return destination;
+
+  MPI_Comm comm = SU2_MPI::GetComm();
+
+  /*--- The vertices of ParMETIS are the domain points, numbered contiguously on each rank. ---*/
+
+  vector<unsigned long> nDomain(size);
+  SU2_MPI::Allgather(&nPointDomain, 1, MPI_UNSIGNED_LONG, nDomain.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  vector<idx_t> vtxdist(size + 1, 0);
+  for (int iRank = 0; iRank < size; iRank++) vtxdist[iRank + 1] = vtxdist[iRank] + nDomain[iRank];
+
+  /*--- The halo points take the number of their owner, sent over the point-to-point pattern of the halos. ---*/
+
+  vector<unsigned long> vertexID(nPoint, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) vertexID[iPoint] = vtxdist[rank] + iPoint;
+
+  vector<unsigned long> bufSend(nPoint_P2PSend[nP2PSend]), bufRecv(nPoint_P2PRecv[nP2PRecv]);
+  vector<SU2_MPI::Request> request(nP2PSend + nP2PRecv);
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto offset = nPoint_P2PRecv[iRecv];
+    const auto source = Neighbors_P2PRecv[iRecv];
+    SU2_MPI::Irecv(&bufRecv[offset], nPoint_P2PRecv[iRecv + 1] - offset, MPI_UNSIGNED_LONG, source, source + 1, comm,
+                   &request[iRecv]);
+  }
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const auto offset = nPoint_P2PSend[iSend];
+    for (auto iMsg = offset; iMsg < nPoint_P2PSend[iSend + 1]; iMsg++) {
+      bufSend[iMsg] = vertexID[Local_Point_P2PSend[iMsg]];
+    }
+    SU2_MPI::Isend(&bufSend[offset], nPoint_P2PSend[iSend + 1] - offset, MPI_UNSIGNED_LONG, Neighbors_P2PSend[iSend],
+                   rank + 1, comm, &request[nP2PRecv + iSend]);
+  }
+  SU2_MPI::Waitall(request.size(), request.data(), MPI_STATUSES_IGNORE);
+
+  for (int iMsg = 0; iMsg < nPoint_P2PRecv[nP2PRecv]; iMsg++) vertexID[Local_Point_P2PRecv[iMsg]] = bufRecv[iMsg];
+
+  /*--- Graph of the domain points, their neighbors include the halo points. ---*/
+
+  vector<idx_t> xadj(nPointDomain + 1, 0), adjacency;
+  adjacency.reserve(nodes->GetPoints().getNumNonZeros());
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (const auto jPoint : nodes->GetPoints(iPoint)) adjacency.push_back(vertexID[jPoint]);
+    xadj[iPoint + 1] = adjacency.size();
+  }
+
+  /*--- Same cost model as the initial partitioning, with the volume and wall weights of each rank scaled by the
+   *    ratio of its measured time to its modelled cost, relative to that of all ranks. This captures costs that
+   *    vary in space and time (stiff chemistry, limiters, local time steps) at the granularity of the ranks. ---*/
+
+  const CPartitionCosts costs(config);
+  const bool wallWeights = (costs.WallWeight(true) > 0);
+  const bool multiConstraint = wallWeights && config->GetParMETIS_MultiConstraint();
+
+  /*--- Without wall weights the wall work is spread over the volume. ---*/
+  if (!wallWeights) {
+    volumeTime += wallTime;
+    wallTime = 0.0;
+  }
+
+  vector<char> onWall(nPointDomain, false);
+  for (unsigned short iMarker = 0; wallWeights && iMarker < nMarker; iMarker++) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+      if (iPoint < nPointDomain) onWall[iPoint] = true;
+    }
+  }
+
+  passivedouble local[4] = {volumeTime, wallTime, 0.0, 0.0}, total[4] = {0.0};
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    local[2] += costs.VolumeWeight(nodes->GetnPoint(iPoint));
+    local[3] += costs.WallWeight(onWall[iPoint]);
+  }
+  CBaseMPIWrapper::Allreduce(local, total, 4, MPI_DOUBLE, MPI_SUM, comm);
+
+  auto Scale = [&](int iTime, int iWeight) {
+    if (local[iTime] <= 0 || local[iWeight] <= 0 || total[iTime] <= 0) return 1.0;
+    return (local[iTime] / local[iWeight]) / (total[iTime] / total[iWeight]);
+  };
+  const passivedouble volumeScale = Scale(0, 2), wallScale = Scale(1, 3);
+
+  /*--- The scaled weights of all ranks add up to the same total as the modelled ones. ---*/
+  const passivedouble scale = costs.IntegerScale(total[2] + total[3], MaxTotalWeight());
+
+  idx_t ncon = multiConstraint ? 2 : 1;
+  vector<idx_t> vwgt(nPointDomain * ncon);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const idx_t volume = max(1l, lround(costs.VolumeWeight(nodes->GetnPoint(iPoint)) * volumeScale * scale));
+    const idx_t wall = lround(costs.WallWeight(onWall[iPoint]) * wallScale * scale);
+    if (multiConstraint) {
+      vwgt[2 * iPoint] = volume;
+      vwgt[2 * iPoint + 1] = wall;
+    } else {
+      vwgt[iPoint] = volume + wall;
+    }
+  }
+
+  /*--- Adaptive repartitioning starts from the current partition (one part per rank), the ratio of the
+   *    communication time of the solver to the data redistribution time favors small migrations. ---*/
+
+  idx_t wgtflag = 2;
+  idx_t numflag = 0;
+  idx_t nparts = size;
+  vector<real_t> ubvec(ncon, 1.0 + config->GetParMETIS_Tolerance());
+  vector<real_t> tpwgts(size * ncon, 1.0 / size);
+  real_t itr = 1000.0;
+  idx_t options[4] = {1, 0, 0, PARMETIS_PSR_COUPLED};
+
+  idx_t edgecut;
+  vector<idx_t> part(nPointDomain);
+
+  if (rank == MASTER_NODE) cout << "Calling ParMETIS adaptive repartitioning...";
+  auto err = ParMETIS_V3_AdaptiveRepart(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, nullptr,
+                                        &wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), &itr, options,
+                                        &edgecut, part.data(), &comm);
+  if (err != METIS_OK) SU2_MPI::Error("Repartitioning failed.", CURRENT_FUNCTION);
+  if (rank == MASTER_NODE) cout << " done (" << edgecut << " edge cuts)." << endl;
+
+  ReportLoadImbalance(part, vwgt, ncon);
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) destination[iPoint] = part[iPoint];
+
+#endif
+
+  return destination;
+}
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
    ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
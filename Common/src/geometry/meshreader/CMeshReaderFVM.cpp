@@ -30,3 +30,19 @@
 
 CMeshReaderFVM::CMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone)
     : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()), config(val_config) {}
+
+void CMeshReaderFVM::StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task) {
+  passivedouble coords[3] = {0.0, 0.0, 0.0};
+  for (auto iPoint = 0ul; iPoint < numberOfLocalPoints; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < dimension; ++iDim) coords[iDim] = localPointCoordinates[iDim][iPoint];
+    task(iPoint, coords);
+  }
+  vector<vector<passivedouble> >().swap(localPointCoordinates);
+}
+
+void CMeshReaderFVM::StreamLocalVolumeElements(const std::function<void(unsigned long, const unsigned long*)>& task) {
+  for (auto iElem = 0ul; iElem < numberOfLocalElements; ++iElem) {
+    task(iElem, &localVolumeElementConnectivity[iElem * SU2_CONN_SIZE]);
+  }
+  vector<unsigned long>().swap(localVolumeElementConnectivity);
+}
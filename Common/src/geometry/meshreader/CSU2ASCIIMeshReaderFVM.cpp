@@ -39,11 +39,24 @@ CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig* val_config, unsigned sho
                     ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
   if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
 
+  /* In single-rank runs the points and elements are not stored by the reader,
+   instead they are parsed on demand from a memory mapping of the file when the
+   geometry requests them (see StreamLocalPoints). For this, the metadata pass
+   only records where each section starts. */
+  if (size == SINGLE_NODE && !actuator_disk) {
+    mappedFile.reset(new CMemoryMappedFile(meshFilename));
+    if (!mappedFile->IsMapped()) mappedFile.reset();
+  }
+
   /* Read the basic metadata and perform some basic error checks. */
   const auto try_single_pass = !actuator_disk;
 
   if (ReadMetadata(try_single_pass, val_config)) {
-    /* The file contents were read together with the metadata. */
+    /* The file contents were read (or located) together with the metadata. */
+    if (mappedFile) {
+      numberOfLocalPoints = numberOfGlobalPoints;
+      numberOfLocalElements = numberOfGlobalElements;
+    }
     return;
   }
 
@@ -185,7 +198,9 @@ bool CSU2ASCIIMeshReaderFVM::ReadMetadata(const bool single_pass, CConfig* confi
       numberOfGlobalPoints = atoi(text_line.c_str());
 
       /* If the points were found first, read them, otherwise just consume the lines. */
-      if (single_pass && foundNDIME && current_section_idx == 0) {
+      if (mappedFile) {
+        pointsOffset = SkipSection(numberOfGlobalPoints);
+      } else if (single_pass && foundNDIME && current_section_idx == 0) {
         single_pass_active = true;
         ReadPointCoordinates(true);
       } else {
@@ -200,7 +215,9 @@ bool CSU2ASCIIMeshReaderFVM::ReadMetadata(const bool single_pass, CConfig* confi
       text_line.erase(0, 6);
       numberOfGlobalElements = atoi(text_line.c_str());
 
-      if (single_pass_active) {
+      if (mappedFile) {
+        elementsOffset = SkipSection(numberOfGlobalElements);
+      } else if (single_pass_active) {
         ReadVolumeElementConnectivity(true);
       } else {
         for (auto iElem = 0ul; iElem < numberOfGlobalElements; iElem++) getline(mesh_file, text_line);
@@ -218,7 +235,7 @@ bool CSU2ASCIIMeshReaderFVM::ReadMetadata(const bool single_pass, CConfig* confi
         SU2_MPI::Error("Markers must be listed after points and elements in the SU2 mesh file.", CURRENT_FUNCTION);
       }
 
-      if (single_pass_active) ReadSurfaceElementConnectivity(true);
+      if (single_pass_active || mappedFile) ReadSurfaceElementConnectivity(true);
 
       SectionOrder[current_section_idx++] = FileSection::MARKERS;
       foundNMARK = true;
@@ -259,7 +276,7 @@ bool CSU2ASCIIMeshReaderFVM::ReadMetadata(const bool single_pass, CConfig* confi
         CURRENT_FUNCTION);
   }
 
-  return single_pass_active;
+  return single_pass_active || mappedFile;
 }
 
 void CSU2ASCIIMeshReaderFVM::SplitActuatorDiskSurface() {
@@ -1077,3 +1094,82 @@ void CSU2ASCIIMeshReaderFVM::FastForwardToMyZone() {
     if (jZone == myZone + 1) break;
   }
 }
+
+const char* CSU2ASCIIMeshReaderFVM::NextLine(const char* position) const {
+  const char* end = mappedFile->data() + mappedFile->size();
+  const auto* newline = static_cast<const char*>(memchr(position, '\n', end - position));
+  if (!newline) {
+    SU2_MPI::Error("Unexpected end of the SU2 ASCII mesh file.", CURRENT_FUNCTION);
+  }
+  return newline + 1;
+}
+
+unsigned long CSU2ASCIIMeshReaderFVM::SkipSection(unsigned long nLines) {
+  const auto start = static_cast<unsigned long>(mesh_file.tellg());
+  const char* line = mappedFile->data() + start;
+  for (auto iLine = 0ul; iLine < nLines; ++iLine) line = NextLine(line);
+  const auto end = static_cast<unsigned long>(line - mappedFile->data());
+  mappedFile->Release(start, end);
+  mesh_file.seekg(end);
+  return start;
+}
+
+void CSU2ASCIIMeshReaderFVM::StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task) {
+  if (!mappedFile) return CMeshReaderFVM::StreamLocalPoints(task);
+
+  /*--- Parse the points straight from the mapping, the pages that were
+   consumed are released periodically to keep the memory footprint low. ---*/
+
+  const char* line = mappedFile->data() + pointsOffset;
+  auto released = pointsOffset;
+  passivedouble coords[3] = {0.0, 0.0, 0.0};
+
+  for (auto iPoint = 0ul; iPoint < numberOfGlobalPoints; ++iPoint) {
+    char* next = nullptr;
+    for (unsigned short iDim = 0; iDim < dimension; ++iDim) {
+      coords[iDim] = strtod(line, &next);
+      line = next;
+    }
+    task(iPoint, coords);
+    line = NextLine(line);
+
+    if (iPoint % 4096 == 0) {
+      const auto position = static_cast<unsigned long>(line - mappedFile->data());
+      mappedFile->Release(released, position);
+      released = position;
+    }
+  }
+}
+
+void CSU2ASCIIMeshReaderFVM::StreamLocalVolumeElements(
+    const std::function<void(unsigned long, const unsigned long*)>& task) {
+  if (!mappedFile) return CMeshReaderFVM::StreamLocalVolumeElements(task);
+
+  /*--- As for the points, all elements are local since there is one rank. ---*/
+
+  const char* line = mappedFile->data() + elementsOffset;
+  auto released = elementsOffset;
+  array<unsigned long, SU2_CONN_SIZE> connElem{};
+
+  for (auto iElem = 0ul; iElem < numberOfGlobalElements; ++iElem) {
+    char* next = nullptr;
+    connElem.fill(0);
+    connElem[0] = iElem;
+    connElem[1] = strtoul(line, &next, 10);
+    line = next;
+
+    const auto nPointsElem = nPointsOfElementType(connElem[1]);
+    for (unsigned short i = 0; i < nPointsElem; ++i) {
+      connElem[SU2_CONN_SKIP + i] = strtoul(line, &next, 10);
+      line = next;
+    }
+    task(iElem, connElem.data());
+    line = NextLine(line);
+
+    if (iElem % 4096 == 0) {
+      const auto position = static_cast<unsigned long>(line - mappedFile->data());
+      mappedFile->Release(released, position);
+      released = position;
+    }
+  }
+}
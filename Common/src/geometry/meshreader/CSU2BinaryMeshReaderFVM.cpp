@@ -0,0 +1,404 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+using namespace SU2BinaryMesh;
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(
+        "The SU2 binary mesh format stores a single zone per file.\n"
+        "Use one mesh file per zone (MULTIZONE_MESH= NO).",
+        CURRENT_FUNCTION);
+  }
+  if ((config->GetnMarker_ActDiskInlet() != 0 || config->GetnMarker_ActDiskOutlet() != 0) &&
+      !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error(
+        "Splitting actuator disk surfaces is only supported by the SU2 ASCII reader.\n"
+        "Convert a mesh with double surfaces (repeated points) instead.",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- All ranks open the file, each reads its own linear partition of the
+   points and of the elements, the master reads the markers. ---*/
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle)) {
+    SU2_MPI::Error("Error opening SU2 binary grid " + meshFilename + ".\nCheck that the file exists.",
+                   CURRENT_FUNCTION);
+  }
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  if (!fileHandle) {
+    SU2_MPI::Error("Error opening SU2 binary grid " + meshFilename + ".\nCheck that the file exists.",
+                   CURRENT_FUNCTION);
+  }
+#endif
+
+  ReadHeader();
+
+  /*--- In single-rank runs the points and elements are not stored by the reader,
+   they are read on demand from a memory mapping of the file when the geometry
+   requests them (see StreamLocalPoints). ---*/
+
+  if (size == SINGLE_NODE) {
+    mappedFile.reset(new CMemoryMappedFile(meshFilename));
+    if (!mappedFile->IsMapped()) mappedFile.reset();
+  }
+
+  if (mappedFile) {
+    const auto pointsEnd = HEADER_SIZE * sizeof(int64_t) + numberOfGlobalPoints * dimension * sizeof(passivedouble);
+    const auto elemsEnd = header[ELEM_OFFSET] + numberOfGlobalElements * ELEM_RECORD_SIZE * sizeof(int64_t);
+    if (std::max<unsigned long>(pointsEnd, elemsEnd) > mappedFile->size()) {
+      SU2_MPI::Error("Error reading SU2 binary grid " + meshFilename + ", the file may be truncated.",
+                     CURRENT_FUNCTION);
+    }
+    numberOfLocalPoints = numberOfGlobalPoints;
+    numberOfLocalElements = numberOfGlobalElements;
+  } else {
+    ReadPointCoordinates();
+    ReadVolumeElementConnectivity();
+  }
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+}
+
+void CSU2BinaryMeshReaderFVM::ReadAt(unsigned long offset, unsigned long nBytes, void* buffer) {
+  /*--- Large blocks are read in chunks since the counts of MPI are int. ---*/
+  constexpr unsigned long maxChunk = 1ul << 30;
+  auto* bytes = static_cast<char*>(buffer);
+  bool ok = true;
+
+  for (unsigned long done = 0; done < nBytes; done += maxChunk) {
+    const auto chunk = std::min(maxChunk, nBytes - done);
+#ifdef HAVE_MPI
+    SU2_MPI::Status status;
+    int count = 0;
+    ok &= (MPI_File_read_at(fileHandle, MPI_Offset(offset + done), bytes + done, int(chunk), MPI_BYTE, &status) ==
+           MPI_SUCCESS);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    ok &= (static_cast<unsigned long>(count) == chunk);
+#else
+    /*--- 64-bit offsets (long is 32-bit on Windows). ---*/
+#ifdef _WIN32
+    ok &= (_fseeki64(fileHandle, static_cast<int64_t>(offset + done), SEEK_SET) == 0);
+#else
+    ok &= (fseeko(fileHandle, static_cast<off_t>(offset + done), SEEK_SET) == 0);
+#endif
+    ok &= (fread(bytes + done, 1, chunk, fileHandle) == chunk);
+#endif
+  }
+  if (!ok) {
+    SU2_MPI::Error("Error reading SU2 binary grid " + meshFilename + ", the file may be truncated.",
+                   CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadHeader() {
+  /*--- The header is tiny, every rank reads it to avoid a broadcast. ---*/
+
+  ReadAt(0, sizeof(header), header);
+
+  if (header[MAGIC] != MAGIC_NUMBER) {
+    SU2_MPI::Error(meshFilename +
+                       " is not an SU2 binary mesh, or it was written on a machine with a different byte order.",
+                   CURRENT_FUNCTION);
+  }
+  if (header[FORMAT_VERSION] != VERSION) {
+    SU2_MPI::Error("Unsupported version of the SU2 binary mesh format in " + meshFilename, CURRENT_FUNCTION);
+  }
+  if (header[NDIM] != 2 && header[NDIM] != 3) {
+    SU2_MPI::Error("Invalid dimension in the SU2 binary mesh " + meshFilename, CURRENT_FUNCTION);
+  }
+
+  dimension = header[NDIM];
+  numberOfGlobalPoints = header[NPOINT];
+  numberOfGlobalElements = header[NELEM];
+  numberOfMarkers = header[NMARKER];
+}
+
+unsigned short CSU2BinaryMeshReaderFVM::GetnDim(const string& val_filename) {
+  int64_t fileHeader[HEADER_SIZE] = {};
+
+  FILE* file = fopen(val_filename.c_str(), "rb");
+  if (!file) SU2_MPI::Error("The SU2 binary mesh file named " + val_filename + " was not found.", CURRENT_FUNCTION);
+  const auto nRead = fread(fileHeader, sizeof(int64_t), HEADER_SIZE, file);
+  fclose(file);
+
+  if (nRead != HEADER_SIZE || fileHeader[MAGIC] != MAGIC_NUMBER) {
+    SU2_MPI::Error(val_filename + " is not an SU2 binary mesh file.", CURRENT_FUNCTION);
+  }
+  return static_cast<unsigned short>(fileHeader[NDIM]);
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /*--- The coordinates of consecutive points are contiguous, the slice
+   of this rank is read with a single call. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  const unsigned long bytesPerPoint = dimension * sizeof(passivedouble);
+  vector<passivedouble> coords(numberOfLocalPoints * dimension);
+
+  ReadAt(HEADER_SIZE * sizeof(int64_t) + pointPartitioner.GetFirstIndexOnRank(rank) * bytesPerPoint,
+         numberOfLocalPoints * bytesPerPoint, coords.data());
+
+  localPointCoordinates.resize(dimension);
+  for (int iDim = 0; iDim < dimension; ++iDim) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (auto iPoint = 0ul; iPoint < numberOfLocalPoints; ++iPoint) {
+      localPointCoordinates[iDim][iPoint] = coords[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /*--- Read a linear partition of the elements. ---*/
+
+  CLinearPartitioner elementPartitioner(numberOfGlobalElements, 0);
+  const auto firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+  const auto nElemRead = elementPartitioner.GetSizeOnRank(rank);
+
+  vector<int64_t> records(nElemRead * ELEM_RECORD_SIZE);
+  ReadAt(header[ELEM_OFFSET] + firstElem * ELEM_RECORD_SIZE * sizeof(int64_t),
+         records.size() * sizeof(int64_t), records.data());
+
+  /*--- Each element is needed by all ranks that own at least one of its
+   points (in the linear partition of the points). Count the elements
+   that go to each rank, then pack them in the SU2 connectivity format:
+   [globalID vtkType n0 ... n7]. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  vector<unsigned long> nSend(size, 0), nRecv(size, 0);
+
+  /*--- Ranks that need an element, without repetitions. ---*/
+  auto destinations = [&](unsigned long iElem, int* dest) {
+    const auto* record = &records[iElem * ELEM_RECORD_SIZE];
+    int nDest = 0;
+    for (auto iNode = 0u; iNode < nPointsOfElementType(record[0]); ++iNode) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(record[1 + iNode]);
+      if (std::find(dest, dest + nDest, iRank) == dest + nDest) dest[nDest++] = iRank;
+    }
+    return nDest;
+  };
+  int dest[N_POINTS_MAXIMUM];
+
+  for (auto iElem = 0ul; iElem < nElemRead; ++iElem) {
+    switch (records[iElem * ELEM_RECORD_SIZE]) {
+      case TRIANGLE: case QUADRILATERAL: case TETRAHEDRON: case HEXAHEDRON: case PRISM: case PYRAMID:
+        break;
+      default:
+        SU2_MPI::Error("Unknown element type in the SU2 binary mesh " + meshFilename, CURRENT_FUNCTION);
+    }
+    const auto nDest = destinations(iElem, dest);
+    for (int i = 0; i < nDest; ++i) nSend[dest[i]] += SU2_CONN_SIZE;
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_UNSIGNED_LONG, nRecv.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<unsigned long> sendDispl(size, 0), recvDispl(size, 0);
+  for (int iRank = 1; iRank < size; ++iRank) {
+    sendDispl[iRank] = sendDispl[iRank - 1] + nSend[iRank - 1];
+    recvDispl[iRank] = recvDispl[iRank - 1] + nRecv[iRank - 1];
+  }
+
+  vector<unsigned long> connSend(sendDispl[size - 1] + nSend[size - 1], 0);
+  auto position = sendDispl;
+
+  for (auto iElem = 0ul; iElem < nElemRead; ++iElem) {
+    const auto* record = &records[iElem * ELEM_RECORD_SIZE];
+    const auto nDest = destinations(iElem, dest);
+    for (int i = 0; i < nDest; ++i) {
+      auto* conn = &connSend[position[dest[i]]];
+      conn[0] = firstElem + iElem;
+      for (int j = 0; j < ELEM_RECORD_SIZE; ++j) conn[1 + j] = record[j];
+      position[dest[i]] += SU2_CONN_SIZE;
+    }
+  }
+  vector<int64_t>().swap(records);
+
+  if (size == SINGLE_NODE) {
+    localVolumeElementConnectivity = std::move(connSend);
+  } else {
+    /*--- The counts and displacements of MPI are int, they are in units of elements to extend the range. ---*/
+    const unsigned long nSendTotal = sendDispl[size - 1] + nSend[size - 1];
+    const unsigned long nRecvTotal = recvDispl[size - 1] + nRecv[size - 1];
+    if (std::max(nSendTotal, nRecvTotal) / SU2_CONN_SIZE > INT_MAX) {
+      SU2_MPI::Error("Too many elements per rank to distribute the SU2 binary grid " + meshFilename +
+                         ", use more ranks.", CURRENT_FUNCTION);
+    }
+    vector<int> nSendElem(size), nRecvElem(size), sendDisplElem(size), recvDisplElem(size);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      nSendElem[iRank] = nSend[iRank] / SU2_CONN_SIZE;
+      nRecvElem[iRank] = nRecv[iRank] / SU2_CONN_SIZE;
+      sendDisplElem[iRank] = sendDispl[iRank] / SU2_CONN_SIZE;
+      recvDisplElem[iRank] = recvDispl[iRank] / SU2_CONN_SIZE;
+    }
+
+    localVolumeElementConnectivity.resize(nRecvTotal);
+
+#ifdef HAVE_MPI
+    MPI_Datatype elemType;
+    MPI_Type_contiguous(SU2_CONN_SIZE, MPI_UNSIGNED_LONG, &elemType);
+    MPI_Type_commit(&elemType);
+
+    /*--- The AD wrapper does not convert derived types, the connectivity is passive anyway. ---*/
+    MPI_Alltoallv(connSend.data(), nSendElem.data(), sendDisplElem.data(), elemType,
+                  localVolumeElementConnectivity.data(), nRecvElem.data(), recvDisplElem.data(), elemType,
+                  SU2_MPI::GetComm());
+
+    MPI_Type_free(&elemType);
+#endif
+  }
+  vector<unsigned long>().swap(connSend);
+
+  numberOfLocalElements = localVolumeElementConnectivity.size() / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  /*--- The marker names are needed on all ranks, the surface connectivity only
+   on the master (it is distributed later, as for the other readers). The
+   block is read by the master and the names are broadcast. ---*/
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  vector<char> names(numberOfMarkers * MARKER_NAME_SIZE, '\0');
+
+  if (rank == MASTER_NODE) {
+    unsigned long offset = header[MARKER_OFFSET];
+    vector<int64_t> records;
+
+    for (auto iMarker = 0ul; iMarker < numberOfMarkers; ++iMarker) {
+      auto* name = &names[iMarker * MARKER_NAME_SIZE];
+      ReadAt(offset, MARKER_NAME_SIZE, name);
+      offset += MARKER_NAME_SIZE;
+
+      int64_t nElemBound = 0;
+      ReadAt(offset, sizeof(int64_t), &nElemBound);
+      offset += sizeof(int64_t);
+
+      records.resize(nElemBound * BOUND_RECORD_SIZE);
+      ReadAt(offset, records.size() * sizeof(int64_t), records.data());
+      offset += records.size() * sizeof(int64_t);
+
+      auto& conn = surfaceElementConnectivity[iMarker];
+      conn.assign(nElemBound * SU2_CONN_SIZE, 0);
+
+      for (auto iElem = 0l; iElem < nElemBound; ++iElem) {
+        const auto* record = &records[iElem * BOUND_RECORD_SIZE];
+        if (dimension == 3 && record[0] == LINE) {
+          SU2_MPI::Error(
+              "Line boundary conditions are not possible for 3D calculations.\n"
+              "Please check the SU2 binary mesh file.",
+              CURRENT_FUNCTION);
+        }
+        for (int i = 0; i < BOUND_RECORD_SIZE; ++i) conn[iElem * SU2_CONN_SIZE + 1 + i] = record[i];
+      }
+    }
+  }
+
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  for (auto iMarker = 0ul; iMarker < numberOfMarkers; ++iMarker) {
+    const auto* name = &names[iMarker * MARKER_NAME_SIZE];
+    markerNames[iMarker] = string(name, strnlen(name, MARKER_NAME_SIZE));
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error("Mesh file contains deprecated SEND_RECEIVE marker!", CURRENT_FUNCTION);
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::StreamLocalPoints(const std::function<void(unsigned long, const passivedouble*)>& task) {
+  if (!mappedFile) return CMeshReaderFVM::StreamLocalPoints(task);
+
+  /*--- Copy the points straight from the mapping, the pages that were
+   consumed are released periodically to keep the memory footprint low. ---*/
+
+  const unsigned long bytesPerPoint = dimension * sizeof(passivedouble);
+  const char* points = mappedFile->data() + HEADER_SIZE * sizeof(int64_t);
+  passivedouble coords[3] = {0.0, 0.0, 0.0};
+  unsigned long released = 0;
+
+  for (auto iPoint = 0ul; iPoint < numberOfGlobalPoints; ++iPoint) {
+    memcpy(coords, points + iPoint * bytesPerPoint, bytesPerPoint);
+    task(iPoint, coords);
+
+    if (iPoint % 4096 == 0) {
+      const auto position = HEADER_SIZE * sizeof(int64_t) + iPoint * bytesPerPoint;
+      mappedFile->Release(released, position);
+      released = position;
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::StreamLocalVolumeElements(
+    const std::function<void(unsigned long, const unsigned long*)>& task) {
+  if (!mappedFile) return CMeshReaderFVM::StreamLocalVolumeElements(task);
+
+  const char* elems = mappedFile->data() + header[ELEM_OFFSET];
+  int64_t record[ELEM_RECORD_SIZE];
+  unsigned long connElem[SU2_CONN_SIZE];
+  unsigned long released = header[ELEM_OFFSET];
+
+  for (auto iElem = 0ul; iElem < numberOfGlobalElements; ++iElem) {
+    const auto offset = iElem * ELEM_RECORD_SIZE * sizeof(int64_t);
+    memcpy(record, elems + offset, sizeof(record));
+
+    switch (record[0]) {
+      case TRIANGLE: case QUADRILATERAL: case TETRAHEDRON: case HEXAHEDRON: case PRISM: case PYRAMID:
+        break;
+      default:
+        SU2_MPI::Error("Unknown element type in the SU2 binary mesh " + meshFilename, CURRENT_FUNCTION);
+    }
+    connElem[0] = iElem;
+    for (int i = 0; i < ELEM_RECORD_SIZE; ++i) connElem[1 + i] = record[i];
+    task(iElem, connElem);
+
+    if (iElem % 4096 == 0) {
+      mappedFile->Release(released, header[ELEM_OFFSET] + offset);
+      released = header[ELEM_OFFSET] + offset;
+    }
+  }
+}
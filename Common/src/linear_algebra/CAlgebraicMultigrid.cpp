@@ -0,0 +1,532 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the aggregation-based algebraic multigrid preconditioner.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/linear_algebra/CSysMatrix.hpp"
+#include "../../include/CConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/*!
+ * \brief In-place LU factorization with partial pivoting of a small dense (row-major) matrix.
+ * \note Zero pivots are replaced by 1 to tolerate singular (e.g. pure Neumann) operators.
+ */
+template <class T>
+void DenseLU(unsigned long n, T* A, unsigned long* pivot) {
+  for (auto k = 0ul; k < n; ++k) {
+    /*--- Find the pivot row and swap. ---*/
+    auto p = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(A[i * n + k]) > fabs(A[p * n + k])) p = i;
+    pivot[k] = p;
+    if (p != k)
+      for (auto j = 0ul; j < n; ++j) std::swap(A[k * n + j], A[p * n + j]);
+
+    if (A[k * n + k] == T(0)) A[k * n + k] = 1;
+
+    /*--- Eliminate below the diagonal, storing the multipliers. ---*/
+    const T inv = T(1) / A[k * n + k];
+    for (auto i = k + 1; i < n; ++i) {
+      const T weight = A[i * n + k] * inv;
+      A[i * n + k] = weight;
+      for (auto j = k + 1; j < n; ++j) A[i * n + j] -= weight * A[k * n + j];
+    }
+  }
+}
+
+/*!
+ * \brief Solve with the factorization computed by DenseLU, the rhs is overwritten with the solution.
+ */
+template <class T>
+void DenseLUSolve(unsigned long n, const T* LU, const unsigned long* pivot, T* b) {
+  for (auto k = 0ul; k < n; ++k) {
+    if (pivot[k] != k) std::swap(b[k], b[pivot[k]]);
+    for (auto i = k + 1; i < n; ++i) b[i] -= LU[i * n + k] * b[k];
+  }
+  for (auto i = n; i > 0ul;) {
+    i--;  // unsigned type
+    for (auto j = i + 1; j < n; ++j) b[i] -= LU[i * n + j] * b[j];
+    b[i] /= LU[i * n + i];
+  }
+}
+
+/*!
+ * \brief y = alpha * A * x (+ y if Add is true), for a square block of size n.
+ */
+template <bool Add, class T>
+FORCEINLINE void BlockGemv(unsigned long n, T alpha, const T* A, const T* x, T* y) {
+  for (auto i = 0ul; i < n; ++i) {
+    T sum = 0;
+    for (auto j = 0ul; j < n; ++j) sum += A[i * n + j] * x[j];
+    y[i] = (Add ? y[i] : T(0)) + alpha * sum;
+  }
+}
+
+}  // namespace
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetMatrix(unsigned long nvar, unsigned long npoint, unsigned long npointdomain,
+                                                const unsigned long* rowptr, const unsigned long* colidx,
+                                                const unsigned long* diaptr, const ScalarType* values) {
+  if (issetup) return;
+
+  if (nvar > MAXNVAR) SU2_MPI::Error("nVar larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  nVar = nvar;
+  nPoint = npoint;
+
+  levels.clear();
+  levels.emplace_back();
+  auto& fine = levels[0];
+  fine.nRow = npointdomain;
+  fine.row_ptr = rowptr;
+  fine.col_ind = colidx;
+  fine.dia_ptr = diaptr;
+  fine.values = values;
+
+  issetup = true;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Aggregate(unsigned long iLevel) {
+  auto& lvl = levels[iLevel];
+  const auto n = lvl.nRow;
+  const auto blkSz = nVar * nVar;
+
+  /*--- Norm of the diagonal blocks for the scaled strength of connection. ---*/
+  std::vector<ScalarType> diagNorm(n);
+  for (auto i = 0ul; i < n; ++i) diagNorm[i] = sqrt(BlockNorm2(&lvl.values[lvl.dia_ptr[i] * blkSz]));
+
+  /*--- Strength of connection of non zero k (row i), negative if the connection is weak or not local. ---*/
+  auto connection = [&](unsigned long i, unsigned long k) {
+    const auto j = lvl.col_ind[k];
+    if (j >= n || j == i) return ScalarType(-1);
+    const ScalarType s = sqrt(BlockNorm2(&lvl.values[k * blkSz]));
+    return (s > ScalarType(0) && s >= strength * sqrt(diagNorm[i] * diagNorm[j])) ? s : ScalarType(-1);
+  };
+
+  auto& agg = lvl.point2agg;
+  agg.assign(n, NO_INDEX);
+  unsigned long nAgg = 0;
+
+  /*--- Phase 1, points whose strong neighbors are all free become the roots of new aggregates. ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (agg[i] != NO_INDEX) continue;
+    bool isolated = true, free = true;
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k) {
+      if (connection(i, k) < ScalarType(0)) continue;
+      isolated = false;
+      free &= (agg[lvl.col_ind[k]] == NO_INDEX);
+    }
+    if (isolated || !free) continue;
+
+    agg[i] = nAgg;
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k)
+      if (connection(i, k) >= ScalarType(0)) agg[lvl.col_ind[k]] = nAgg;
+    ++nAgg;
+  }
+
+  /*--- Phase 2, attach the remaining points to the aggregate they are most strongly connected to.
+   *    Only the aggregates from phase 1 are considered, so that they do not grow in chains. ---*/
+
+  const auto phase1 = agg;
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (agg[i] != NO_INDEX) continue;
+    ScalarType maxStrength = 0;
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k) {
+      const auto s = connection(i, k);
+      const auto j = lvl.col_ind[k];
+      if (s > maxStrength && phase1[j] != NO_INDEX) {
+        maxStrength = s;
+        agg[i] = phase1[j];
+      }
+    }
+  }
+
+  /*--- Phase 3, what is left forms new aggregates with its free strong neighbors (or alone if isolated). ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (agg[i] != NO_INDEX) continue;
+    agg[i] = nAgg;
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k) {
+      if (connection(i, k) >= ScalarType(0) && agg[lvl.col_ind[k]] == NO_INDEX) agg[lvl.col_ind[k]] = nAgg;
+    }
+    ++nAgg;
+  }
+
+  /*--- List the points of each aggregate. ---*/
+
+  lvl.agg_ptr.assign(nAgg + 1, 0);
+  for (auto i = 0ul; i < n; ++i) ++lvl.agg_ptr[agg[i] + 1];
+  for (auto iAgg = 0ul; iAgg < nAgg; ++iAgg) lvl.agg_ptr[iAgg + 1] += lvl.agg_ptr[iAgg];
+
+  lvl.agg_pts.resize(n);
+  auto fill = lvl.agg_ptr;
+  for (auto i = 0ul; i < n; ++i) lvl.agg_pts[fill[agg[i]]++] = i;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetCoarsePattern(unsigned long iLevel) {
+  levels.emplace_back();
+  auto& fine = levels[iLevel];
+  auto& coarse = levels[iLevel + 1];
+
+  const auto n = fine.nRow;
+  const auto nCoarse = fine.agg_ptr.size() - 1;
+
+  coarse.nRow = nCoarse;
+  coarse.row_ptr_.resize(nCoarse + 1);
+  coarse.dia_ptr_.resize(nCoarse);
+  coarse.row_ptr_[0] = 0;
+
+  fine.nnz2coarse.assign(fine.row_ptr[n], NO_INDEX);
+
+  /*--- Position of each coarse column in the current coarse row. ---*/
+  std::vector<unsigned long> position(nCoarse, NO_INDEX);
+  std::vector<unsigned long> columns;
+
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    /*--- Gather the (local) coarse columns coupled to the points of the aggregate. ---*/
+    columns.clear();
+    for (auto p = fine.agg_ptr[iAgg]; p < fine.agg_ptr[iAgg + 1]; ++p) {
+      const auto i = fine.agg_pts[p];
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i + 1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (j >= n) continue;
+        const auto jAgg = fine.point2agg[j];
+        if (position[jAgg] == NO_INDEX) {
+          position[jAgg] = 0;
+          columns.push_back(jAgg);
+        }
+      }
+    }
+    std::sort(columns.begin(), columns.end());
+
+    const auto offset = coarse.row_ptr_[iAgg];
+    for (auto c = 0ul; c < columns.size(); ++c) {
+      position[columns[c]] = offset + c;
+      coarse.col_ind_.push_back(columns[c]);
+    }
+    coarse.row_ptr_[iAgg + 1] = offset + columns.size();
+    coarse.dia_ptr_[iAgg] = position[iAgg];
+
+    /*--- Map the fine non zeros to the coarse ones. ---*/
+    for (auto p = fine.agg_ptr[iAgg]; p < fine.agg_ptr[iAgg + 1]; ++p) {
+      const auto i = fine.agg_pts[p];
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i + 1]; ++k) {
+        const auto j = fine.col_ind[k];
+        if (j < n) fine.nnz2coarse[k] = position[fine.point2agg[j]];
+      }
+    }
+
+    for (auto jAgg : columns) position[jAgg] = NO_INDEX;
+  }
+
+  coarse.values_.resize(coarse.row_ptr_[nCoarse] * nVar * nVar);
+  coarse.invDiag.resize(nCoarse * nVar * nVar);
+  coarse.rhs.resize(nCoarse * nVar);
+  coarse.sol.resize(nCoarse * nVar);
+  coarse.res.resize(nCoarse * nVar);
+  coarse.omp_chunk_size = computeStaticChunkSize(nCoarse, omp_get_max_threads(), OMP_MAX_SIZE);
+  coarse.SetPointers();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeCoarseValues(unsigned long iLevel) {
+  const auto& fine = levels[iLevel];
+  auto& coarse = levels[iLevel + 1];
+  const auto blkSz = nVar * nVar;
+
+  /*--- R A P with piecewise constant P, each coarse row only receives contributions
+   *    from the points of its aggregate, therefore the rows can be done in parallel. ---*/
+
+  SU2_OMP_FOR_DYN(coarse.omp_chunk_size)
+  for (auto iAgg = 0ul; iAgg < coarse.nRow; ++iAgg) {
+    auto* row = &coarse.values_[coarse.row_ptr[iAgg] * blkSz];
+    const auto rowSz = (coarse.row_ptr[iAgg + 1] - coarse.row_ptr[iAgg]) * blkSz;
+    for (auto k = 0ul; k < rowSz; ++k) row[k] = 0.0;
+
+    for (auto p = fine.agg_ptr[iAgg]; p < fine.agg_ptr[iAgg + 1]; ++p) {
+      const auto i = fine.agg_pts[p];
+      for (auto k = fine.row_ptr[i]; k < fine.row_ptr[i + 1]; ++k) {
+        const auto kc = fine.nnz2coarse[k];
+        if (kc == NO_INDEX) continue;
+        auto* dst = &coarse.values_[kc * blkSz];
+        const auto* src = &fine.values[k * blkSz];
+        SU2_OMP_SIMD
+        for (auto l = 0ul; l < blkSz; ++l) dst[l] += src[l];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::InvertDiagonal(unsigned long iLevel) {
+  auto& lvl = levels[iLevel];
+  const auto blkSz = nVar * nVar;
+
+  SU2_OMP_FOR_DYN(lvl.omp_chunk_size)
+  for (auto i = 0ul; i < lvl.nRow; ++i) {
+    ScalarType block[MAXNVAR * MAXNVAR];
+    unsigned long pivot[MAXNVAR];
+
+    const auto* diag = &lvl.values[lvl.dia_ptr[i] * blkSz];
+    for (auto k = 0ul; k < blkSz; ++k) block[k] = diag[k];
+    DenseLU(nVar, block, pivot);
+
+    auto* inv = &lvl.invDiag[i * blkSz];
+    for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+      ScalarType column[MAXNVAR] = {0};
+      column[jVar] = 1;
+      DenseLUSolve(nVar, block, pivot, column);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) inv[iVar * nVar + jVar] = column[iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::FactorizeCoarsest() {
+  const auto& lvl = levels.back();
+  const auto n = lvl.nRow * nVar;
+  const auto blkSz = nVar * nVar;
+
+  coarseLU.assign(n * n, ScalarType(0));
+  coarsePivot.resize(n);
+
+  for (auto i = 0ul; i < lvl.nRow; ++i) {
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k) {
+      const auto j = lvl.col_ind[k];
+      if (j >= lvl.nRow) continue;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          coarseLU[(i * nVar + iVar) * n + j * nVar + jVar] = lvl.values[k * blkSz + iVar * nVar + jVar];
+    }
+  }
+  DenseLU(n, coarseLU.data(), coarsePivot.data());
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(const CConfig* config) {
+  if (!issetup) SU2_MPI::Error("The matrix data has not been set.", CURRENT_FUNCTION);
+
+  if (!isbuilt) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      maxLevels = std::max<unsigned short>(config->GetLinear_Solver_AMG_Levels(), 1);
+      nSweeps = std::max<unsigned short>(config->GetLinear_Solver_AMG_Sweeps(), 1);
+      strength = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+      omega = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Relaxation());
+
+      /*--- Coarse levels keep pointers to their own storage, do not let the vector reallocate. ---*/
+      levels.reserve(maxLevels);
+
+      auto& fine = levels[0];
+      fine.invDiag.resize(fine.nRow * nVar * nVar);
+      fine.omp_chunk_size = computeStaticChunkSize(fine.nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+      fineRes.resize(fine.nRow * nVar);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  InvertDiagonal(0);
+
+  for (auto iLevel = 0ul;; ++iLevel) {
+    if (!isbuilt) {
+      /*--- Decide if one more level is needed and create it, based on the values of the current level. ---*/
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+        auto& lvl = levels[iLevel];
+        if (iLevel + 1 < maxLevels && lvl.nRow * nVar > MAX_DIRECT_SIZE) {
+          Aggregate(iLevel);
+          const auto nCoarse = lvl.agg_ptr.size() - 1;
+          /*--- Stop if the coarsening stalls. ---*/
+          if (nCoarse > 0 && 5 * nCoarse < 4 * lvl.nRow) {
+            SetCoarsePattern(iLevel);
+          } else {
+            lvl.agg_ptr.clear();
+            lvl.agg_pts.clear();
+            lvl.point2agg.clear();
+          }
+        }
+      }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    }
+    if (iLevel + 1 >= levels.size()) break;
+
+    ComputeCoarseValues(iLevel);
+    InvertDiagonal(iLevel + 1);
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    directCoarse = (levels.back().nRow * nVar <= MAX_DIRECT_SIZE);
+    if (directCoarse) FactorizeCoarsest();
+    isbuilt = true;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(unsigned long iLevel, const ScalarType* b, const ScalarType* x,
+                                               ScalarType* r) const {
+  const auto& lvl = levels[iLevel];
+  const auto blkSz = nVar * nVar;
+
+  SU2_OMP_FOR_STAT(lvl.omp_chunk_size)
+  for (auto i = 0ul; i < lvl.nRow; ++i) {
+    auto* ri = &r[i * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) ri[iVar] = b[i * nVar + iVar];
+
+    for (auto k = lvl.row_ptr[i]; k < lvl.row_ptr[i + 1]; ++k) {
+      BlockGemv<true>(nVar, ScalarType(-1), &lvl.values[k * blkSz], &x[lvl.col_ind[k] * nVar], ri);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(unsigned long iLevel, const ScalarType* b, ScalarType* x, ScalarType* r,
+                                             unsigned short sweeps, bool xIsZero, CSysVector<ScalarType>* fineSol,
+                                             CGeometry* geometry, const CConfig* config) const {
+  const auto& lvl = levels[iLevel];
+  const auto blkSz = nVar * nVar;
+
+  for (auto iSweep = 0u; iSweep < sweeps; ++iSweep) {
+    if (iSweep == 0 && xIsZero) {
+      /*--- x = w D^-1 b ---*/
+      SU2_OMP_FOR_STAT(lvl.omp_chunk_size)
+      for (auto i = 0ul; i < lvl.nRow; ++i)
+        BlockGemv<false>(nVar, omega, &lvl.invDiag[i * blkSz], &b[i * nVar], &x[i * nVar]);
+      END_SU2_OMP_FOR
+      continue;
+    }
+
+    /*--- On the finest level the halo values are needed to compute the residual. ---*/
+    if (fineSol) {
+      CSysMatrixComms::Initiate(*fineSol, geometry, config);
+      CSysMatrixComms::Complete(*fineSol, geometry, config);
+    }
+
+    /*--- x += w D^-1 (b - A x) ---*/
+    Residual(iLevel, b, x, r);
+
+    SU2_OMP_FOR_STAT(lvl.omp_chunk_size)
+    for (auto i = 0ul; i < lvl.nRow; ++i)
+      BlockGemv<true>(nVar, omega, &lvl.invDiag[i * blkSz], &r[i * nVar], &x[i * nVar]);
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x,
+                                            CSysVector<ScalarType>* fineSol, CGeometry* geometry,
+                                            const CConfig* config) const {
+  const auto& lvl = levels[iLevel];
+  auto* r = (iLevel == 0) ? fineRes.data() : lvl.res.data();
+
+  /*--- Coarsest level, direct solve or (many) smoothing iterations. ---*/
+
+  if (iLevel + 1 == levels.size()) {
+    if (directCoarse) {
+      SU2_OMP_MASTER {
+        for (auto i = 0ul; i < lvl.nRow * nVar; ++i) x[i] = b[i];
+        DenseLUSolve(lvl.nRow * nVar, coarseLU.data(), coarsePivot.data(), x);
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    } else {
+      Smooth(iLevel, b, x, r, 4 * nSweeps, true, fineSol, geometry, config);
+    }
+    return;
+  }
+
+  const auto& coarse = levels[iLevel + 1];
+
+  /*--- Pre-smoothing and residual. ---*/
+
+  Smooth(iLevel, b, x, r, nSweeps, true, fineSol, geometry, config);
+
+  if (fineSol) {
+    CSysMatrixComms::Initiate(*fineSol, geometry, config);
+    CSysMatrixComms::Complete(*fineSol, geometry, config);
+  }
+  Residual(iLevel, b, x, r);
+
+  /*--- Restriction (sum over the points of each aggregate). ---*/
+
+  SU2_OMP_FOR_STAT(coarse.omp_chunk_size)
+  for (auto iAgg = 0ul; iAgg < coarse.nRow; ++iAgg) {
+    auto* rc = &coarse.rhs[iAgg * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) rc[iVar] = 0.0;
+    for (auto p = lvl.agg_ptr[iAgg]; p < lvl.agg_ptr[iAgg + 1]; ++p) {
+      const auto i = lvl.agg_pts[p];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) rc[iVar] += r[i * nVar + iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Coarse grid correction. ---*/
+
+  Cycle(iLevel + 1, coarse.rhs.data(), coarse.sol.data(), nullptr, geometry, config);
+
+  SU2_OMP_FOR_STAT(lvl.omp_chunk_size)
+  for (auto i = 0ul; i < lvl.nRow; ++i) {
+    const auto* xc = &coarse.sol[lvl.point2agg[i] * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x[i * nVar + iVar] += xc[iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing. ---*/
+
+  Smooth(iLevel, b, x, r, nSweeps, false, fineSol, geometry, config);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Solve(const CSysVector<ScalarType>& rhs, CSysVector<ScalarType>& sol,
+                                            CGeometry* geometry, const CConfig* config) const {
+  if (!isbuilt) SU2_MPI::Error("The AMG hierarchy has not been built yet.", CURRENT_FUNCTION);
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  Cycle(0, rhs.begin(), &sol[0], &sol, geometry, config);
+}
+
+/*--- Explicit instantiations, the same types as CSysMatrix. ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
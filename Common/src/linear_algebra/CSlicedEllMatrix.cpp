@@ -0,0 +1,250 @@
+/*!
+ * \file CSlicedEllMatrix.cpp
+ * \brief Implementation of the sliced ELLPACK (SELL-C-sigma) layout of CSysMatrix.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSlicedEllMatrix.hpp"
+#include "../../include/parallelization/vectorization.hpp"
+#include "../../include/toolboxes/allocation_toolbox.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+template <class ScalarType>
+CSlicedEllMatrix<ScalarType>::~CSlicedEllMatrix() {
+  MemoryAllocation::aligned_free(values);
+  MemoryAllocation::aligned_free(invDiag);
+}
+
+template <class ScalarType>
+unsigned long CSlicedEllMatrix<ScalarType>::ChunkSize() {
+  return simd::Array<ScalarType>::Size;
+}
+
+template <class ScalarType>
+void CSlicedEllMatrix<ScalarType>::Initialize(unsigned long nrow, unsigned long nvar, unsigned long neqn,
+                                              const unsigned long* row_ptr, const unsigned long* col_ind) {
+  const auto C = ChunkSize();
+
+  MemoryAllocation::aligned_free(values);
+  MemoryAllocation::aligned_free(invDiag);
+  values = nullptr;
+  invDiag = nullptr;
+  valid = false;
+  validInvDiag = false;
+
+  nRow = nrow;
+  nVar = nvar;
+  nEqn = neqn;
+  nChunk = roundUpDiv(nRow, C);
+  if (nChunk == 0) return;
+
+  omp_chunk_size = computeStaticChunkSize(nChunk, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  auto rowLength = [&](unsigned long iRow) { return row_ptr[iRow + 1] - row_ptr[iRow]; };
+
+  /*--- Sort the rows by decreasing length within each window of sigma rows. ---*/
+
+  row_perm.assign(nChunk * C, NO_INDEX);
+  std::iota(row_perm.begin(), row_perm.begin() + nRow, 0ul);
+
+  const auto sigma = SIGMA_CHUNKS * C;
+  for (auto begin = 0ul; begin < nRow; begin += sigma) {
+    const auto end = std::min(begin + sigma, nRow);
+    std::stable_sort(row_perm.begin() + begin, row_perm.begin() + end,
+                     [&](unsigned long a, unsigned long b) { return rowLength(a) > rowLength(b); });
+  }
+
+  /*--- The first lane of each chunk has the longest row. ---*/
+
+  chunk_ptr.resize(nChunk + 1);
+  chunk_ptr[0] = 0;
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    chunk_ptr[iChunk + 1] = chunk_ptr[iChunk] + rowLength(row_perm[iChunk * C]);
+  }
+  const auto nSlot = chunk_ptr[nChunk];
+
+  /*--- Map the slots to the BCSR blocks. The padding repeats the columns of the first lane to access memory
+   *    that is already being loaded (with zero blocks this has no effect on the result). ---*/
+
+  src_idx.assign(nSlot * C, NO_INDEX);
+  col_off.assign(nSlot * C, 0);
+
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iRow = row_perm[iChunk * C + iLane];
+      if (iRow == NO_INDEX) continue;
+      for (auto k = 0ul; k < rowLength(iRow); ++k) {
+        const auto iSlot = chunk_ptr[iChunk] + k;
+        src_idx[iSlot * C + iLane] = row_ptr[iRow] + k;
+        col_off[iSlot * C + iLane] = col_ind[row_ptr[iRow] + k] * nEqn;
+      }
+    }
+    for (auto iSlot = chunk_ptr[iChunk]; iSlot < chunk_ptr[iChunk + 1]; ++iSlot) {
+      for (auto iLane = 1ul; iLane < C; ++iLane) {
+        if (src_idx[iSlot * C + iLane] == NO_INDEX) col_off[iSlot * C + iLane] = col_off[iSlot * C];
+      }
+    }
+  }
+
+  values = MemoryAllocation::aligned_alloc<ScalarType, true>(64, nSlot * C * nVar * nEqn * sizeof(ScalarType));
+}
+
+template <class ScalarType>
+void CSlicedEllMatrix<ScalarType>::SetValues(const ScalarType* matrix) {
+  const auto C = ChunkSize();
+  const auto blkSize = nVar * nEqn;
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    for (auto iSlot = chunk_ptr[iChunk]; iSlot < chunk_ptr[iChunk + 1]; ++iSlot) {
+      auto dst = &values[iSlot * blkSize * C];
+      for (auto iLane = 0ul; iLane < C; ++iLane) {
+        const auto src = src_idx[iSlot * C + iLane];
+        for (auto k = 0ul; k < blkSize; ++k) {
+          dst[k * C + iLane] = (src != NO_INDEX) ? matrix[src * blkSize + k] : ScalarType(0);
+        }
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { valid = true; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSlicedEllMatrix<ScalarType>::SetInvDiagonal(const ScalarType* invM) {
+  const auto C = ChunkSize();
+  const auto blkSize = nVar * nVar;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (!invDiag) {
+      invDiag = MemoryAllocation::aligned_alloc<ScalarType, true>(64, nChunk * C * blkSize * sizeof(ScalarType));
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    auto dst = &invDiag[iChunk * blkSize * C];
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iRow = row_perm[iChunk * C + iLane];
+      for (auto k = 0ul; k < blkSize; ++k) {
+        dst[k * C + iLane] = (iRow != NO_INDEX) ? invM[iRow * blkSize + k] : ScalarType(0);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { validInvDiag = true; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSlicedEllMatrix<ScalarType>::MatrixVectorProduct(const ScalarType* x, ScalarType* y) const {
+  using Array = simd::Array<ScalarType>;
+  constexpr auto C = Array::Size;
+  const auto blkSize = nVar * nEqn;
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    Array prod[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) prod[iVar] = ScalarType(0);
+
+    /*--- Each slot is one block per lane, gather the corresponding entries of x and accumulate. ---*/
+
+    for (auto iSlot = chunk_ptr[iChunk]; iSlot < chunk_ptr[iChunk + 1]; ++iSlot) {
+      const auto cols = &col_off[iSlot * C];
+      const auto blk = &values[iSlot * blkSize * C];
+
+      for (auto jVar = 0ul; jVar < nEqn; ++jVar) {
+        const Array xj(x + jVar, cols);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          Array aij;
+          aij.loada(&blk[(iVar * nEqn + jVar) * C]);
+          prod[iVar] += aij * xj;
+        }
+      }
+    }
+
+    /*--- Scatter to the original rows. ---*/
+
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iRow = row_perm[iChunk * C + iLane];
+      if (iRow == NO_INDEX) continue;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) y[iRow * nVar + iVar] = prod[iVar][iLane];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSlicedEllMatrix<ScalarType>::InvDiagonalProduct(const ScalarType* x, ScalarType* y) const {
+  using Array = simd::Array<ScalarType>;
+  constexpr auto C = Array::Size;
+  const auto blkSize = nVar * nVar;
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    /*--- Padding lanes read the first row of the chunk (and multiply it by zero). ---*/
+    const auto rows = &row_perm[iChunk * C];
+    unsigned long offsets[C];
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      offsets[iLane] = ((rows[iLane] != NO_INDEX) ? rows[iLane] : rows[0]) * nVar;
+    }
+
+    Array prod[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) prod[iVar] = ScalarType(0);
+
+    const auto blk = &invDiag[iChunk * blkSize * C];
+
+    for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+      const Array xj(x + jVar, offsets);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        Array aij;
+        aij.loada(&blk[(iVar * nVar + jVar) * C]);
+        prod[iVar] += aij * xj;
+      }
+    }
+
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      if (rows[iLane] == NO_INDEX) continue;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) y[rows[iLane] * nVar + iVar] = prod[iVar][iLane];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+/*--- Explicit instantiations, the same types as CSysMatrix. ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CSlicedEllMatrix<su2double>;
+#else
+template class CSlicedEllMatrix<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CSlicedEllMatrix<passivedouble>;
+#endif
+#endif
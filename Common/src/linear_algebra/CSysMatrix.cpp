@@ -52,6 +52,7 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
   col_ind_ilu = nullptr;
 
   invM = nullptr;
+  lusgs_inv_diag = false;
 
 #ifdef USE_MKL
   MatrixMatrixProductJitter = nullptr;
@@ -112,8 +113,17 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     prec = config->GetKind_Grad_Linear_Solver_Prec();
   }
 
+  /*--- The sliced (SIMD) storage is not used with AD types. ---*/
+  const bool sliced_needed = config->GetLinear_Solver_SELL() && std::is_arithmetic<ScalarType>::value;
+  lusgs_inv_diag = sliced_needed && (prec == LU_SGS);
+
   const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET) || lusgs_inv_diag;
+
+  /*--- 16-bit storage of the preconditioner factors (not used with AD types, LU_SGS uses the matrix). ---*/
+  const auto prec_storage = config->GetLinear_Solver_Prec_Storage();
+  const bool half_factors = (prec_storage != PREC_STORAGE::FULL) && std::is_arithmetic<ScalarType>::value &&
+                            (ilu_needed || (prec == JACOBI) || (prec == LINELET));
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -149,6 +159,11 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    if (config->GetLinear_Solver_ILU_Level_Scheduling()) {
+      ilu_lower_levels = levelSchedulePattern(csr_ilu, nPointDomain, false);
+      ilu_upper_levels = levelSchedulePattern(csr_ilu, nPointDomain, true);
+    }
   }
 
   /*--- Allocate data. ---*/
@@ -160,9 +175,16 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   /*--- Preconditioners. ---*/
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+  if (half_factors) {
+    if (ilu_needed) ILU_half.Initialize(nnz_ilu, nVar, nEqn, prec_storage);
+    invM_half.Initialize(nPointDomain, nVar, nEqn, prec_storage);
+  } else {
+    if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+
+    if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+  }
 
-  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+  if (sliced_needed) sliced.Initialize(nPointDomain, nVar, nEqn, row_ptr, col_ind);
 
   /*--- Thread parallel initialization. ---*/
 
@@ -581,11 +603,15 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  if (sliced.IsValid()) {
+    sliced.MatrixVectorProduct(vec.begin(), &prod[0]);
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -593,13 +619,35 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSlicedMatrix() {
+  if (sliced.IsInitialized()) sliced.SetValues(matrix);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::InvalidateSlicedMatrix() {
+  if (!sliced.IsInitialized()) return;
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { sliced.Invalidate(); }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (invM_half.empty()) {
+      InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
+    } else {
+      ScalarType block[MAXNVAR * MAXNVAR];
+      InverseDiagonalBlock(iPoint, block);
+      invM_half.Set(iPoint, block);
+    }
+  }
   END_SU2_OMP_FOR
+
+  /*--- Interleaved copy for the SIMD product. ---*/
+  if (sliced.IsInitialized() && invM_half.empty()) sliced.SetInvDiagonal(invM);
 }
 
 template <class ScalarType>
@@ -608,10 +656,14 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
                                                          const CConfig* config) const {
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
-  END_SU2_OMP_FOR
+  if (sliced.IsValidInvDiagonal() && invM_half.empty()) {
+    sliced.InvDiagonalProduct(vec.begin(), &prod[0]);
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      InvDiagonalBlockProduct(iPoint, &vec[iPoint * nVar], &prod[iPoint * nVar]);
+    END_SU2_OMP_FOR
+  }
 
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -620,14 +672,21 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
-  /*--- Copy block matrix to compute factorization in-place. ---*/
+  /*--- The diagonal of the factorization overwrites the inverse used by Jacobi. ---*/
+  if (sliced.IsValidInvDiagonal()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { sliced.InvalidateInvDiagonal(); }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Copy block matrix to compute factorization in-place, not needed with 16-bit storage as each row is
+   *    copied to a buffer before being factorized (see CompressedILURowFactorization). ---*/
 
-  if (ilu_fill_in == 0) {
+  if (ILU_half.empty() && ilu_fill_in == 0) {
     /*--- ILU0, direct copy. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
     for (auto iVar = 0ul; iVar < nnz * nVar * nVar; ++iVar) ILU_matrix[iVar] = matrix[iVar];
     END_SU2_OMP_FOR
-  } else {
+  } else if (ILU_half.empty()) {
     /*--- ILUn clear the ILU matrix first. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
     for (auto iVar = 0ul; iVar < nnz_ilu * nVar * nVar; iVar++) ILU_matrix[iVar] = 0.0;
@@ -647,6 +706,23 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  vector<ScalarType> rowBuffer;
+
+  auto factorizeRow = [&](unsigned long iPoint, unsigned long begin, unsigned long end) {
+    if (ILU_half.empty())
+      ILURowFactorization(iPoint, begin, end);
+    else
+      CompressedILURowFactorization(iPoint, begin, end, rowBuffer);
+  };
+
+  if (!ilu_lower_levels.empty()) {
+    /*--- Level scheduling, the rows of a level only depend on rows of previous levels, which have already been
+     *    factorized, thus the threads can share the work and the factor is the same as with one thread. ---*/
+
+    ForEachRowByLevel(ilu_lower_levels, [&](unsigned long iPoint) { factorizeRow(iPoint, 0, nPointDomain); });
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -655,64 +731,125 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
 
     /*--- Each thread will work on the submatrix defined from row/col "begin"
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+    for (auto iPoint = begin; iPoint < end; iPoint++) factorizeRow(iPoint, begin, end);
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ILURowFactorization(unsigned long iPoint, unsigned long begin, unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+    auto jPoint = col_ind_ilu[index];
 
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+    if (jPoint < begin) continue;
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        auto jPoint = col_ind_ilu[index];
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-        if (jPoint < begin) continue;
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+      auto kPoint = col_ind_ilu[index_];
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+      if (kPoint >= end) break;
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
 
-          auto kPoint = col_ind_ilu[index_];
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
 
-          if (kPoint >= end) break;
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+  }
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+  /*--- Invert and store the diagonal block to later compute the weights of the rows below. ---*/
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+  InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::CompressedILURowFactorization(unsigned long iPoint, unsigned long begin,
+                                                           unsigned long end, vector<ScalarType>& rowBuffer) {
+  /*--- Same algorithm as ILURowFactorization, but the factorization cannot be done in-place in 16 bits. ---*/
+
+  const auto blkSize = nVar * nVar;
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR], Block_jk[MAXNVAR * MAXNVAR];
+
+  const auto rowBegin = row_ptr_ilu[iPoint];
+  const auto rowEnd = row_ptr_ilu[iPoint + 1];
+
+  /*--- Block (iPoint, kPoint) of the buffer, nullptr if it is not in the ILU pattern. ---*/
+  auto rowBlock = [&](unsigned long kPoint) -> ScalarType* {
+    for (auto index = rowBegin; index < rowEnd; ++index)
+      if (col_ind_ilu[index] == kPoint) return &rowBuffer[(index - rowBegin) * blkSize];
+    return nullptr;
+  };
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+  /*--- Scatter the row of the matrix into the ILU pattern (which contains the pattern of the matrix). ---*/
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+  rowBuffer.assign((rowEnd - rowBegin) * blkSize, 0.0);
+  for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; index++) {
+    auto Block_ij = rowBlock(col_ind[index]);
+    if (Block_ij) MatrixCopy(&matrix[index * blkSize], Block_ij);
+  }
+
+  /*--- Eliminate the lower part within the sub matrix. ---*/
+
+  for (auto index = rowBegin; index < dia_ptr_ilu[iPoint]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+
+    auto Block_ij = &rowBuffer[(index - rowBegin) * blkSize];
+    invM_half.Get(jPoint, aux_block);
+    MatrixMatrixProduct(Block_ij, aux_block, weight);
+
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      auto kPoint = col_ind_ilu[index_];
+      if (kPoint >= end) break;
+
+      auto Block_ik = rowBlock(kPoint);
+      if (Block_ik != nullptr) {
+        ILU_half.Get(index_, Block_jk);
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
       }
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+    MatrixCopy(weight, Block_ij);
   }
-  END_SU2_OMP_FOR
+
+  /*--- Invert the diagonal block and encode the row. ---*/
+
+  MatrixCopy(&rowBuffer[(dia_ptr_ilu[iPoint] - rowBegin) * blkSize], aux_block);
+  MatrixInverse(aux_block, weight);
+  invM_half.Set(iPoint, weight);
+
+  for (auto index = rowBegin; index < rowEnd; index++)
+    ILU_half.Set(index, &rowBuffer[(index - rowBegin) * blkSize]);
 }
 
 template <class ScalarType>
@@ -721,49 +858,64 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  /*--- Forward solve the system using the lower matrix entries that
+   were computed and stored during the ILU preprocessing. Note
+   that we are overwriting the residual vector as we go. ---*/
+
+  auto forwardRow = [&](unsigned long iPoint, unsigned long begin) {
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint < begin) continue;
+      ILUBlockProductSub(index, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+    }
+  };
 
+  /*--- Backwards substitution (rows below must be done). ---*/
+
+  auto backwardRow = [&](unsigned long iPoint, unsigned long end) {
     ScalarType aux_vec[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint >= end) break;
+      ILUBlockProductSub(index, &prod[jPoint * nVar], aux_vec);
+    }
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+    InvDiagonalBlockProduct(iPoint, aux_vec, &prod[iPoint * nVar]);
+  };
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+  if (!ilu_lower_levels.empty()) {
+    /*--- Level scheduling, each sweep goes through the levels of the respective triangular part. ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
-    }
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nPointDomain * nVar; iVar++) prod[iVar] = vec[iVar];
+    END_SU2_OMP_FOR
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    ForEachRowByLevel(ilu_lower_levels, [&](unsigned long iPoint) { forwardRow(iPoint, 0); });
+    ForEachRowByLevel(ilu_upper_levels, [&](unsigned long iPoint) { backwardRow(iPoint, nPointDomain); });
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      /*--- Copy vector to then work on prod in place ---*/
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) forwardRow(iPoint, begin);
+
+      /*--- Starts at the last row. ---*/
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        backwardRow(iPoint, end);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
@@ -771,10 +923,36 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildLU_SGSPreconditioner() {
+  if (!lusgs_inv_diag) return;
+
+  if (sliced.IsValidInvDiagonal()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { sliced.InvalidateInvDiagonal(); }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
+  /*--- Solve D.x = y in place, with a product if the inverse of D is known, or by elimination. ---*/
+  auto DiagonalSolve = [this](unsigned long iPoint, ScalarType* y) {
+    if (lusgs_inv_diag) {
+      ScalarType rhs[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) rhs[iVar] = y[iVar];
+      MatrixVectorProduct(&invM[iPoint * nVar * nVar], rhs, y);
+    } else {
+      Gauss_Elimination(iPoint, y);
+    }
+  };
+
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
   /*--- Coherent view of vectors. ---*/
@@ -798,7 +976,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
       auto idx = iPoint * nVar;
       LowerProduct(prod, iPoint, begin, low_prod);         // Compute L.x*
       VectorSubtraction(&vec[idx], low_prod, &prod[idx]);  // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);               // Solve D.x* = y
+      DiagonalSolve(iPoint, &prod[idx]);                   // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
@@ -825,7 +1003,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
       DiagonalProduct(prod, iPoint, dia_prod);           // Compute D.x*
       UpperProduct(prod, iPoint, row_end, up_prod);      // Compute U.x_(n+1)
       VectorSubtraction(dia_prod, up_prod, &prod[idx]);  // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);             // Solve D.x* = y
+      DiagonalSolve(iPoint, &prod[idx]);                 // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
@@ -879,7 +1057,7 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   SU2_OMP_FOR_(schedule(dynamic, omp_heavy_size) SU2_NOWAIT)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
     if (li.lineletIdx[iPoint] == CGeometry::CLineletInfo::NO_LINELET)
-      MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+      InvDiagonalBlockProduct(iPoint, &vec[iPoint * nVar], &prod[iPoint * nVar]);
   END_SU2_OMP_FOR
 
   /*--- Solve the tridiagonal systems for the linelets. ---*/
@@ -1194,6 +1372,25 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig* config) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    amg.SetMatrix(nVar, nPoint, nPointDomain, row_ptr, col_ind, dia_ptr, matrix);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  amg.Build(config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  amg.Solve(vec, prod, geometry, config);
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 /*--- Explicit instantiations ---*/
 
 #define INSTANTIATE_COMMS(TYPE)                                                                                       \
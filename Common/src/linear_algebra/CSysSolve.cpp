@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/linear_algebra/blas_structure.hpp"
 
 #include <limits>
 
@@ -172,6 +173,105 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::StartPipelinedDots(const CSysVector<ScalarType>& w, int n,
+                                               const vector<CSysVector<ScalarType> >& v) const {
+  const int nDots = n + 2;
+
+  /*--- Local sums in [0, nDots), global results in [nDots, 2 nDots). ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (pipe_dots.size() < 2ul * nDots) pipe_dots.resize(2 * nDots);
+    for (int k = 0; k < nDots; ++k) pipe_dots[k] = 0.0;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- One pass over the vectors for all the products of this thread. ---*/
+
+  vector<ScalarType> sums(nDots, 0.0);
+  const auto nElm = w.GetNElmDomain();
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nElm, omp_get_num_threads(), 4096))
+  for (auto i = 0ul; i < nElm; ++i) {
+    const ScalarType wi = w[i];
+    for (int k = 0; k < n; ++k) sums[k] += wi * v[k][i];
+    sums[n] += wi * wi;
+    sums[n + 1] += v[n - 1][i] * v[n - 1][i];
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  for (int k = 0; k < nDots; ++k) pipe_dots[k] += sums[k];
+  END_SU2_OMP_CRITICAL
+
+  /*--- Only the master thread communicates, the other threads can move on to other work. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Iallreduce(pipe_dots.data(), &pipe_dots[nDots], nDots, mpi_type, MPI_SUM,
+                                                SU2_MPI::GetComm(), &pipe_request);
+#else
+    for (int k = 0; k < nDots; ++k) pipe_dots[nDots + k] = pipe_dots[k];
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
+
+template <class ScalarType>
+const ScalarType* CSysSolve<ScalarType>::FinishPipelinedDots(int n) const {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+#ifdef HAVE_MPI
+    SelectMPIWrapper<ScalarType>::W::Wait(&pipe_request, MPI_STATUS_IGNORE);
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  return &pipe_dots[n + 2];
+}
+
+template <class ScalarType>
+void CSysSolve<ScalarType>::BlockDot(const vector<const CSysVector<ScalarType>*>& x,
+                                     const vector<const CSysVector<ScalarType>*>& y, su2matrix<ScalarType>& xy) const {
+  const auto nx = x.size();
+  const auto ny = y.size();
+  const auto nDots = nx * ny;
+
+  /*--- Local sums in [0, nDots), global results in [nDots, 2 nDots). ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { block_dots.assign(2 * nDots, 0.0); }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  vector<ScalarType> sums(nDots, 0.0);
+  const auto nElm = x[0]->GetNElmDomain();
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nElm, omp_get_num_threads(), 4096))
+  for (auto i = 0ul; i < nElm; ++i) {
+    for (auto ix = 0ul; ix < nx; ++ix) {
+      const ScalarType xi = (*x[ix])[i];
+      for (auto iy = 0ul; iy < ny; ++iy) sums[ix * ny + iy] += xi * (*y[iy])[i];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  for (auto k = 0ul; k < nDots; ++k) block_dots[k] += sums[k];
+  END_SU2_OMP_CRITICAL
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Allreduce(block_dots.data(), &block_dots[nDots], nDots, mpi_type, MPI_SUM,
+                                               SU2_MPI::GetComm());
+#else
+    for (auto k = 0ul; k < nDots; ++k) block_dots[nDots + k] = block_dots[k];
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  xy.resize(nx, ny);
+  for (auto ix = 0ul; ix < nx; ++ix)
+    for (auto iy = 0ul; iy < ny; ++iy) xy(ix, iy) = block_dots[nDots + ix * ny + iy];
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -538,6 +638,249 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   return i;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long m, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool flexible = !precond.IsIdentity();
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet (same storage as FGMRES). ---*/
+
+  if (W.size() <= m || (flexible && Z.size() <= m)) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (flexible) {
+        Z.resize(m + 1);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Small arrays are private to each thread, see FGMRES. Hraw keeps the Hessenberg matrix before
+   *    the Givens rotations, it is needed to express A * Z[k] in terms of the orthonormal basis. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m), h(m + 1), c(m + 1);
+  su2matrix<ScalarType> H(m + 1, m), Hraw(m + 1, m);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  unsigned long iter = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("Pipelined FGMRES", tol, beta);
+      WriteHistory(iter, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Threshold to detect cancellation in the norm computed from the dot products, as in ModGramSchmidt,
+   *    and tolerance on the norm of the last basis vector, to detect loss of orthogonality. ---*/
+  const ScalarType reorth = 0.98;
+  const bool single = sizeof(ScalarType) < sizeof(passivedouble);
+  const passivedouble orthTol =
+      cbrt(single ? numeric_limits<float>::epsilon() : numeric_limits<passivedouble>::epsilon());
+
+  /*--- The recurrences used to skip the synchronization lose accuracy when the new Krylov vector is almost in
+   *    the span of the basis, and orthogonality is progressively lost. When that is detected the cycle is restarted
+   *    from the true residual, which is also checked at the end of each cycle, since the Arnoldi residual estimate
+   *    is affected by the same errors. ---*/
+
+  while (true) {
+    const auto mCycle = m - iter;
+
+    g = ScalarType(0);
+    sn = ScalarType(0);
+    cs = ScalarType(0);
+    H = ScalarType(0);
+    Hraw = ScalarType(0);
+
+    W[0] /= -beta;
+    g[0] = beta;
+
+    /*--- Start the pipeline, W[i+1] holds the unnormalized A * Z[i] at the start of each iteration. ---*/
+
+    if (flexible) {
+      precond(W[0], Z[0]);
+      mat_vec(Z[0], W[1]);
+    } else {
+      mat_vec(W[0], W[1]);
+    }
+
+    bool restart = false;
+    unsigned long i = 0;
+
+    for (i = 0; i < mCycle; i++) {
+      /*---  Check if solution has converged ---*/
+
+      if (beta < tol * norm0) break;
+
+      const int n = i + 1;
+      const bool lookAhead = (i + 1 < mCycle);
+
+      /*--- Start the reduction and overlap it with the next preconditioner and product, which are applied to
+       *    the vector before orthogonalization (the results are corrected by recurrence afterwards). ---*/
+
+      StartPipelinedDots(W[i + 1], n, W);
+
+      if (lookAhead) {
+        if (flexible) {
+          precond(W[i + 1], Z[i + 1]);
+          mat_vec(Z[i + 1], W[i + 2]);
+        } else {
+          mat_vec(W[i + 1], W[i + 2]);
+        }
+      }
+
+      const ScalarType* dots = FinishPipelinedDots(n);
+
+      /*--- Classical Gram-Schmidt, with the norm obtained from the Pythagorean theorem. ---*/
+
+      ScalarType sumH2 = 0.0;
+      for (int k = 0; k < n; ++k) {
+        h[k] = dots[k];
+        sumH2 += h[k] * h[k];
+      }
+      const ScalarType norm2 = dots[n];
+
+      if ((norm2 <= 0.0) || (norm2 != norm2)) {
+        SU2_MPI::Error("Pipelined FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+
+      /*--- The norm of the basis vectors drifts away from 1 as orthogonality is lost. ---*/
+      restart = fabs(dots[n + 1] - 1) > orthTol;
+
+      for (int k = 0; k < n; ++k) W[i + 1] -= h[k] * W[k];
+
+      ScalarType nrm = sqrt(max<ScalarType>(norm2 - sumH2, 0.0));
+
+      if (sumH2 > reorth * norm2) {
+        /*--- Cancellation, do a second (blocking) pass to get an accurate norm, and restart after this step. ---*/
+        StartPipelinedDots(W[i + 1], n, W);
+        const ScalarType* dots2 = FinishPipelinedDots(n);
+        ScalarType sumP2 = 0.0;
+        for (int k = 0; k < n; ++k) {
+          h[k] += dots2[k];
+          sumP2 += dots2[k] * dots2[k];
+        }
+        nrm = sqrt(max<ScalarType>(dots2[n] - sumP2, 0.0));
+        restart = true;
+      }
+      h[n] = nrm;
+
+      for (int k = 0; k <= n; ++k) H[k][i] = Hraw[k][i] = h[k];
+
+      /*--- Also restart on (possibly false) breakdown, the true residual tells if the system was solved. ---*/
+      restart |= (nrm <= eps * sqrt(norm2));
+
+      if (!restart) {
+        W[i + 1] /= nrm;
+
+        if (lookAhead) {
+          /*--- Z[i+1] = M * W[i+1], by linearity of the preconditioner. ---*/
+          if (flexible) {
+            for (int k = 0; k < n; ++k) Z[i + 1] -= h[k] * Z[k];
+            Z[i + 1] /= nrm;
+          }
+
+          /*--- A * Z[i+1], using A * Z[k] = sum_j Hraw(j,k) W[j], j <= k+1. ---*/
+          for (int j = 0; j <= n; ++j) {
+            c[j] = 0.0;
+            for (int k = max(j - 1, 0); k < n; ++k) c[j] += Hraw[j][k] * h[k];
+            W[i + 2] -= c[j] * W[j];
+          }
+          W[i + 2] /= nrm;
+        }
+      }
+
+      /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+       new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+      for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+      GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+      ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+      beta = fabs(g[i + 1]);
+
+      if ((((monitoring) && (masterRank)) && ((iter + i + 1) % monitorFreq == 0))) {
+        SU2_OMP_MASTER
+        WriteHistory(iter + i + 1, beta / norm0);
+        END_SU2_OMP_MASTER
+      }
+
+      if (restart) {
+        i++;
+        break;
+      }
+    }
+
+    /*---  Solve the least-squares system and update solution ---*/
+
+    SolveReduced(i, H, g, y);
+
+    const auto& basis = flexible ? Z : W;
+    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+
+    iter += i;
+
+    /*--- True (negative) residual. ---*/
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    beta = W[0].norm();
+
+    if ((beta < tol * norm0) || (iter >= m) || (i == 0)) break;
+  }
+
+  if ((monitoring) && (masterRank) && (config->GetComm_Level() == COMM_FULL)) {
+    SU2_OMP_MASTER
+    WriteFinalResidual("Pipelined FGMRES", iter, beta / norm0);
+    END_SU2_OMP_MASTER
+  }
+
+  residual = beta / norm0;
+  return iter;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -564,6 +907,402 @@ unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarTy
   return 0;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::GCRODR_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                      const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                      const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                      unsigned long m, ScalarType& residual, bool monitoring,
+                                                      const CConfig* config, bool newMatrix) {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool flexible = !precond.IsIdentity();
+  const unsigned long kMax = config->GetLinear_Solver_Recycle_Size();
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("GCRODR subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the recycled subspace is discarded if the size of the system changes. ---*/
+
+  if (W.size() <= m || (flexible && Z.size() <= m)) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (flexible) {
+        Z.resize(m + 1);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  if (RecU.size() != kMax || (kMax > 0 && RecU[0].GetLocSize() != x.GetLocSize())) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto* rec : {&RecU, &RecC, &RecUv}) {
+        rec->resize(kMax);
+        for (auto& v : *rec) v.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+      rec_size = 0;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  const auto& basis = flexible ? Z : W;
+
+  /*--- Recompute the image of the recycled subspace for the new matrix, and make it orthonormal (thin QR of
+   *    RecC, the same operations are applied to RecU and RecUv to keep RecC = A * RecU). Dependent vectors are
+   *    dropped. ---*/
+
+  unsigned long k = rec_size;
+
+  if (k > 0 && newMatrix) {
+    unsigned long kept = 0;
+    for (auto i = 0ul; i < k; ++i) {
+      mat_vec(RecU[i], RecC[i]);
+      const ScalarType norm = RecC[i].norm();
+
+      for (auto j = 0ul; j < kept; ++j) {
+        const ScalarType r_ji = RecC[j].dot(RecC[i]);
+        RecC[i] -= r_ji * RecC[j];
+        RecU[i] -= r_ji * RecU[j];
+        RecUv[i] -= r_ji * RecUv[j];
+      }
+      const ScalarType r_ii = RecC[i].norm();
+      if (r_ii <= sqrt(eps) * norm) continue;
+
+      RecC[kept] = RecC[i] / r_ii;
+      RecU[kept] = RecU[i] / r_ii;
+      RecUv[kept] = RecUv[i] / r_ii;
+      ++kept;
+    }
+    k = kept;
+  }
+
+  vector<const VectorType*> recC(k);
+  for (auto i = 0ul; i < k; ++i) recC[i] = &RecC[i];
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m), Hbar(m + 1, m), B(k, m), proj;
+  H = ScalarType(0);
+  Hbar = ScalarType(0);
+  B = ScalarType(0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual and compute its norm (W[0] holds the residual, not its negative). ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] = b - W[0];
+  } else {
+    W[0] = b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  /*--- Remove the component of the residual in the image of the recycled subspace. ---*/
+
+  if (k > 0 && beta >= eps) {
+    BlockDot(recC, {&W[0]}, proj);
+    for (auto j = 0ul; j < k; ++j) {
+      x += proj(j, 0) * RecU[j];
+      W[0] -= proj(j, 0) * RecC[j];
+    }
+    beta = W[0].norm();
+  }
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::GCRODR(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= beta;
+  g[0] = beta;
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("GCRODR", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    if (beta < tol * norm0) break;
+
+    if (flexible) {
+      precond(W[i], Z[i]);
+      mat_vec(Z[i], W[i + 1]);
+    } else {
+      mat_vec(W[i], W[i + 1]);
+    }
+
+    /*--- Deflation, orthogonalize against the image of the recycled subspace. ---*/
+
+    if (k > 0) {
+      BlockDot(recC, {&W[i + 1]}, proj);
+      for (auto j = 0ul; j < k; ++j) {
+        B(j, i) = proj(j, 0);
+        W[i + 1] -= proj(j, 0) * RecC[j];
+      }
+    }
+
+    ModGramSchmidt(false, i, H, W);
+
+    for (auto j = 0ul; j <= i + 1; ++j) Hbar(j, i) = H(j, i);
+
+    for (unsigned long j = 0; j < i; j++) ApplyGivens(sn[j], cs[j], H[j][i], H[j + 1][i]);
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    beta = fabs(g[i + 1]);
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*---  Solve the least-squares system and update the solution, x += Z y - RecU B y. ---*/
+
+  SolveReduced(i, H, g, y);
+
+  for (unsigned long j = 0; j < i; j++) x += y[j] * basis[j];
+
+  for (auto j = 0ul; j < k; ++j) {
+    ScalarType By = 0.0;
+    for (auto l = 0ul; l < i; ++l) By += B(j, l) * y[l];
+    x -= By * RecU[j];
+  }
+
+  /*--- Update the recycled subspace for the next call. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { rec_size = k; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  if (kMax > 0 && i > 0) UpdateRecycledSubspace(i, Hbar, B, basis, kMax);
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("GCRODR", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
+template <class ScalarType>
+void CSysSolve<ScalarType>::UpdateRecycledSubspace(unsigned long m, const su2matrix<ScalarType>& Hbar,
+                                                   const su2matrix<ScalarType>& B,
+                                                   const vector<CSysVector<ScalarType> >& basis, unsigned long kMax) {
+  const auto k = rec_size;
+  const auto n = k + m;
+  const auto kNew0 = min(kMax, n);
+
+  /*--- Arnoldi relation A [RecU Z] = [RecC V] G, with G = [I B; 0 Hbar], (k+m+1) x (k+m). ---*/
+
+  su2matrix<ScalarType> G(n + 1, n);
+  G = ScalarType(0);
+  for (auto i = 0ul; i < k; ++i) {
+    G(i, i) = 1.0;
+    for (auto j = 0ul; j < m; ++j) G(i, k + j) = B(i, j);
+  }
+  for (auto i = 0ul; i <= m; ++i)
+    for (auto j = 0ul; j < m; ++j) G(k + i, k + j) = Hbar(i, j);
+
+  /*--- Metric of the coefficients, S = [RecUv V]^T [RecUv V] (V is orthonormal). ---*/
+
+  su2matrix<ScalarType> S(n, n);
+  S = ScalarType(0);
+  for (auto i = k; i < n; ++i) S(i, i) = 1.0;
+
+  if (k > 0) {
+    vector<const VectorType*> uv(k), uvv(n);
+    for (auto i = 0ul; i < k; ++i) uv[i] = uvv[i] = &RecUv[i];
+    for (auto i = 0ul; i < m; ++i) uvv[k + i] = &W[i];
+
+    su2matrix<ScalarType> dots;
+    BlockDot(uvv, uv, dots);
+    for (auto i = 0ul; i < n; ++i) {
+      for (auto j = 0ul; j < k; ++j) {
+        S(i, j) = dots(i, j);
+        S(j, i) = dots(i, j);
+      }
+    }
+  }
+
+  /*--- Cholesky factorization S = L L^T (in place, lower part), if S is not positive definite (e.g. the old
+   *    subspace is contained in the new Krylov subspace) the subspace is not updated. ---*/
+
+  ScalarType maxDiag = 0.0;
+  for (auto i = 0ul; i < n; ++i) maxDiag = max(maxDiag, S(i, i));
+
+  for (auto j = 0ul; j < n; ++j) {
+    for (auto l = 0ul; l < j; ++l) S(j, j) -= S(j, l) * S(j, l);
+    if (!(S(j, j) > sqrt(eps) * maxDiag)) return;
+    S(j, j) = sqrt(S(j, j));
+    for (auto i = j + 1; i < n; ++i) {
+      for (auto l = 0ul; l < j; ++l) S(i, j) -= S(i, l) * S(j, l);
+      S(i, j) /= S(j, j);
+    }
+  }
+
+  auto forwardSolve = [&](su2matrix<ScalarType>& X) {
+    /*--- X = L^{-1} X ---*/
+    for (auto c = 0ul; c < X.cols(); ++c) {
+      for (auto i = 0ul; i < n; ++i) {
+        for (auto l = 0ul; l < i; ++l) X(i, c) -= S(i, l) * X(l, c);
+        X(i, c) /= S(i, i);
+      }
+    }
+  };
+
+  /*--- Symmetric eigenproblem L^{-1} G^T G L^{-T} q = lambda q, the eigenvectors of the smallest eigenvalues
+   *    give the coefficients of the new subspace, P = L^{-T} q. ---*/
+
+  su2matrix<ScalarType> M(n, n), Q(n, n);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto j = 0ul; j < n; ++j) {
+      ScalarType gg = 0.0;
+      for (auto l = 0ul; l <= n; ++l) gg += G(l, i) * G(l, j);
+      M(i, j) = gg;
+    }
+  }
+  forwardSolve(M);
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < i; ++j) std::swap(M(i, j), M(j, i));
+  forwardSolve(M);
+
+  su2vector<ScalarType> lambda(n), work(n);
+  CBlasStructure::EigenDecomposition(M, Q, lambda, n, work);
+
+  su2matrix<ScalarType> P(n, kNew0);
+  for (auto i = n; i > 0;) {
+    --i;
+    for (auto c = 0ul; c < kNew0; ++c) {
+      ScalarType p = Q(i, c);
+      for (auto l = i + 1; l < n; ++l) p -= S(l, i) * P(l, c);
+      P(i, c) = p / S(i, i);
+    }
+  }
+
+  /*--- Thin QR of G P, the new image is [RecC V] Qs and the new subspace [RecU Z] P Rs^{-1}. ---*/
+
+  su2matrix<ScalarType> Qs(n + 1, kNew0), Rs(kNew0, kNew0);
+  Rs = ScalarType(0);
+  for (auto i = 0ul; i <= n; ++i) {
+    for (auto c = 0ul; c < kNew0; ++c) {
+      ScalarType gp = 0.0;
+      for (auto l = 0ul; l < n; ++l) gp += G(i, l) * P(l, c);
+      Qs(i, c) = gp;
+    }
+  }
+
+  auto kNew = kNew0;
+  for (auto c = 0ul; c < kNew0; ++c) {
+    ScalarType norm = 0.0;
+    for (auto i = 0ul; i <= n; ++i) norm += pow(Qs(i, c), 2);
+    for (auto l = 0ul; l < c; ++l) {
+      ScalarType r = 0.0;
+      for (auto i = 0ul; i <= n; ++i) r += Qs(i, l) * Qs(i, c);
+      for (auto i = 0ul; i <= n; ++i) Qs(i, c) -= r * Qs(i, l);
+      Rs(l, c) = r;
+    }
+    ScalarType r_cc = 0.0;
+    for (auto i = 0ul; i <= n; ++i) r_cc += pow(Qs(i, c), 2);
+    r_cc = sqrt(r_cc);
+    if (!(r_cc > sqrt(eps * norm))) {
+      kNew = c;
+      break;
+    }
+    Rs(c, c) = r_cc;
+    for (auto i = 0ul; i <= n; ++i) Qs(i, c) /= r_cc;
+  }
+  if (kNew == 0) return;
+
+  su2matrix<ScalarType> X(n, kNew);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto c = 0ul; c < kNew; ++c) {
+      ScalarType xc = P(i, c);
+      for (auto l = 0ul; l < c; ++l) xc -= X(i, l) * Rs(l, c);
+      X(i, c) = xc / Rs(c, c);
+    }
+  }
+
+  /*--- Form the new vectors in place, element by element. ---*/
+
+  const auto nElm = RecU[0].GetLocSize();
+  vector<ScalarType> oldU(k), oldC(k), oldUv(k);
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nElm, omp_get_num_threads(), 4096))
+  for (auto e = 0ul; e < nElm; ++e) {
+    for (auto i = 0ul; i < k; ++i) {
+      oldU[i] = RecU[i][e];
+      oldC[i] = RecC[i][e];
+      oldUv[i] = RecUv[i][e];
+    }
+    for (auto c = 0ul; c < kNew; ++c) {
+      ScalarType u = 0.0, cc = 0.0, uv = 0.0;
+      for (auto i = 0ul; i < k; ++i) {
+        u += X(i, c) * oldU[i];
+        cc += Qs(i, c) * oldC[i];
+        uv += X(i, c) * oldUv[i];
+      }
+      for (auto i = 0ul; i < m; ++i) {
+        u += X(k + i, c) * basis[i][e];
+        uv += X(k + i, c) * W[i][e];
+      }
+      for (auto i = 0ul; i <= m; ++i) cc += Qs(k + i, c) * W[i][e];
+      RecU[c][e] = u;
+      RecC[c][e] = cc;
+      RecUv[c][e] = uv;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { rec_size = kNew; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -946,6 +1685,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     HandleTemporariesIn(LinSysRes, LinSysSol);
 
+    Jacobian.BuildSlicedMatrix();
+
     auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
     const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(KindPrecond);
@@ -969,10 +1710,19 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                       ScreenOutput, config);
         break;
+      case PIPELINED_FGMRES:
+        IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                       ScreenOutput, config);
+        break;
       case RESTARTED_FGMRES:
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case GCRODR:
+        /*--- The image of the recycled subspace is only recomputed if the matrix changed. ---*/
+        IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config, !sameMatrix);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
@@ -995,6 +1745,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     SU2_OMP_MASTER {
       Residual = residual;
       Iterations = IterLinSol;
+      sameMatrix = false;
     }
     END_SU2_OMP_MASTER
 
@@ -1002,6 +1753,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     delete precond;
 
+    Jacobian.InvalidateSlicedMatrix();
+
     if (TapeActive) {
       /*--- To keep the behavior of SU2_DOT, but not strictly required since jacobian is symmetric(?). ---*/
       const bool RequiresTranspose =
@@ -1022,12 +1775,16 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case ILU:
           if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
           break;
+        case AMG:
+          /*--- The aggregation is kept, only the coarse operators are recomputed. ---*/
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+          break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
           break;
         case LU_SGS:
-          /*--- Nothing to build. ---*/
+          if (RequiresTranspose) Jacobian.BuildLU_SGSPreconditioner();
           break;
         case PASTIX_ILU:
         case PASTIX_LU_P:
@@ -1110,6 +1867,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
     precond->Build();
   }
 
+  Jacobian.BuildSlicedMatrix();
+
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
   /*--- Solve the system ---*/
@@ -1121,9 +1880,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
 
   switch (KindSolver) {
     case FGMRES:
+    case GCRODR: /*--- The recycled subspace is for the primal system. ---*/
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                     ScreenOutput, config);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                     ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
@@ -1156,6 +1920,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
 
   delete precond;
 
+  Jacobian.InvalidateSlicedMatrix();
+
   SU2_OMP_MASTER {
     Residual = residual;
     Iterations = IterLinSol;
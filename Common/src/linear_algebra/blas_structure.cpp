@@ -101,6 +101,64 @@ void CBlasStructure::gemm(const int M, const int N, const int K, const su2double
 #endif
 }
 
+/* Batch of dense matrix multiplications of the same size. */
+void CBlasStructure::gemm_batched(const int M, const int N, const int K, const int nBatch, const su2double* A,
+                                  const long strideA, const su2double* B, const long strideB, su2double* C,
+                                  const long strideC, const CConfig* config) {
+  /* Initialize the variable for the timing, if profiling is active. */
+#ifdef PROFILE
+  double timeGemm;
+  if (config) config->GEMM_Tick(&timeGemm);
+#endif
+
+#if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || \
+    !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
+  /* Native implementation of the matrix products. See gemm for the
+     swapping of the arguments. */
+  for (int i = 0; i < nBatch; ++i) gemm_imp(N, M, K, B + i * strideB, A + i * strideA, C + i * strideC);
+
+#else
+#ifdef HAVE_LIBXSMM
+
+  /* The JIT kernel of libxsmm for this matrix size is dispatched only once
+     for the entire batch, which avoids the overhead of the dispatch in every
+     call of libxsmm_dgemm. As for gemm the matrices are in column major order.
+     If no kernel could be generated, libxsmm_dgemm is used. The default
+     beta of libxsmm is 1, hence alpha and beta must be given explicitly. */
+  const double alpha = 1.0, beta = 0.0;
+  const libxsmm_dmmfunction kernel =
+      libxsmm_dmmdispatch(N, M, K, nullptr, nullptr, nullptr, &alpha, &beta, nullptr, nullptr);
+
+  if (kernel) {
+    for (int i = 0; i < nBatch; ++i) kernel(B + i * strideB, A + i * strideA, C + i * strideC);
+  } else {
+    char trans = 'N';
+
+    for (int i = 0; i < nBatch; ++i)
+      libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B + i * strideB, &N, A + i * strideA, &K, &beta,
+                    C + i * strideC, &N);
+  }
+
+#else  // MKL and BLAS
+
+  /* The standard blas routine dgemm is used for every matrix product of the batch. */
+  su2double alpha = 1.0;
+  su2double beta = 0.0;
+  char trans = 'N';
+
+  for (int i = 0; i < nBatch; ++i)
+    dgemm_(&trans, &trans, &N, &M, &K, &alpha, B + i * strideB, &N, A + i * strideA, &K, &beta, C + i * strideC, &N);
+
+#endif
+#endif
+
+  /* Store the profiling information, if needed. The batch is stored as one
+     matrix product with nBatch*N columns, such that the flop count is correct. */
+#ifdef PROFILE
+  if (config) config->GEMM_Tock(timeGemm, M, nBatch * N, K);
+#endif
+}
+
 /* Dense matrix vector multiplication, gemv functionality. */
 void CBlasStructure::gemv(const int M, const int N, const su2double* A, const su2double* x, su2double* y) {
 #if (defined(HAVE_BLAS) || defined(HAVE_MKL)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
@@ -170,9 +228,39 @@ void CBlasStructure::gemm_imp(const int m, const int n, const int k, const su2do
    Handle ragged edges with calls to a slow but general function. */
 void CBlasStructure::gemm_inner(int m, int n, int k, const su2double* a, int lda, const su2double* b, int ldb,
                                 su2double* c, int ldc) {
-  /* Carry out the multiplication for this block. At the
-     moment simply a call to gemm_arbitrary. */
-  gemm_arbitrary(m, n, k, a, lda, b, ldb, c, ldc);
+  /* Size of the tiles of c computed by the microkernel. The number of rows of
+     c corresponds to N of the row major interface, which is for the DG solver
+     the padded number of variables and hence a multiple of 8 for most cases. */
+  constexpr int MR = 8;
+  constexpr int NR = 4;
+
+  const int mFull = m - m % MR;
+  const int nFull = n - n % NR;
+  const int nRem = n - nFull;
+
+  /* Loop over the full row blocks of c and carry out the multiplication with
+     the microkernel. The remaining columns are treated with a specialization
+     of the microkernel for a smaller number of columns. */
+  for (int i = 0; i < mFull; i += MR) {
+    for (int j = 0; j < nFull; j += NR) gemm_micro<MR, NR>(k, &A(i, 0), lda, &B(0, j), ldb, &C(i, j), ldc);
+
+    switch (nRem) {
+      case 1:
+        gemm_micro<MR, 1>(k, &A(i, 0), lda, &B(0, nFull), ldb, &C(i, nFull), ldc);
+        break;
+      case 2:
+        gemm_micro<MR, 2>(k, &A(i, 0), lda, &B(0, nFull), ldb, &C(i, nFull), ldc);
+        break;
+      case 3:
+        gemm_micro<MR, 3>(k, &A(i, 0), lda, &B(0, nFull), ldb, &C(i, nFull), ldc);
+        break;
+      default:
+        break;
+    }
+  }
+
+  /* Handle the ragged edge of the remaining rows with the general function. */
+  if (mFull < m) gemm_arbitrary(m - mFull, n, k, &A(mFull, 0), lda, b, ldb, &C(mFull, 0), ldc);
 }
 
 /* Naive gemm implementation to handle arbitrary sized matrices. */
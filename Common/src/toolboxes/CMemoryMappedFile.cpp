@@ -0,0 +1,71 @@
+/*!
+ * \file CMemoryMappedFile.cpp
+ * \brief Read-only memory mapping of files.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CMemoryMappedFile.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+CMemoryMappedFile::CMemoryMappedFile(const std::string& filename) {
+#ifdef HAVE_MMAP
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat info;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    void* ptr = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr != MAP_FAILED) {
+      fileData = static_cast<const char*>(ptr);
+      fileSize = info.st_size;
+      madvise(ptr, fileSize, MADV_SEQUENTIAL);
+    }
+  }
+  /*--- The mapping stays valid after closing the descriptor. ---*/
+  close(fd);
+#endif
+}
+
+CMemoryMappedFile::~CMemoryMappedFile() {
+#ifdef HAVE_MMAP
+  if (fileData) munmap(const_cast<char*>(fileData), fileSize);
+#endif
+}
+
+void CMemoryMappedFile::Release(size_t begin, size_t end) const {
+#ifdef HAVE_MMAP
+  static const size_t pageSize = sysconf(_SC_PAGESIZE);
+  begin = (begin + pageSize - 1) / pageSize * pageSize;
+  end = end / pageSize * pageSize;
+  if (!fileData || end <= begin) return;
+  madvise(const_cast<char*>(fileData) + begin, end - begin, MADV_DONTNEED);
+#endif
+}
@@ -63,6 +63,9 @@ class CDriver : public CDriverBase {
       MpointsDomain; /*!< \brief Total number of grid points in millions in the calculation (excluding ghost points).*/
   su2double MDOFs;   /*!< \brief Total number of DOFs in millions in the calculation (including ghost points).*/
   su2double MDOFsDomain; /*!< \brief Total number of DOFs in millions in the calculation (excluding ghost points).*/
+  passivedouble HaloTime = 0.0; /*!< \brief Max. over the ranks of the time spent in the solver halo exchanges. */
+  passivedouble HaloCompression = 1.0; /*!< \brief Full precision over sent volume of the solver halo exchanges. */
+  bool HaloStatistics = false; /*!< \brief Whether the halo exchange statistics were gathered (halo compression on). */
 
   bool StopCalc,   /*!< \brief Stop computation flag.*/
       mixingplane, /*!< \brief mixing-plane simulation flag.*/
@@ -79,6 +82,11 @@ class CDriver : public CDriverBase {
   CInterface*** interface_container; /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                      /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
 
+  vector<unsigned long> imposedPartition; /*!< \brief Partitioning imposed on the next geometry preprocessing (colors
+                                             of the points of the initial linear partition), see RebalanceZone. */
+  array<passivedouble, CPartitionCosts::N_COST_TYPES>
+      rebalanceCostTimes{}; /*!< \brief Measured costs at the last check of the load balance. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -134,6 +142,17 @@ class CDriver : public CDriverBase {
    */
   void InitializeGeometryFVM(CConfig* config, CGeometry**& geometry);
 
+  /*!
+   * \brief Check the load balance from the measured costs and, if it is worse than PARMETIS_REBALANCE_THRESHOLD,
+   *        repartition the grid of a zone during the run.
+   * \note The solution (and the previous time levels) is migrated in memory to the new owners of the points, the grid,
+   *       solvers, and numerics are then preprocessed again with the new partitioning. Only for single-zone problems on
+   *       static grids, see the checks of PARMETIS_REBALANCE_FREQ.
+   * \param[in] iZone - Zone to rebalance.
+   * \return Whether the zone was repartitioned.
+   */
+  bool RebalanceZone(unsigned short iZone);
+
   /*!
    * \brief Definition of the physics iteration class or within a single zone.
    * \param[in] config - Definition of the particular problem.
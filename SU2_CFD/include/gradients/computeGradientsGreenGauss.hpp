@@ -56,11 +56,17 @@ namespace detail {
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] fieldMin - Optional, generic object implementing operator (iPoint, iVar), minimum field
+ *             values over direct neighbors of each (non-halo) point.
+ * \param[out] fieldMax - Optional, as above but maximum values.
+ * \note The min/max are the first step of computeLimiters, gathering them here avoids reading the
+ *       neighbor values twice (see the "minMaxComputed" argument of computeLimiters).
  */
-template <size_t nDim, class FieldType, class GradientType>
+template <size_t nDim, class FieldType, class GradientType, class MinMaxType>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient,
+                                MinMaxType* fieldMin, MinMaxType* fieldMax) {
   const size_t nPointDomain = geometry.GetnPointDomain();
 
 #ifdef HAVE_OMP
@@ -71,6 +77,8 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
 
   static constexpr size_t MAXNVAR = 20;
 
+  const bool minMax = (fieldMin != nullptr) && (fieldMax != nullptr);
+
   /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
@@ -89,6 +97,11 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
       for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) = 0.0;
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        (*fieldMax)(iPoint, iVar) = (*fieldMin)(iPoint, iVar) = field(iPoint, iVar);
+    }
+
     /*--- Handle averaging and division by volume in one constant. ---*/
 
     su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
@@ -113,12 +126,24 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
         su2double flux = weight * (field(iPoint, iVar) + field(jPoint, iVar));
 
         for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) += flux * area[iDim];
+
+        if (minMax) {
+          (*fieldMax)(iPoint, iVar) = max((*fieldMax)(iPoint, iVar), field(jPoint, iVar));
+          (*fieldMin)(iPoint, iVar) = min((*fieldMin)(iPoint, iVar), field(jPoint, iVar));
+        }
       }
     }
 
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
       for (size_t iDim = 0; iDim < nDim; ++iDim) AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccOut((*fieldMax)(iPoint, iVar));
+        AD::SetPreaccOut((*fieldMin)(iPoint, iVar));
+      }
+    }
+
     AD::EndPreacc();
   }
   END_SU2_OMP_FOR
@@ -187,18 +212,19 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
  * \brief Instantiations for 2D and 3D.
  * \ingroup FvmAlgos
  */
-template <class FieldType, class GradientType>
+template <class FieldType, class GradientType, class MinMaxType = su2activematrix>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient,
+                                MinMaxType* fieldMin = nullptr, MinMaxType* fieldMax = nullptr) {
   switch (geometry.GetnDim()) {
     case 2:
       detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
-                                            varEnd, idxVel, gradient);
+                                            varEnd, idxVel, gradient, fieldMin, fieldMax);
       break;
     case 3:
       detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
-                                            varEnd, idxVel, gradient);
+                                            varEnd, idxVel, gradient, fieldMin, fieldMax);
       break;
     default:
       SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
@@ -179,8 +179,11 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] idxVel - Index to velocity, -1 if no velocity is present in the solver.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[out] fieldMin - Optional, generic object implementing operator (iPoint, iVar), minimum field
+ *             values over direct neighbors of each (non-halo) point.
+ * \param[out] fieldMax - Optional, as above but maximum values.
  */
-template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType, class MinMaxType>
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -192,9 +195,12 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const size_t varEnd,
                                   const int idxVel,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  MinMaxType* fieldMin,
+                                  MinMaxType* fieldMax)
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
+  const bool minMax = (fieldMin != nullptr) && (fieldMax != nullptr);
 
   const size_t nPointDomain = geometry.GetnPointDomain();
 
@@ -230,6 +236,10 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t jDim = 0; jDim < nDim; ++jDim)
         Rmatrix(iPoint, iDim, jDim) = 0.0;
 
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        (*fieldMax)(iPoint,iVar) = (*fieldMin)(iPoint,iVar) = field(iPoint,iVar);
+    }
 
     for (auto jPoint : nodes->GetPoints(iPoint))
     {
@@ -273,6 +283,22 @@ void computeGradientsLeastSquares(CSolver* solver,
             gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
         }
       }
+
+      /*--- Min/max over the neighbors (coincident points included, hence outside the weight check). ---*/
+
+      if (minMax) {
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          (*fieldMax)(iPoint,iVar) = max((*fieldMax)(iPoint,iVar), field(jPoint,iVar));
+          (*fieldMin)(iPoint,iVar) = min((*fieldMin)(iPoint,iVar), field(jPoint,iVar));
+        }
+      }
+    }
+
+    if (minMax) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        AD::SetPreaccOut((*fieldMax)(iPoint,iVar));
+        AD::SetPreaccOut((*fieldMin)(iPoint,iVar));
+      }
     }
 
     if (periodic)
@@ -336,7 +362,7 @@ void computeGradientsLeastSquares(CSolver* solver,
  * \brief Instantiations for 2D and 3D.
  * \ingroup FvmAlgos
  */
-template<class FieldType, class GradientType, class RMatrixType>
+template<class FieldType, class GradientType, class RMatrixType, class MinMaxType = su2activematrix>
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -348,15 +374,19 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const size_t varEnd,
                                   const int idxVel,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix) {
+                                  RMatrixType& Rmatrix,
+                                  MinMaxType* fieldMin = nullptr,
+                                  MinMaxType* fieldMax = nullptr) {
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix,
+                                            fieldMin, fieldMax);
     break;
   case 3:
     detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix,
+                                            fieldMin, fieldMax);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
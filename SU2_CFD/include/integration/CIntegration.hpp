@@ -33,6 +33,7 @@
 
 #include "../solvers/CSolver.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/geometry/CPartitionCosts.hpp"
 #include "../../../Common/include/CConfig.hpp"
 
 using namespace std;
@@ -49,6 +50,9 @@ protected:
   int rank,      /*!< \brief MPI Rank. */
   size;          /*!< \brief MPI Size. */
 
+  array<passivedouble, CPartitionCosts::N_COST_TYPES> costTimes{}; /*!< \brief Time spent on each type of work
+                                              of the fine grid, see PARMETIS_CALIBRATION and PARMETIS_REBALANCE_FREQ. */
+
   /*!
    * \brief Do the space integration of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -85,6 +89,12 @@ public:
    */
   virtual ~CIntegration(void) = default;
 
+  /*!
+   * \brief Get the time spent on each type of work of the fine grid (measured for PARMETIS_CALIBRATION or
+   *        PARMETIS_REBALANCE_FREQ).
+   */
+  inline const array<passivedouble, CPartitionCosts::N_COST_TYPES>& GetCostTimes() const { return costTimes; }
+
   /*!
    * \brief Save the geometry at different time steps.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -63,8 +63,9 @@ public:
 #endif
 
 private:
-  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built. ---*/
-  enum class ResEvalType {EXPLICIT, DEFAULT};
+  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built,
+   * and no Jacobian (but with time step) when the Jacobian of a previous iteration is reused. ---*/
+  enum class ResEvalType {EXPLICIT, NO_JACOBIAN, DEFAULT};
 
   bool setup = false;
   Scalar finDiffStepND = 0.0;
@@ -90,6 +91,18 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- The Jacobian and preconditioner can be reused for at most maxJacobianAge iterations, they are
+   * updated earlier if the linear iterations increase, or the nonlinear residual drop decreases, by more
+   * than reuseTolerance relative to the iterations that followed the last update. ---*/
+  unsigned short maxJacobianAge = 0;
+  su2double reuseTolerance = 1.0;
+  bool updateJacobian = true;
+  unsigned long jacobianAge = 0;
+  unsigned long jacobianUpdates = 0;
+  unsigned long refLinearIters = 0;
+  su2double refResidualDrop = 0.0;
+  su2double lastResidual = 0.0;
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -181,6 +194,13 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Decide whether the Jacobian should be updated in the next iteration.
+   * \param[in] linearIters - Iterations of the linear solver in this iteration.
+   * \param[in] residual - Nonlinear residual (log10) at the start of this iteration.
+   */
+  void UpdateJacobianReusePolicy(unsigned long linearIters, su2double residual);
+
 public:
   /*!
    * \brief Constructor.
@@ -54,6 +54,8 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] minMaxComputed - fieldMin/Max were gathered with the gradients (see computeGradientsGreenGauss),
+ *            only the projections are computed here. Not compatible with periodicity.
  *
  * Template parameters:
  * \param nDim - Number of dimensions.
@@ -74,7 +76,8 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool minMaxComputed)
 {
   constexpr size_t MAXNVAR = 32;
 
@@ -91,6 +94,9 @@ void computeLimiters_impl(CSolver* solver,
                         (kindPeriodicComm1 != PERIODIC_NONE) &&
                         (config.GetnMarker_Periodic() > 0);
 
+  if (periodic && minMaxComputed)
+    SU2_MPI::Error("The min/max cannot be computed with the gradients when there is periodicity.", CURRENT_FUNCTION);
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
@@ -141,7 +147,7 @@ void computeLimiters_impl(CSolver* solver,
     {
       AD::SetPreaccIn(field(iPoint,iVar));
 
-      if (periodic) {
+      if (periodic || minMaxComputed) {
         /*--- Started outside loop, so counts as input. ---*/
         AD::SetPreaccIn(fieldMax(iPoint,iVar));
         AD::SetPreaccIn(fieldMin(iPoint,iVar));
@@ -189,6 +195,8 @@ void computeLimiters_impl(CSolver* solver,
         projMax[iVar] = max(projMax[iVar], proj);
         projMin[iVar] = min(projMin[iVar], proj);
 
+        if (minMaxComputed) continue;
+
         AD::SetPreaccIn(field(jPoint,iVar));
 
         fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
@@ -37,6 +37,7 @@
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
 
 class CElement;
+class CFEAElementBatch;
 class CFluidModel;
 
 /*!
@@ -1434,6 +1435,30 @@ public:
    */
   inline virtual void Compute_NodalStress_Term(CElement *element_container, const CConfig* config) { }
 
+  /*!
+   * \brief A virtual member to check if the tangent matrix can be computed for batches of elements.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if Compute_Tangent_Matrix_Batch is implemented for the problem.
+   */
+  inline virtual bool Supports_Tangent_Batch(const CConfig* config) const { return false; }
+
+  /*!
+   * \brief A virtual member to load an element into a lane of a batch (see CFEAElementBatch).
+   * \param[in,out] batch - Batch of elements.
+   * \param[in] iLane - Lane of the batch.
+   * \param[in] element_container - Element structure, with its coordinates and properties set.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Set_Batch_Element(CFEAElementBatch& batch, unsigned short iLane,
+                                        CElement *element_container, const CConfig* config) { }
+
+  /*!
+   * \brief A virtual member to compute the tangent matrix and the nodal stress term of a batch of elements.
+   * \param[in,out] batch - Batch of elements.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Compute_Tangent_Matrix_Batch(CFEAElementBatch& batch, const CConfig* config) { }
+
   /*!
    * \brief Set the element-based local Young's modulus in mesh problems
    * \param[in] iElem - Element index.
@@ -29,6 +29,7 @@
 
 #include "../CNumerics.hpp"
 #include "../../../../Common/include/geometry/elements/CElement.hpp"
+#include "CFEAElementBatch.hpp"
 
 /*!
  * \class CFEAElasticity
@@ -176,6 +177,16 @@ public:
    */
   inline su2double Compute_Averaged_NodalStress(CElement *element_container, const CConfig *config) override { return 0; };
 
+  /*!
+   * \brief Set the properties of an element, compute its gradients, and load it into a lane of a batch.
+   * \param[in,out] batch - Batch of elements.
+   * \param[in] iLane - Lane of the batch.
+   * \param[in] element_container - The finite element, with its coordinates and properties set.
+   * \param[in] config - Definition of the problem.
+   */
+  void Set_Batch_Element(CFEAElementBatch& batch, unsigned short iLane,
+                         CElement *element_container, const CConfig *config) final;
+
   /*!
    * \brief Compute VonMises stress from components Sxx Syy Sxy Szz Sxz Syz.
    */
@@ -0,0 +1,203 @@
+/*!
+ * \file CFEAElementBatch.hpp
+ * \brief Structure-of-arrays buffer used to evaluate the tangent matrix
+ *        of a SIMD-width batch of finite elements at once.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../../Common/include/geometry/elements/CElement.hpp"
+
+/*!
+ * \class CFEAElementBatch
+ * \ingroup Elasticity_Equations
+ * \brief Element data of a batch of elements of the same kind, one element per SIMD lane.
+ * \note The shape function gradients are computed element by element (by CElement) and
+ *       packed into the batch, the integration of the tangent matrix, which is the expensive
+ *       part, is then vectorized across elements by the numerics classes that support it
+ *       (see CNumerics::Compute_Tangent_Matrix_Batch). Unused lanes are padded with
+ *       copies of the first one, their results are not meaningful.
+ */
+class CFEAElementBatch {
+public:
+  using Double = simd::Array<su2double>;
+  enum : size_t {SIZE = Double::Size};  /*!< \brief Number of elements in a batch. */
+  enum : unsigned short {MAXNNODE = 8, MAXNGAUSS = 8, MAXNDIM = 3};
+
+  /*!
+   * \brief Lightweight view of the results of one lane, with the same accessors as CElement.
+   */
+  class CLane {
+    const CFEAElementBatch& batch;
+    const size_t iLane;
+
+    struct CBlock {
+      const Double* ptr;
+      size_t iLane;
+      FORCEINLINE su2double operator[] (size_t i) const { return ptr[i][iLane]; }
+    };
+
+  public:
+    CLane(const CFEAElementBatch& b, size_t l) : batch(b), iLane(l) {}
+
+    FORCEINLINE CBlock Get_Kab(unsigned short a, unsigned short b) const { return {batch.Kab[a][b], iLane}; }
+    FORCEINLINE su2double Get_Ks_ab(unsigned short a, unsigned short b) const { return batch.Ks_ab[a][b][iLane]; }
+    FORCEINLINE CBlock Get_Kt_a(unsigned short a) const { return {batch.Kt_a[a], iLane}; }
+  };
+
+  unsigned short nDim = 0;     /*!< \brief Number of dimensions of the problem. */
+  unsigned short nNodes = 0;   /*!< \brief Number of nodes of the elements. */
+  unsigned short nGauss = 0;   /*!< \brief Number of integration points of the elements. */
+
+  /*--- Inputs. ---*/
+  Double E, Nu;                                     /*!< \brief Young's modulus and Poisson ratio. */
+  Double RefCoord[MAXNNODE][MAXNDIM];               /*!< \brief Coordinates in the reference frame. */
+  Double CurrCoord[MAXNNODE][MAXNDIM];              /*!< \brief Coordinates in the current frame. */
+  Double Weight[MAXNGAUSS];                         /*!< \brief Gauss weight times reference Jacobian. */
+  Double GradNi_X[MAXNGAUSS][MAXNNODE][MAXNDIM];    /*!< \brief Shape function gradients (reference frame). */
+
+  /*--- Outputs. ---*/
+  Double Kab[MAXNNODE][MAXNNODE][MAXNDIM*MAXNDIM];  /*!< \brief Constitutive component of the tangent matrix. */
+  Double Ks_ab[MAXNNODE][MAXNNODE];                 /*!< \brief Stress component of the tangent matrix. */
+  Double Kt_a[MAXNNODE][MAXNDIM];                   /*!< \brief Nodal stress terms for the residual. */
+
+  /*!
+   * \brief Copy the data of an element into a lane.
+   * \note The gradients in the reference frame must have been computed.
+   * \param[in] iLane - Lane of the batch.
+   * \param[in] element - The finite element.
+   * \param[in] val_E - Young's modulus of the element.
+   * \param[in] val_Nu - Poisson ratio of the element.
+   */
+  void SetLane(size_t iLane, const CElement* element, su2double val_E, su2double val_Nu) {
+    nNodes = element->GetnNodes();
+    nGauss = element->GetnGaussPoints();
+
+    E[iLane] = val_E;
+    Nu[iLane] = val_Nu;
+
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        RefCoord[iNode][iDim][iLane] = element->GetRef_Coord(iNode, iDim);
+        CurrCoord[iNode][iDim][iLane] = element->GetCurr_Coord(iNode, iDim);
+      }
+    }
+    for (unsigned short iGauss = 0; iGauss < nGauss; ++iGauss) {
+      Weight[iGauss][iLane] = element->GetWeight(iGauss) * element->GetJ_X(iGauss);
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode)
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          GradNi_X[iGauss][iNode][iDim][iLane] = element->GetGradNi_X(iNode, iGauss, iDim);
+    }
+  }
+
+  /*!
+   * \brief Pad the lanes after the first nLanes with copies of the first one.
+   * \param[in] nLanes - Number of lanes in use.
+   */
+  void PadLanes(size_t nLanes) {
+    auto pad = [nLanes](Double& x) { for (auto k = nLanes; k < SIZE; ++k) x[k] = x[0]; };
+
+    pad(E);
+    pad(Nu);
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        pad(RefCoord[iNode][iDim]);
+        pad(CurrCoord[iNode][iDim]);
+      }
+    }
+    for (unsigned short iGauss = 0; iGauss < nGauss; ++iGauss) {
+      pad(Weight[iGauss]);
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode)
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          pad(GradNi_X[iGauss][iNode][iDim]);
+    }
+  }
+
+  /*!
+   * \brief Set the outputs to zero, the equivalent of CElement::ClearElement.
+   */
+  void ClearOutputs() {
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+      for (unsigned short jNode = 0; jNode < nNodes; ++jNode) {
+        for (unsigned short iVar = 0; iVar < nDim*nDim; ++iVar) Kab[iNode][jNode][iVar] = 0.0;
+        Ks_ab[iNode][jNode] = 0.0;
+      }
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) Kt_a[iNode][iDim] = 0.0;
+    }
+  }
+
+  /*!
+   * \brief Add the constitutive term of one integration point for an isotropic material
+   *        to the upper triangle (jNode >= iNode) of the tangent matrix.
+   * \note This is Ba^T.D.Bb with D defined by two Lame-like parameters, evaluated in closed
+   *       form, i.e. lambda*ga*gb^T + mu*gb*ga^T + mu*(ga.gb)*I.
+   * \param[in] GradNi - Shape function gradients at the integration point.
+   * \param[in] lambda - First parameter premultiplied by the integration weight.
+   * \param[in] mu - Second (shear) parameter premultiplied by the integration weight.
+   */
+  FORCEINLINE void AddIsotropicKab(const Double (*GradNi)[MAXNDIM], const Double& lambda, const Double& mu) {
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+      const auto ga = GradNi[iNode];
+      Double lambda_ga[MAXNDIM], mu_ga[MAXNDIM];
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        lambda_ga[iDim] = lambda * ga[iDim];
+        mu_ga[iDim] = mu * ga[iDim];
+      }
+      for (unsigned short jNode = iNode; jNode < nNodes; ++jNode) {
+        const auto gb = GradNi[jNode];
+        Double mu_dot = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) mu_dot += mu_ga[iDim] * gb[iDim];
+
+        auto K = Kab[iNode][jNode];
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+          for (unsigned short jDim = 0; jDim < nDim; ++jDim)
+            K[iDim*nDim+jDim] += lambda_ga[iDim] * gb[jDim] + mu_ga[jDim] * gb[iDim];
+          K[iDim*(nDim+1)] += mu_dot;
+        }
+      }
+    }
+  }
+
+  /*!
+   * \brief Fill the lower triangle of the tangent matrix from the upper one.
+   */
+  void SymmetrizeKab() {
+    for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+      for (unsigned short jNode = iNode+1; jNode < nNodes; ++jNode) {
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          for (unsigned short jDim = 0; jDim < nDim; ++jDim)
+            Kab[jNode][iNode][jDim*nDim+iDim] = Kab[iNode][jNode][iDim*nDim+jDim];
+        Ks_ab[jNode][iNode] = Ks_ab[iNode][jNode];
+      }
+    }
+  }
+
+  /*!
+   * \brief Get a view of the results of one lane.
+   * \param[in] iLane - Lane of the batch.
+   */
+  inline CLane GetLane(size_t iLane) const { return CLane(*this, iLane); }
+};
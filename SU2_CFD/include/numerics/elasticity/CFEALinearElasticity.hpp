@@ -67,6 +67,19 @@ public:
    */
   void Compute_Tangent_Matrix(CElement *element_container, const CConfig *config) final;
 
+  /*!
+   * \brief The tangent matrix of linear elasticity can always be computed for batches of elements.
+   * \param[in] config - Definition of the problem.
+   */
+  inline bool Supports_Tangent_Batch(const CConfig *config) const final { return true; }
+
+  /*!
+   * \brief Build the tangent stiffness matrix and the nodal stress term of a batch of elements (SIMD).
+   * \param[in,out] batch - Batch of elements.
+   * \param[in] config - Definition of the problem.
+   */
+  void Compute_Tangent_Matrix_Batch(CFEAElementBatch& batch, const CConfig *config) final;
+
   /*!
    * \brief Compute averaged nodal stresses (for post processing).
    * \param[in,out] element_container - The finite element.
@@ -53,6 +53,21 @@ public:
    */
   ~CFEM_NeoHookean_Comp(void) override = default;
 
+  /*!
+   * \brief Batches of elements are supported, except for plane stress and dielectric effects.
+   * \param[in] config - Definition of the problem.
+   */
+  inline bool Supports_Tangent_Batch(const CConfig *config) const override {
+    return !(nDim == 2 && plane_stress) && !maxwell_stress;
+  }
+
+  /*!
+   * \brief Build the tangent stiffness matrix and the nodal stress term of a batch of elements (SIMD).
+   * \param[in,out] batch - Batch of elements.
+   * \param[in] config - Definition of the problem.
+   */
+  void Compute_Tangent_Matrix_Batch(CFEAElementBatch& batch, const CConfig *config) override;
+
 private:
   /*!
    * \brief Compute the plane stress term.
@@ -29,8 +29,13 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "turbulent/turb_convection.hpp"
+#include "turbulent/turb_diffusion.hpp"
+#include "turbulent/turb_sources.hpp"
 
 namespace {
 
@@ -44,6 +49,18 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -126,6 +143,61 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Turbulence edge fluxes factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createTurbNumerics(const CConfig& config, const CVariable* flowVars, const su2double* constants) {
+  /*--- Bounded scalar convection and the NEMO primitives are not supported. ---*/
+  if (config.GetBounded_Turb() || config.GetNEMOProblem() ||
+      config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) return nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA:
+      if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+        return new CTurbUpwindScheme<CSADiffusion<nDim,true>,false>(config, flowVars);
+      return new CTurbUpwindScheme<CSADiffusion<nDim,false>,false>(config, flowVars);
+    case TURB_MODEL::SST:
+      return new CTurbUpwindScheme<CSSTDiffusion<nDim>,true>(config, flowVars, constants);
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+/*!
+ * \brief Turbulence source terms factory implementation.
+ */
+template<int nDim>
+CSourceNumericsSIMD* createTurbSource(const CConfig& config, const CVariable* flowVars, const su2double* constants,
+                                      su2double kineInf, su2double omegaInf) {
+  /*--- The transition models, and the axisymmetric and NEMO formulations are not supported. ---*/
+  if (config.GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE ||
+      config.GetAxisymmetric() || config.GetNEMOProblem()) return nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA: {
+      const auto options = config.GetSAParsedOptions();
+      if (options.comp || options.bc || config.GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) break;
+      if (options.version == SA_OPTIONS::NONE) {
+        if (options.ft2) return new CSASource<nDim,false,true>(config, flowVars);
+        return new CSASource<nDim,false,false>(config, flowVars);
+      }
+      if (options.version == SA_OPTIONS::NEG) {
+        if (options.ft2) return new CSASource<nDim,true,true>(config, flowVars);
+        return new CSASource<nDim,true,false>(config, flowVars);
+      }
+      break;
+    }
+    case TURB_MODEL::SST:
+      if (config.GetSSTParsedOptions().production == SST_OPTIONS::UQ) break;
+      return new CSSTSource<nDim>(config, flowVars, constants, kineInf, omegaInf);
+    default:
+      break;
+  }
+  return nullptr;
+}
+
 } // namespace
 
 /*!
@@ -145,3 +217,20 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                                 const su2double* constants) {
+  if (nDim == 2) return createTurbNumerics<2>(config, flowVars, constants);
+  if (nDim == 3) return createTurbNumerics<3>(config, flowVars, constants);
+
+  return nullptr;
+}
+
+CSourceNumericsSIMD* CSourceNumericsSIMD::CreateTurbSource(const CConfig& config, int nDim, const CVariable* flowVars,
+                                                           const su2double* constants, su2double kineInf,
+                                                           su2double omegaInf) {
+  if (nDim == 2) return createTurbSource<2>(config, flowVars, constants, kineInf, omegaInf);
+  if (nDim == 3) return createTurbSource<3>(config, flowVars, constants, kineInf, omegaInf);
+
+  return nullptr;
+}
@@ -97,4 +97,58 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the edge fluxes (convection and diffusion) of the turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Constants of the turbulence model (SST).
+   * \return nullptr if the options in the config are not supported.
+   */
+  static CNumericsSIMD* CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                           const su2double* constants);
+
+};
+
+/*!
+ * \class CSourceNumericsSIMD
+ * \ingroup SourceDiscr
+ * \brief Base class to define the interface of vectorized (point-wise) source terms.
+ */
+class CSourceNumericsSIMD {
+public:
+  /*!
+   * \brief Interface for source term computation.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (they are subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal).
+   */
+  virtual void ComputeSource(Int iPoint,
+                             const CConfig& config,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double updateMask,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CSourceNumericsSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the source terms of the turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Constants of the turbulence model (SST).
+   * \param[in] kineInf - Freestream k, for SST with sustaining terms.
+   * \param[in] omegaInf - Freestream w, for SST with sustaining terms.
+   * \return nullptr if the options in the config are not supported.
+   */
+  static CSourceNumericsSIMD* CreateTurbSource(const CConfig& config, int nDim, const CVariable* flowVars,
+                                               const su2double* constants, su2double kineInf, su2double omegaInf);
+
 };
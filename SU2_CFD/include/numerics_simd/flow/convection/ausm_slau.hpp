@@ -0,0 +1,700 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM+-up and SLAU-family of convective schemes.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMBase
+ * \ingroup ConvDiscr
+ * \brief Base class for the AUSM+-up and SLAU schemes, i.e. schemes of the form
+ * F = ||A|| (0.5 mdot (psi_i+psi_j) + 0.5 |mdot| (psi_i-psi_j) + N p), with psi = (1, u, H).
+ * Derived classes implement the face mass flux and pressure in a const
+ * "massAndPressureFluxes" method, and the low dissipation coefficient in "dissipation".
+ * The Jacobians are either approximated by those of the Roe scheme or computed from the
+ * derivatives of the mass flux and pressure (mirroring the scalar CUpwAUSMPLUS_SLAU_Base_Flow),
+ * by finite differences unless the derived class hides "massAndPressureDerivatives".
+ * \note See CRoeBase for the role of Base. Grid velocities are not considered (as in the scalar schemes).
+ */
+template<class Derived, class Base>
+class CAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+  static constexpr passivedouble finDiffStep = 1e-4;
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const bool useAccurateJacobian;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    useAccurateJacobian(config.GetUse_Accurate_Jacobians()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Roe-type approximation of the Jacobians (0.5*(A_i+A_j) + 0.5*|A_roe|).
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void approximateJacobian(const CPair<PrimVarType>& V,
+                                       const CPair<ConsVarType>& U,
+                                       Double area,
+                                       const VectorDbl<nDim>& normal,
+                                       const VectorDbl<nDim>& unitNormal,
+                                       MatrixDbl<nVar>& jac_i,
+                                       MatrixDbl<nVar>& jac_j) const {
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * projModJacTensor * area;
+        jac_j(iVar,jVar) -= 0.5 * projModJacTensor * area;
+      }
+    }
+  }
+
+  /*!
+   * \brief Derivatives of (u, p, rho, H) w.r.t. the conservative variables (ideal gas).
+   */
+  template<class PrimVarType>
+  FORCEINLINE MatrixDbl<nDim+3,nVar> primitiveDerivatives(const PrimVarType& V) const {
+    MatrixDbl<nDim+3,nVar> dVdU;
+    for (size_t iVar = 0; iVar < nDim+3; ++iVar)
+      for (size_t jVar = 0; jVar < nVar; ++jVar)
+        dVdU(iVar,jVar) = 0.0;
+
+    const Double oneOnRho = 1 / V.density();
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+
+    /*--- Density. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dVdU(iDim,0) = -V.velocity(iDim) * oneOnRho;
+    }
+    dVdU(nDim,0) = 0.5*(gamma-1)*sqVel;
+    dVdU(nDim+1,0) = 1.0;
+    dVdU(nDim+2,0) = (0.5*(gamma-2)*sqVel - gamma*V.pressure()/((gamma-1)*V.density())) * oneOnRho;
+
+    /*--- Momentum. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dVdU(iDim,iDim+1) = oneOnRho;
+      dVdU(nDim,iDim+1) = -(gamma-1)*V.velocity(iDim);
+      dVdU(nDim+2,iDim+1) = dVdU(nDim,iDim+1) * oneOnRho;
+    }
+
+    /*--- Energy. ---*/
+    dVdU(nDim,nDim+1) = gamma-1;
+    dVdU(nDim+2,nDim+1) = gamma * oneOnRho;
+
+    return dVdU;
+  }
+
+  /*!
+   * \brief Derivatives of the mass flux and pressure w.r.t. (u, p, rho, H) by finite differences.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureDerivatives(const CPair<PrimVarType>& V,
+                                              const VectorDbl<nDim>& unitNormal,
+                                              Double dissipation,
+                                              Double mdot,
+                                              Double pressure,
+                                              VectorDbl<nDim+3>& dmdot_dVi,
+                                              VectorDbl<nDim+3>& dmdot_dVj,
+                                              VectorDbl<nDim+3>& dpres_dVi,
+                                              VectorDbl<nDim+3>& dpres_dVj) const {
+    const auto derived = static_cast<const Derived*>(this);
+
+    /*--- The velocity, pressure, density, and enthalpy are contiguous in the primitives. ---*/
+
+    CPair<PrimVarType> Vp = V;
+
+    for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+      Double mdot_p, pressure_p;
+
+      const Double eps_i = finDiffStep * fmax(1.0, abs(V.i.all(iVar+1)));
+      Vp.i.all(iVar+1) += eps_i;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVi(iVar) = (mdot_p - mdot) / eps_i;
+      dpres_dVi(iVar) = (pressure_p - pressure) / eps_i;
+      Vp.i.all(iVar+1) = V.i.all(iVar+1);
+
+      const Double eps_j = finDiffStep * fmax(1.0, abs(V.j.all(iVar+1)));
+      Vp.j.all(iVar+1) += eps_j;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVj(iVar) = (mdot_p - mdot) / eps_j;
+      dpres_dVj(iVar) = (pressure_p - pressure) / eps_j;
+      Vp.j.all(iVar+1) = V.j.all(iVar+1);
+    }
+  }
+
+  /*!
+   * \brief Jacobians from the derivatives of the mass flux and pressure w.r.t. (u, p, rho, H),
+   * the derivatives of psi are analytical (see CUpwAUSMPLUS_SLAU_Base_Flow::AccurateJacobian).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobian(const CPair<PrimVarType>& V,
+                                    Double area,
+                                    const VectorDbl<nDim>& normal,
+                                    const VectorDbl<nDim>& unitNormal,
+                                    Double dissipation,
+                                    Double mdot,
+                                    Double pressure,
+                                    MatrixDbl<nVar>& jac_i,
+                                    MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+
+    VectorDbl<nDim+3> dmdot_dVi, dmdot_dVj, dpres_dVi, dpres_dVj;
+    derived->massAndPressureDerivatives(V, unitNormal, dissipation, mdot, pressure,
+                                        dmdot_dVi, dmdot_dVj, dpres_dVi, dpres_dVj);
+
+    /*--- Chain rule to obtain the derivatives w.r.t. the conservatives. ---*/
+
+    const auto dVi_dUi = primitiveDerivatives(V.i);
+    const auto dVj_dUj = primitiveDerivatives(V.j);
+
+    VectorDbl<nVar> dmdot_dUi, dmdot_dUj, dpres_dUi, dpres_dUj;
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      dmdot_dUi(jVar) = 0.0;  dpres_dUi(jVar) = 0.0;
+      dmdot_dUj(jVar) = 0.0;  dpres_dUj(jVar) = 0.0;
+      for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+        dmdot_dUi(jVar) += dmdot_dVi(iVar) * dVi_dUi(iVar,jVar);
+        dpres_dUi(jVar) += dpres_dVi(iVar) * dVi_dUi(iVar,jVar);
+        dmdot_dUj(jVar) += dmdot_dVj(iVar) * dVj_dUj(iVar,jVar);
+        dpres_dUj(jVar) += dpres_dVj(iVar) * dVj_dUj(iVar,jVar);
+      }
+    }
+
+    /*--- Upwind side (assuming the dissipation is |mdot|), selected per lane. ---*/
+
+    const Double upw_i = mdot > 0.0;
+    const Double upw_j = 1 - upw_i;
+    const Double mdotHat = area * mdot * (upw_i / V.i.density() + upw_j / V.j.density());
+
+    VectorDbl<nVar> psiHat;
+    psiHat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psiHat(iDim+1) = area * (upw_i * V.i.velocity(iDim) + upw_j * V.j.velocity(iDim));
+    }
+    psiHat(nDim+1) = area * (upw_i * V.i.enthalpy() + upw_j * V.j.enthalpy());
+
+    /*--- Mass flux and pressure contributions. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psiHat(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psiHat(iVar) * dmdot_dUj(jVar);
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dUj(jVar);
+      }
+    }
+
+    /*--- Derivatives of psi (upwind side only). ---*/
+
+    auto psiDerivatives = [&](const PrimVarType& Vk, const MatrixDbl<nDim+3,nVar>& dVk_dUk,
+                              Double weight, MatrixDbl<nVar>& jac) {
+      const Double w = weight * mdotHat;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(iDim+1,0) -= w * Vk.velocity(iDim);
+        jac(iDim+1,iDim+1) += w;
+        jac(nDim+1,iDim+1) -= w * (gamma-1) * Vk.velocity(iDim);
+      }
+      /*--- dH/drho, see primitiveDerivatives. ---*/
+      jac(nDim+1,0) += w * dVk_dUk(nDim+2,0) * Vk.density();
+      jac(nDim+1,nDim+1) += w * gamma;
+    };
+    psiDerivatives(V.i, dVi_dUi, upw_i, jac_i);
+    psiDerivatives(V.j, dVj_dUj, upw_j, jac_j);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the AUSM-type flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass flux and pressure defined by the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    const Double dissipation = derived->dissipation(iPoint, jPoint, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                             0.5*absMdot*(V.i.velocity(iDim) - V.j.velocity(iDim)) +
+                             unitNormal(iDim)*pressure);
+    }
+    flux(nDim+1) = area * (0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) +
+                           0.5*absMdot*(V.i.enthalpy() - V.j.enthalpy()));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (useAccurateJacobian) {
+        accurateJacobian(V, area, normal, unitNormal, dissipation, mdot, pressure, jac_i, jac_j);
+      }
+      else {
+        CPair<CCompressibleConservatives<nDim> > U;
+        U.i = compressibleConservatives(V.i);
+        U.j = compressibleConservatives(V.j);
+        approximateJacobian(V, U, area, normal, unitNormal, jac_i, jac_j);
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+-up scheme (Liou 2006), see CUpwAUSMPLUSUP_Flow.
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CAUSMBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double mInf;
+  const su2double kp = 0.25;
+  const su2double ku = 0.75;
+  const su2double sigma = 1.0;
+  const passivedouble beta = 1.0/8.0;
+
+  /*!
+   * \brief Intermediate quantities of the face mass flux and pressure, needed by their derivatives.
+   */
+  struct CFaceQuantities {
+    Double projVel_i, projVel_j, astarL, astarR, ahatL, ahatR, aF, mL, mR, MFsq, Mrefsq, fa, alpha;
+    Double mLP, betaLP, mRM, betaRM, rhoF, Mp, Pu, mF;
+  };
+
+  /*!
+   * \brief Compute the intermediate quantities, the polynomial splittings are blended per lane.
+   */
+  template<class PrimVarType>
+  FORCEINLINE CFaceQuantities faceQuantities(const CPair<PrimVarType>& V, const VectorDbl<nDim>& unitNormal) const {
+    CFaceQuantities q;
+    q.projVel_i = dot(V.i.velocity(), unitNormal);
+    q.projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound. ---*/
+
+    q.astarL = sqrt(2*(gamma-1)/(gamma+1) * V.i.enthalpy());
+    q.astarR = sqrt(2*(gamma-1)/(gamma+1) * V.j.enthalpy());
+
+    q.ahatL = q.astarL*q.astarL / fmax(q.astarL, q.projVel_i);
+    q.ahatR = q.astarR*q.astarR / fmax(q.astarR, -q.projVel_j);
+
+    q.aF = fmin(q.ahatL, q.ahatR);
+
+    /*--- Left and right pressure functions and Mach numbers. ---*/
+
+    q.mL = q.projVel_i / q.aF;
+    q.mR = q.projVel_j / q.aF;
+
+    q.MFsq = 0.5*(q.mL*q.mL + q.mR*q.mR);
+    q.Mrefsq = fmin(1.0, fmax(q.MFsq, mInf*mInf));
+
+    q.fa = 2*sqrt(q.Mrefsq) - q.Mrefsq;
+
+    q.alpha = 3.0/16.0 * (-4 + 5*q.fa*q.fa);
+
+    /*--- Subsonic and supersonic splittings, m/|m| (of the scalar version) is a step function. ---*/
+
+    const Double subL = abs(q.mL) <= 1.0;
+    const Double p1L = 0.25*(q.mL+1)*(q.mL+1);
+    const Double p2L = (q.mL*q.mL-1)*(q.mL*q.mL-1);
+    q.mLP = subL*(p1L + beta*p2L) + (1-subL)*0.5*(q.mL + abs(q.mL));
+    q.betaLP = subL*(p1L*(2-q.mL) + q.alpha*q.mL*p2L) + (1-subL)*(q.mL > 0.0);
+
+    const Double subR = abs(q.mR) <= 1.0;
+    const Double p1R = 0.25*(q.mR-1)*(q.mR-1);
+    const Double p2R = (q.mR*q.mR-1)*(q.mR*q.mR-1);
+    q.mRM = subR*(-p1R - beta*p2R) + (1-subR)*0.5*(q.mR - abs(q.mR));
+    q.betaRM = subR*(p1R*(2+q.mR) - q.alpha*q.mR*p2R) + (1-subR)*(q.mR < 0.0);
+
+    /*--- Pressure and velocity diffusion terms. ---*/
+
+    q.rhoF = 0.5*(V.i.density() + V.j.density());
+    q.Mp = -(kp/q.fa) * fmax(1-sigma*q.MFsq, 0.0) * (V.j.pressure()-V.i.pressure()) / (q.rhoF*q.aF*q.aF);
+
+    q.Pu = -ku*q.fa*q.betaLP*q.betaRM*2*q.rhoF*q.aF*(q.projVel_j-q.projVel_i);
+
+    q.mF = q.mLP + q.mRM + q.Mp;
+    return q;
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    mInf(config.GetMach()) {
+    if (mInf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief No low dissipation.
+   */
+  FORCEINLINE Double dissipation(Int, Int, const CEulerVariable&) const { return 1.0; }
+
+  /*!
+   * \brief Face mass flux (per unit area) and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const auto q = faceQuantities(V, unitNormal);
+
+    mdot = q.aF * (fmax(q.mF, 0.0)*V.i.density() + fmin(q.mF, 0.0)*V.j.density());
+
+    pressure = q.betaLP*V.i.pressure() + q.betaRM*V.j.pressure() + q.Pu;
+  }
+
+  /*!
+   * \brief Analytical derivatives of the mass flux and pressure w.r.t. (u, p, rho, H), reverse
+   * differentiation of "massAndPressureFluxes" (see CUpwAUSMPLUSUP_Flow::ComputeMassAndPressureFluxes),
+   * the branches of the scalar version are masks.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureDerivatives(const CPair<PrimVarType>& V,
+                                              const VectorDbl<nDim>& unitNormal,
+                                              Double,
+                                              Double,
+                                              Double,
+                                              VectorDbl<nDim+3>& dmdot_dVi,
+                                              VectorDbl<nDim+3>& dmdot_dVj,
+                                              VectorDbl<nDim+3>& dpres_dVi,
+                                              VectorDbl<nDim+3>& dpres_dVj) const {
+    const auto q = faceQuantities(V, unitNormal);
+
+    /*--- Limited mean Mach number (used in division). ---*/
+    const Double MF = fmax(std::numeric_limits<passivedouble>::epsilon(), sqrt(q.MFsq));
+
+    const Double diffusion = sigma*q.MFsq < 1.0;
+    const Double subL = abs(q.mL) < 1.0, supL = q.mL >= 1.0;
+    const Double subR = abs(q.mR) < 1.0, supR = q.mR <= -1.0;
+
+    for (int outVar = 0; outVar < 2; ++outVar) {
+      Double aF_b = 0.0, MF_b = 0.0, rhoF_b = 0.0, fa_b = 0.0, alpha_b = 0.0, rho_i_b = 0.0, rho_j_b = 0.0,
+             p_i_b = 0.0, p_j_b = 0.0, Vn_i_b = 0.0, Vn_j_b = 0.0, mL_b = 0.0, mR_b = 0.0;
+
+      if (outVar == 0) {
+        /*--- mdot = ... ---*/
+        const Double upw_i = q.mF > 0.0;
+        const Double rhoK = upw_i*V.i.density() + (1-upw_i)*V.j.density();
+        aF_b += q.mF*rhoK;
+        const Double mF_b = q.aF*rhoK;
+        rho_i_b += upw_i*q.mF*q.aF;
+        rho_j_b += (1-upw_i)*q.mF*q.aF;
+
+        /*--- Mp = ... ---*/
+        rhoF_b -= q.Mp/q.rhoF * mF_b;
+        fa_b -= q.Mp/q.fa * mF_b;
+        aF_b -= 2*q.Mp/q.aF * mF_b;
+        MF_b += diffusion*2*sigma*MF*(kp/q.fa)*(V.j.pressure()-V.i.pressure())/(q.rhoF*q.aF*q.aF) * mF_b;
+        const Double tmp = -diffusion*(kp/q.fa)*(1-sigma*q.MFsq)/(q.rhoF*q.aF*q.aF);
+        p_i_b -= tmp * mF_b;
+        p_j_b += tmp * mF_b;
+
+        /*--- rhoF = ... ---*/
+        rho_i_b += 0.5*rhoF_b;  rho_j_b += 0.5*rhoF_b;
+
+        /*--- mRM = ..., mLP = ... ---*/
+        mR_b += (subR*(1-q.mR)*(0.5+4*beta*q.mR*(q.mR+1)) + supR) * mF_b;
+        mL_b += (subL*(1+q.mL)*(0.5+4*beta*q.mL*(q.mL-1)) + supL) * mF_b;
+      }
+      else {
+        /*--- pressure = ... ---*/
+        Double betaLP_b = V.i.pressure(), betaRM_b = V.j.pressure();
+        p_i_b += q.betaLP;
+        p_j_b += q.betaRM;
+
+        /*--- Pu = ... ---*/
+        rhoF_b += q.Pu/q.rhoF;
+        fa_b += q.Pu/q.fa;
+        aF_b += q.Pu/q.aF;
+        Double tmp = -ku*q.fa*2*q.rhoF*q.aF*(q.projVel_j-q.projVel_i);
+        betaLP_b += tmp*q.betaRM;
+        betaRM_b += tmp*q.betaLP;
+        tmp = -ku*q.fa*q.betaLP*q.betaRM*2*q.rhoF*q.aF;
+        Vn_i_b -= tmp;
+        Vn_j_b += tmp;
+
+        /*--- rhoF = ... ---*/
+        rho_i_b += 0.5*rhoF_b;  rho_j_b += 0.5*rhoF_b;
+
+        /*--- betaRM = ... ---*/
+        tmp = q.mR*q.mR-1;
+        mR_b += subR*tmp*(0.75-q.alpha*(5*tmp+4)) * betaRM_b;
+        alpha_b -= subR*q.mR*tmp*tmp * betaRM_b;
+
+        /*--- betaLP = ... ---*/
+        tmp = q.mL*q.mL-1;
+        mL_b -= subL*tmp*(0.75-q.alpha*(5*tmp+4)) * betaLP_b;
+        alpha_b += subL*q.mL*tmp*tmp * betaLP_b;
+
+        /*--- alpha = ... ---*/
+        fa_b += 1.875*q.fa * alpha_b;
+      }
+
+      /*--- Steps shared by both. ---*/
+      /*--- fa = ... ---*/
+      const Double Mref_b = 2*(1-sqrt(q.Mrefsq)) * fa_b;
+
+      /*--- Mrefsq = ... ---*/
+      MF_b += (MF < 1.0) * (MF > mInf) * Mref_b;
+
+      /*--- MFsq = ... ---*/
+      mL_b += 0.5*q.mL/MF * MF_b;  mR_b += 0.5*q.mR/MF * MF_b;
+
+      /*--- mL/R = ... ---*/
+      Vn_i_b += mL_b/q.aF;  Vn_j_b += mR_b/q.aF;
+      aF_b -= (q.mL*mL_b + q.mR*mR_b)/q.aF;
+
+      /*--- aF, ahat, astar = f(H_i, H_j), "tmp" is astar/Vn for supersonic normal velocities. ---*/
+      const Double left = q.ahatL < q.ahatR;
+      const Double superL = q.astarL <= q.projVel_i;
+      const Double superR = q.astarR <= -q.projVel_j;
+      const Double tmpL = q.ahatL / q.astarL;
+      const Double tmpR = q.ahatR / q.astarR;
+
+      Vn_i_b -= left*superL*tmpL*tmpL * aF_b;
+      Vn_j_b += (1-left)*superR*tmpR*tmpR * aF_b;
+      const Double H_i_b = left * (1+superL*(2*tmpL-1)) * aF_b *
+                           sqrt(0.5*(gamma-1)/((gamma+1)*V.i.enthalpy()));
+      const Double H_j_b = (1-left) * (1+superR*(2*tmpR-1)) * aF_b *
+                           sqrt(0.5*(gamma-1)/((gamma+1)*V.j.enthalpy()));
+
+      /*--- Store the derivatives. ---*/
+      auto& target_i = (outVar == 0) ? dmdot_dVi : dpres_dVi;
+      auto& target_j = (outVar == 0) ? dmdot_dVj : dpres_dVj;
+
+      /*--- ProjVelocity = ... ---*/
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        target_i(iDim) = unitNormal(iDim) * Vn_i_b;
+        target_j(iDim) = unitNormal(iDim) * Vn_j_b;
+      }
+      target_i(nDim) = p_i_b;     target_j(nDim) = p_j_b;
+      target_i(nDim+1) = rho_i_b; target_j(nDim+1) = rho_j_b;
+      target_i(nDim+2) = H_i_b;   target_j(nDim+2) = H_j_b;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU (Shima and Kitamura 2011) and SLAU2 (Kitamura and Shima 2013) schemes, see CUpwSLAU_Flow.
+ * \tparam SLAU2 - Use the pressure flux of SLAU2.
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Low dissipation coefficient (same as for Roe).
+   */
+  FORCEINLINE Double dissipation(Int iPoint, Int jPoint, const CEulerVariable& solution) const {
+    return roeDissipation(iPoint, jPoint, typeDissip, solution);
+  }
+
+  /*!
+   * \brief Face mass flux (per unit area) and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound, and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double meanVel = sqrt(0.5*(sqVel_i + sqVel_j));
+    const Double machTilde = fmin(1.0, meanVel / aF);
+    const Double chi = (1-machTilde) * (1-machTilde);
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double vnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double vnMagL = (1-fRho)*vnMag + fRho*abs(projVel_i);
+    const Double vnMagR = (1-fRho)*vnMag + fRho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                  (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function, the subsonic polynomials are blended per lane. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double betaL = subL*0.25*(2-mL)*(mL+1)*(mL+1) + (1-subL)*(mL >= 0.0);
+
+    const Double subR = abs(mR) < 1.0;
+    const Double betaR = subR*0.25*(2+mR)*(mR-1)*(mR-1) + (1-subR)*(mR < 0.0);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    } else {
+      pressure += dissipation*meanVel*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    }
+  }
+};
@@ -0,0 +1,310 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (ideal gas) with analytical Jacobians, see CUpwHLLC_Flow.
+ * \note The four wave configurations of the scalar version are expressed in terms of an
+ * "upwind" side (i if the contact wave moves towards j, else j), selected per lane, such
+ * that the flux and Jacobians are computed without branches. See CRoeBase for the role of Base.
+ */
+template<class Base>
+class CHLLCScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    const Double gm1 = gamma - 1;
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+
+    Double soundSpeed_i = sqrt((V.i.enthalpy() - 0.5*sqVel_i) * gm1);
+    Double soundSpeed_j = sqrt((V.j.enthalpy() - 0.5*sqVel_j) * gm1);
+
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Grid motion (treated as in the scalar version). ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      soundSpeed_i -= projGridVel;
+      soundSpeed_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averages and wave speed estimates. ---*/
+
+    const Double sqrtRho_i = sqrt(V.i.density());
+    const Double sqrtRho_j = sqrt(V.j.density());
+    const Double rRho = 1 / (sqrtRho_i + sqrtRho_j);
+
+    VectorDbl<nDim> roeVelocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      roeVelocity(iDim) = (V.i.velocity(iDim)*sqrtRho_i + V.j.velocity(iDim)*sqrtRho_j) * rRho;
+    }
+    const Double roeProjVel = dot(roeVelocity, unitNormal) - projGridVel;
+    const Double roeEnthalpy = (sqrtRho_j*V.j.enthalpy() + sqrtRho_i*V.i.enthalpy()) * rRho;
+    const Double roeSoundSpeed = sqrt(gm1 * (roeEnthalpy - 0.5*squaredNorm(roeVelocity))) - projGridVel;
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    /*--- Speed of the contact surface and pressure on both sides of it. ---*/
+
+    const Double RHO = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / RHO;
+
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- Upwind side "k" and supersonic masks. ---*/
+
+    const Double upw_i = sM > 0.0;
+    const Double upw_j = 1 - upw_i;
+    const Double superL = upw_i * (sL > 0.0);
+    const Double superR = upw_j * (sR < 0.0);
+    const Double star = 1 - superL - superR;
+
+    const Double sK = upw_i*sL + upw_j*sR;
+    const Double rhoK = upw_i*V.i.density() + upw_j*V.j.density();
+    const Double pK = upw_i*V.i.pressure() + upw_j*V.j.pressure();
+    const Double hK = upw_i*V.i.enthalpy() + upw_j*V.j.enthalpy();
+    const Double eK = upw_i*energy_i + upw_j*energy_j;
+    const Double qK = upw_i*projVel_i + upw_j*projVel_j;
+    VectorDbl<nDim> velK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velK(iDim) = upw_i*V.i.velocity(iDim) + upw_j*V.j.velocity(iDim);
+    }
+
+    /*--- Star state of the upwind side. ---*/
+
+    const Double omega = 1 / (sK - sM);
+    const Double rhoSK = (sK - qK) * omega;
+
+    VectorDbl<nVar> starState;
+    starState(0) = rhoSK * rhoK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      starState(iDim+1) = rhoSK*rhoK*velK(iDim) + (pStar - pK)*unitNormal(iDim)*omega;
+    }
+    starState(nDim+1) = rhoSK*rhoK*eK - (pK*qK - pStar*sM)*omega;
+
+    /*--- Flux, physical flux of the upwind side in supersonic conditions. ---*/
+
+    const Double super = superL + superR;
+    const Double massFluxK = rhoK * qK;
+
+    VectorDbl<nVar> flux;
+    flux(0) = star*sM*starState(0) + super*massFluxK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = star*(sM*starState(iDim+1) + pStar*unitNormal(iDim)) +
+                     super*(massFluxK*velK(iDim) + pK*unitNormal(iDim));
+    }
+    flux(nDim+1) = star*(sM*(starState(nDim+1) + pStar) + pStar*projGridVel) + super*massFluxK*hK;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) flux(iVar) *= area;
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      /*--- Derivatives of the pressure (PI), contact speed (Sm) and star pressure. ---*/
+
+      VectorDbl<nVar> dPI_dUi, dPI_dUj, dSm_dUi, dSm_dUj, dpStar_dUi, dpStar_dUj;
+
+      dPI_dUi(0) = 0.5*gm1*sqVel_i;
+      dPI_dUj(0) = 0.5*gm1*sqVel_j;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dPI_dUi(iDim+1) = -gm1*V.i.velocity(iDim);
+        dPI_dUj(iDim+1) = -gm1*V.j.velocity(iDim);
+      }
+      dPI_dUi(nDim+1) = gm1;
+      dPI_dUj(nDim+1) = gm1;
+
+      const Double invRHO = 1 / RHO;
+      dSm_dUi(0) = (-projVel_i*projVel_i + sM*sL + dPI_dUi(0)) * invRHO;
+      dSm_dUj(0) = -(-projVel_j*projVel_j + sM*sR + dPI_dUj(0)) * invRHO;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dSm_dUi(iDim+1) = (unitNormal(iDim)*(2*projVel_i - sL - sM) + dPI_dUi(iDim+1)) * invRHO;
+        dSm_dUj(iDim+1) = -(unitNormal(iDim)*(2*projVel_j - sR - sM) + dPI_dUj(iDim+1)) * invRHO;
+      }
+      dSm_dUi(nDim+1) = dPI_dUi(nDim+1) * invRHO;
+      dSm_dUj(nDim+1) = -dPI_dUj(nDim+1) * invRHO;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        dpStar_dUi(iVar) = V.i.density()*(sR-projVel_j)*dSm_dUi(iVar);
+        dpStar_dUj(iVar) = V.j.density()*(sL-projVel_i)*dSm_dUj(iVar);
+      }
+
+      /*--- Jacobian of the star flux, "own" adds the terms of the upwind side. ---*/
+
+      const Double eStar = starState(nDim+1);
+      const Double omegaSM = omega * sM;
+
+      auto starJacobian = [&](const VectorDbl<nVar>& dSm, const VectorDbl<nVar>& dpStar,
+                              const VectorDbl<nVar>& dPI, Double own, Double s_k, Double q_k,
+                              Double h_k, const Double* vel_k, MatrixDbl<nVar>& jac) {
+        VectorDbl<nVar> drhoStar, dEStar;
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          drhoStar(iVar) = omega * starState(0) * dSm(iVar);
+          dEStar(iVar) = omega * (sM*dpStar(iVar) + (eStar+pStar)*dSm(iVar));
+        }
+        drhoStar(0) += own * omega * s_k;
+        dEStar(0) += own * omega * q_k * (h_k - dPI(0));
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          drhoStar(iDim+1) -= own * omega * unitNormal(iDim);
+          dEStar(iDim+1) += own * omega * (-unitNormal(iDim)*h_k - q_k*dPI(iDim+1));
+        }
+        dEStar(nDim+1) += own * omega * (s_k - q_k - q_k*dPI(nDim+1));
+
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac(0,iVar) = sM*drhoStar(iVar) + starState(0)*dSm(iVar);
+        }
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          for (size_t iVar = 0; iVar < nVar; ++iVar) {
+            jac(jDim+1,iVar) = (omegaSM+1) * (unitNormal(jDim)*dpStar(iVar) + starState(jDim+1)*dSm(iVar)) -
+                               own * omegaSM * dPI(iVar) * unitNormal(jDim);
+          }
+          jac(jDim+1,0) += own * omegaSM * vel_k[jDim] * q_k;
+          jac(jDim+1,jDim+1) += own * omegaSM * (s_k - q_k);
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            jac(jDim+1,iDim+1) -= own * omegaSM * vel_k[jDim] * unitNormal(iDim);
+          }
+        }
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac(nDim+1,iVar) = sM*(dEStar(iVar) + dpStar(iVar)) + (eStar+pStar)*dSm(iVar);
+        }
+      };
+
+      starJacobian(dSm_dUi, dpStar_dUi, dPI_dUi, upw_i, sL, projVel_i, V.i.enthalpy(), V.i.velocity(), jac_i);
+      starJacobian(dSm_dUj, dpStar_dUj, dPI_dUj, upw_j, sR, projVel_j, V.j.enthalpy(), V.j.velocity(), jac_j);
+
+      /*--- Supersonic lanes use the Jacobian of the upwind physical flux. ---*/
+
+      const auto jacSuper_i = inviscidProjJac(gamma, V.i.velocity(), energy_i, unitNormal, 1.0);
+      const auto jacSuper_j = inviscidProjJac(gamma, V.j.velocity(), energy_j, unitNormal, 1.0);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) = area * (star*jac_i(iVar,jVar) + superL*jacSuper_i(iVar,jVar));
+          jac_j(iVar,jVar) = area * (star*jac_j(iVar,jVar) + superR*jacSuper_j(iVar,jVar));
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,60 @@
+/*!
+ * \file common.hpp
+ * \brief Common functionality for the numerics of the turbulence models.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CPrimitiveIndices.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+
+/*!
+ * \brief Positions of the flow primitives needed by the turbulence models,
+ * resolved once for the regime (compressible or incompressible) of the problem.
+ */
+struct CTurbFlowIndices {
+  size_t velocity, density, laminarVisc, eddyVisc, soundSpeed;
+
+  CTurbFlowIndices(const CConfig& config, size_t nDim) {
+    const CPrimitiveIndices<unsigned short> idx(config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+                                                config.GetNEMOProblem(), nDim, config.GetnSpecies());
+    velocity = idx.Velocity();
+    density = idx.Density();
+    laminarVisc = idx.LaminarViscosity();
+    eddyVisc = idx.EddyViscosity();
+    soundSpeed = idx.SoundSpeed();
+  }
+};
+
+/*!
+ * \brief Gather one flow primitive (at position "index") for the points in iPoint.
+ */
+template<class Container>
+FORCEINLINE Double gatherPrimitive(Int iPoint, const Container& primitives, size_t index) {
+  return gatherVariables<1>(iPoint, primitives, index)(0);
+}
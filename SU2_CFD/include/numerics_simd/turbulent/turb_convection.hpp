@@ -0,0 +1,218 @@
+/*!
+ * \file turb_convection.hpp
+ * \brief Upwind convection of the turbulence models.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CTurbUpwindScheme
+ * \ingroup ConvDiscr
+ * \brief First or second order (MUSCL) upwind convection of turbulence variables,
+ * vectorized version of CUpwSca_TurbSA (Conservative = false) and CUpwSca_TurbSST (true).
+ * The diffusion is added by the base class (static decorator), which also provides the
+ * access to the flow variables.
+ */
+template<class Decorator, bool Conservative>
+class CTurbUpwindScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::idx;
+  using Base::flowVars;
+
+  const bool dynamicGrid;
+  const bool musclFlow;
+  const bool limiterFlow;
+
+  /*!
+   * \brief Add the (limited) reconstruction of nRecon variables, starting at "start", to vars.
+   */
+  template<size_t nRecon, class Gradient_t, class Limiter_t>
+  FORCEINLINE static void reconstruct(Int iPoint,
+                                      const VectorDbl<nDim>& vector_ij,
+                                      Double scale,
+                                      bool limited,
+                                      size_t start,
+                                      const Limiter_t& limiter,
+                                      const Gradient_t& gradient,
+                                      VectorDbl<nRecon>& vars) {
+    const auto grad = gatherVariables<nRecon,nDim>(iPoint, gradient, start);
+    if (limited) {
+      const auto lim = gatherVariables<nRecon>(iPoint, limiter, start);
+      for (size_t iVar = 0; iVar < nRecon; ++iVar) {
+        vars(iVar) += scale * dot(&grad(iVar,0), vector_ij) * lim(iVar);
+      }
+    } else {
+      for (size_t iVar = 0; iVar < nRecon; ++iVar) {
+        vars(iVar) += scale * dot(&grad(iVar,0), vector_ij);
+      }
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CTurbUpwindScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    dynamicGrid(config.GetDynamic_Grid()),
+    /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind). ---*/
+    musclFlow(config.GetMUSCL_Flow() && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    /*--- Only consider flow limiters for cell-based limiters. ---*/
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE)) {
+  }
+
+  /*!
+   * \brief Implementation of the upwind flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    /*--- These are solver-specific global parameters, set before each solver is called. ---*/
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow velocity and density, and turbulence variables, w/o reconstruction. ---*/
+
+    const auto& primitives = flowVars->GetPrimitive();
+
+    CPair<VectorDbl<nDim> > velocity;
+    velocity.i = gatherVariables<nDim>(iPoint, primitives, idx.velocity);
+    velocity.j = gatherVariables<nDim>(jPoint, primitives, idx.velocity);
+
+    CPair<VectorDbl<1> > density;
+    if (Conservative) {
+      density.i = gatherVariables<1>(iPoint, primitives, idx.density);
+      density.j = gatherVariables<1>(jPoint, primitives, idx.density);
+    }
+
+    CPair<VectorDbl<nVar> > var1st;
+    var1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    var1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    auto var = var1st;
+
+    /*--- MUSCL reconstruction. ---*/
+
+    if (muscl) {
+      if (musclFlow) {
+        const auto& gradients = flowVars->GetGradient_Reconstruction();
+        const auto& limiters = flowVars->GetLimiter_Primitive();
+
+        reconstruct(iPoint, vector_ij, 0.5, limiterFlow, idx.velocity, limiters, gradients, velocity.i);
+        reconstruct(jPoint, vector_ij,-0.5, limiterFlow, idx.velocity, limiters, gradients, velocity.j);
+        if (Conservative) {
+          reconstruct(iPoint, vector_ij, 0.5, limiterFlow, idx.density, limiters, gradients, density.i);
+          reconstruct(jPoint, vector_ij,-0.5, limiterFlow, idx.density, limiters, gradients, density.j);
+        }
+      }
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      const auto& limiters = solution.GetLimiter();
+
+      reconstruct(iPoint, vector_ij, 0.5, limiter, 0, limiters, gradients, var.i);
+      reconstruct(jPoint, vector_ij,-0.5, limiter, 0, limiters, gradients, var.j);
+    }
+
+    /*--- Face-normal velocity, relative to the grid if it moves. ---*/
+
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      const auto gridVel_i = gatherVariables<nDim>(iPoint, gridVel);
+      const auto gridVel_j = gatherVariables<nDim>(jPoint, gridVel);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        velocity.i(iDim) -= gridVel_i(iDim);
+        velocity.j(iDim) -= gridVel_j(iDim);
+      }
+    }
+    Double q_ij = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      q_ij += 0.5 * (velocity.i(iDim) + velocity.j(iDim)) * normal(iDim);
+    }
+    const Double a0 = fmax(0.0, q_ij);
+    const Double a1 = fmin(0.0, q_ij);
+
+    /*--- Upwind flux and Jacobians. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      if (Conservative) {
+        flux(iVar) = a0 * density.i(0) * var.i(iVar) + a1 * density.j(0) * var.j(iVar);
+      } else {
+        flux(iVar) = a0 * var.i(iVar) + a1 * var.j(iVar);
+      }
+      if (implicit) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) = 0.0;
+          jac_j(iVar,jVar) = 0.0;
+        }
+        jac_i(iVar,iVar) = a0;
+        jac_j(iVar,iVar) = a1;
+      }
+    }
+
+    /*--- Add the diffusion from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iPoint, jPoint, var1st, solution, vector_ij, normal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,234 @@
+/*!
+ * \file turb_diffusion.hpp
+ * \brief Decorator classes for the diffusion of the turbulence models.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "common.hpp"
+#include "../flow/diffusion/common.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CTurbDiffusionBase
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add the diffusion terms of the turbulence models.
+ * The projected (and corrected) average gradient is computed here, derived classes
+ * implement the effective diffusivities in a const "diffusionFlux" method.
+ * Like the flow viscous decorators, it is meant to be the base class of the upwind scheme.
+ */
+template<size_t NDIM, size_t NVAR, class Derived>
+class CTurbDiffusionBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+
+  const CTurbFlowIndices idx;
+  const CFlowVariable* flowVars;
+
+  /*!
+   * \brief Constructor, store the flow variables and the positions of the primitives.
+   */
+  template<class... Ts>
+  CTurbDiffusionBase(const CConfig& config, const CVariable* flowVars_, Ts&...) :
+    idx(config, nDim),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)) {
+  }
+
+  /*!
+   * \brief Add the diffusion contribution to the flux and Jacobians.
+   * \note Gradient correction is always used, this is only for interior edges.
+   */
+  FORCEINLINE void viscousTerms(Int iPoint,
+                                Int jPoint,
+                                const CPair<VectorDbl<nVar> >& var,
+                                const CVariable& solution,
+                                const VectorDbl<nDim>& vector_ij,
+                                const VectorDbl<nDim>& normal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    const Double dist2_ij = fmax(squaredNorm(vector_ij), EPS);
+    const Double proj_vector_ij = dot(vector_ij, normal) / dist2_ij;
+
+    /*--- Projected average gradient, corrected with the directional derivative. ---*/
+
+    const auto avgGrad = averageGradient<nVar,nDim>(iPoint, jPoint, solution.GetGradient());
+
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      projGrad(iVar) = dot(&avgGrad(iVar,0), normal);
+      projGrad(iVar) -= (dot(&avgGrad(iVar,0), vector_ij) - (var.j(iVar) - var.i(iVar))) * proj_vector_ij;
+    }
+
+    /*--- Flow properties. ---*/
+
+    const auto& primitives = flowVars->GetPrimitive();
+    CPair<Double> density, laminarVisc, eddyVisc;
+    density.i = gatherPrimitive(iPoint, primitives, idx.density);
+    density.j = gatherPrimitive(jPoint, primitives, idx.density);
+    laminarVisc.i = gatherPrimitive(iPoint, primitives, idx.laminarVisc);
+    laminarVisc.j = gatherPrimitive(jPoint, primitives, idx.laminarVisc);
+    eddyVisc.i = gatherPrimitive(iPoint, primitives, idx.eddyVisc);
+    eddyVisc.j = gatherPrimitive(jPoint, primitives, idx.eddyVisc);
+
+    static_cast<const Derived*>(this)->diffusionFlux(iPoint, jPoint, var, solution, projGrad, proj_vector_ij,
+                                                     density, laminarVisc, eddyVisc, implicit, flux, jac_i, jac_j);
+  }
+};
+
+/*!
+ * \class CSADiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the Spalart-Allmaras model (with the SA-neg modification, if NEG).
+ */
+template<size_t NDIM, bool NEG>
+class CSADiffusion : public CTurbDiffusionBase<NDIM, 1, CSADiffusion<NDIM, NEG> > {
+protected:
+  using Base = CTurbDiffusionBase<NDIM, 1, CSADiffusion<NDIM, NEG> >;
+  using Base::nVar;
+
+  const su2double sigma = 2.0/3.0;
+  const su2double cn1 = 16.0;
+
+  template<class... Ts>
+  CSADiffusion(Ts&... args) : Base(args...) {}
+
+public:
+  /*!
+   * \brief Effective viscosity and fluxes, see CAvgGrad_TurbSA and CAvgGrad_TurbSA_Neg.
+   */
+  FORCEINLINE void diffusionFlux(Int, Int,
+                                 const CPair<VectorDbl<nVar> >& var,
+                                 const CVariable&,
+                                 const VectorDbl<nVar>& projGrad,
+                                 Double proj_vector_ij,
+                                 const CPair<Double>& density,
+                                 const CPair<Double>& laminarVisc,
+                                 const CPair<Double>&,
+                                 bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+    const Double nu_i = laminarVisc.i / density.i;
+    const Double nu_j = laminarVisc.j / density.j;
+
+    Double nu_e;
+    if (NEG) {
+      const Double nu_ij = 0.5 * (nu_i + nu_j);
+      const Double nu_tilde_ij = 0.5 * (var.i(0) + var.j(0));
+      /*--- fn = 1 for positive nu tilde. ---*/
+      const Double xi = fmin(nu_tilde_ij, 0.0) / nu_ij;
+      const Double xi3 = xi * xi * xi;
+      const Double fn = (cn1 + xi3) / (cn1 - xi3);
+      nu_e = nu_ij + fn * nu_tilde_ij;
+    } else {
+      nu_e = 0.5 * (nu_i + nu_j + var.i(0) + var.j(0));
+    }
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    /*--- Use of TSL approx. to compute derivatives of the gradients. ---*/
+    if (implicit) {
+      jac_i(0,0) -= (0.5 * projGrad(0) - nu_e * proj_vector_ij) / sigma;
+      jac_j(0,0) -= (0.5 * projGrad(0) + nu_e * proj_vector_ij) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the Menter SST model.
+ */
+template<size_t NDIM>
+class CSSTDiffusion : public CTurbDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> > {
+protected:
+  using Base = CTurbDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> >;
+  using Base::nVar;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  template<class... Ts>
+  CSSTDiffusion(const CConfig& config, const CVariable* flowVars, const su2double* constants, Ts&... args) :
+    Base(config, flowVars, args...),
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+public:
+  /*!
+   * \brief Blended diffusivities and fluxes, see CAvgGrad_TurbSST.
+   */
+  FORCEINLINE void diffusionFlux(Int iPoint, Int jPoint,
+                                 const CPair<VectorDbl<nVar> >&,
+                                 const CVariable& solution,
+                                 const VectorDbl<nVar>& projGrad,
+                                 Double proj_vector_ij,
+                                 const CPair<Double>& density,
+                                 const CPair<Double>& laminarVisc,
+                                 const CPair<Double>& eddyVisc,
+                                 bool implicit,
+                                 VectorDbl<nVar>& flux,
+                                 MatrixDbl<nVar>& jac_i,
+                                 MatrixDbl<nVar>& jac_j) const {
+    /*--- Menter's first blending function. ---*/
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    const Double sigma_kine_i = F1_i * sigma_k1 + (1.0 - F1_i) * sigma_k2;
+    const Double sigma_kine_j = F1_j * sigma_k1 + (1.0 - F1_j) * sigma_k2;
+    const Double sigma_omega_i = F1_i * sigma_om1 + (1.0 - F1_i) * sigma_om2;
+    const Double sigma_omega_j = F1_j * sigma_om1 + (1.0 - F1_j) * sigma_om2;
+
+    /*--- Mean effective dynamic viscosity. ---*/
+    const Double diff_kine = 0.5 * ((laminarVisc.i + sigma_kine_i * eddyVisc.i) +
+                                    (laminarVisc.j + sigma_kine_j * eddyVisc.j));
+    const Double diff_omega = 0.5 * ((laminarVisc.i + sigma_omega_i * eddyVisc.i) +
+                                     (laminarVisc.j + sigma_omega_j * eddyVisc.j));
+
+    flux(0) -= diff_kine * projGrad(0);
+    flux(1) -= diff_omega * projGrad(1);
+
+    /*--- Use of TSL approx. to compute derivatives of the gradients. ---*/
+    if (implicit) {
+      const Double proj_on_rho_i = proj_vector_ij / density.i;
+      jac_i(0,0) += diff_kine * proj_on_rho_i;
+      jac_i(1,1) += diff_omega * proj_on_rho_i;
+
+      const Double proj_on_rho_j = proj_vector_ij / density.j;
+      jac_j(0,0) -= diff_kine * proj_on_rho_j;
+      jac_j(1,1) -= diff_omega * proj_on_rho_j;
+    }
+  }
+};
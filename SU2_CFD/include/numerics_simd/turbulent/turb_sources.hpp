@@ -0,0 +1,395 @@
+/*!
+ * \file turb_sources.hpp
+ * \brief Source terms of the turbulence models.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CTurbSAVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CSASource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Spalart-Allmaras model, vectorized version of the baseline (SA-noft2, SA)
+ * and negative (SA-neg) variants of CSourceBase_TurbSA, with the optional rotation correction (SA-R).
+ * \note Branches are replaced by blending with 0/1 masks, points too close to walls get no source.
+ */
+template<size_t NDIM, bool NEG, bool FT2>
+class CSASource final : public CSourceNumericsSIMD {
+private:
+  static constexpr size_t nDim = NDIM;
+
+  /*--- Constants of the model, see CSAVariables. ---*/
+  const su2double cv1_3 = pow(7.1, 3);
+  const su2double k2 = pow(0.41, 2);
+  const su2double cb1 = 0.1355;
+  const su2double cw2 = 0.3;
+  const su2double ct3 = 1.2;
+  const su2double ct4 = 0.5;
+  const su2double cw3_6 = pow(2, 6);
+  const su2double sigma = 2.0 / 3.0;
+  const su2double cb2 = 0.622;
+  const su2double cb2_sigma = cb2 / sigma;
+  const su2double cw1 = cb1 / k2 + (1 + cb2) / sigma;
+  const su2double cr1 = 0.5;
+  const su2double CRot = 2.0;
+  const su2double c2 = 0.7, c3 = 0.9;
+
+  const CTurbFlowIndices idx;
+  const CFlowVariable* flowVars;
+  const bool rotation;
+  const bool hybridRANSLES;
+
+public:
+  /*!
+   * \brief Constructor, store the flow variables and the options.
+   */
+  CSASource(const CConfig& config, const CVariable* flowVars_) :
+    idx(config, nDim),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)),
+    rotation(config.GetSAParsedOptions().rot),
+    hybridRANSLES(config.GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+  }
+
+  /*!
+   * \brief Compute and subtract the source terms of the points in iPoint.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    const auto& primitives = flowVars->GetPrimitive();
+    const Double density = gatherPrimitive(iPoint, primitives, idx.density);
+    const Double laminarVisc = gatherPrimitive(iPoint, primitives, idx.laminarVisc);
+    const Double strainMag = gatherVariables(iPoint, flowVars->GetStrainMag());
+    const auto vorticity = gatherVariables<3>(iPoint, flowVars->GetVorticity());
+
+    const Double nue = gatherVariables(iPoint, solution.GetSolution());
+    const auto gradNue = gatherVariables<1,nDim>(iPoint, solution.GetGradient());
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+
+    /*--- Wall distance modified by roughness (d + 0.03 k_s), or DES length scale. ---*/
+
+    Double dist, roughness = 0.0;
+    if (hybridRANSLES) {
+      dist = gatherVariables(iPoint, static_cast<const CTurbSAVariable&>(solution).GetDES_LengthScale());
+    } else {
+      roughness = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+      dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) + 0.03 * roughness;
+    }
+
+    /*--- No source for points very close to walls, their distance is changed to keep values finite. ---*/
+
+    const Double active = dist > 1e-10;
+    dist = active * dist + (1.0 - active);
+
+    const Double dist2 = pow(dist, 2);
+    const Double nu = laminarVisc / density;
+    const Double inv_k2_d2 = 1.0 / (k2 * dist2);
+
+    /*--- The baseline functions are evaluated with non-negative nu tilde,
+     *    for SA-neg they are only used where nu tilde is positive. ---*/
+
+    const Double pos = nue > 0.0;
+    const Double nueB = NEG ? fmax(nue, 0.0) : nue;
+
+    const Double Ji = nueB / nu + cr1 * (roughness / (dist + EPS));
+    const Double d_Ji = 1.0 / nu;
+    const Double Ji_2 = pow(Ji, 2);
+    const Double Ji_3 = Ji_2 * Ji;
+
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    const Double d_fv1 = 3 * Ji_2 * cv1_3 / (nu * pow(Ji_3 + cv1_3, 2));
+    const Double fv2 = 1 - nueB / (nu + nueB * fv1);
+    const Double d_fv2 = -(1 / nu - Ji_2 * d_fv1) / pow(1 + Ji * fv1, 2);
+
+    const Double Omega = norm(vorticity);
+
+    /*--- Modified vorticity, limited as in note 1 option c of
+     *    https://turbmodels.larc.nasa.gov/spalart.html ---*/
+
+    const Double Sbar = nueB * fv2 * inv_k2_d2;
+    const Double noLimit = Sbar >= -c2 * Omega;
+    const Double den = (c3 - 2 * c2) * Omega - Sbar;
+    const Double limited = Omega * (c2 * c2 * Omega + c3 * Sbar) / (den + noLimit * (1.0 - den));
+    Double Shat = Omega + noLimit * Sbar + (1.0 - noLimit) * limited;
+    const Double clip = Shat <= 1e-10;
+    Shat = fmax(Shat, 1e-10);
+    const Double d_Shat = (1.0 - clip) * (fv2 + nueB * d_fv2) * inv_k2_d2;
+    const Double inv_Shat = 1.0 / Shat;
+
+    /*--- Production with Dacles-Mariani et. al. rotation correction ("-R"). ---*/
+
+    const Double neg = nue < 0.0;
+    Double rotCorr = 0.0;
+    if (rotation) rotCorr = CRot * fmin(0.0, strainMag - Omega);
+
+    Double Prod = Shat;
+    if (rotation) {
+      Prod += rotCorr;
+      /*--- Do not allow negative production for SA-neg. ---*/
+      Prod += neg * (abs(Prod) - Prod);
+    }
+
+    /*--- ft2 term. ---*/
+
+    Double ft2 = 0.0, d_ft2 = 0.0;
+    if (FT2) {
+      ft2 = ct3 * exp(-ct4 * Ji_2);
+      d_ft2 = -2.0 * ct4 * Ji * ft2 * d_Ji;
+    }
+
+    /*--- Function r and wall destruction function fw. ---*/
+
+    const Double r = fmin(nueB * inv_Shat * inv_k2_d2, 10.0);
+    const Double d_r = (r < 10.0) * (Shat - nueB * d_Shat) * pow(inv_Shat, 2) * inv_k2_d2;
+
+    const Double g = r + cw2 * (pow(r, 6) - r);
+    const Double g_6 = pow(g, 6);
+    const Double glim = pow((1 + cw3_6) / (g_6 + cw3_6), 1.0 / 6.0);
+    const Double fw = g * glim;
+
+    const Double d_g = d_r * (1 + cw2 * (6 * pow(r, 5) - 1));
+    const Double d_fw = d_g * glim * (1 - g_6 / (g_6 + cw3_6));
+
+    /*--- Production, destruction, and cross production (see SourceTerms::Bsl). ---*/
+
+    const Double crossProduction = cb2_sigma * squaredNorm<nDim>(&gradNue(0,0));
+
+    const Double production = cb1 * (1.0 - ft2) * Prod * nueB;
+    Double jacobian = cb1 * (-Prod * nueB * d_ft2 + (1.0 - ft2) * (nueB * d_Shat + Prod));
+
+    const su2double cb1_k2 = cb1 / k2;
+    const Double factor = cw1 * fw - cb1_k2 * ft2;
+    const Double destruction = factor * pow(nueB, 2) / dist2;
+    jacobian -= ((cw1 * d_fw - cb1_k2 * d_ft2) * pow(nueB, 2) + factor * 2 * nueB) / dist2;
+
+    Double source = production - destruction + crossProduction;
+
+    if (NEG) {
+      /*--- Non-positive nu tilde, S tilde = Omega, and the destruction is added (see SourceTerms::Neg). ---*/
+      Double ProdNeg = Omega;
+      if (rotation) {
+        ProdNeg += rotCorr;
+        ProdNeg += neg * (abs(ProdNeg) - ProdNeg);
+      }
+      const Double dP_dnu = cb1 * (1.0 - ct3) * ProdNeg;
+      const Double dD_dnu = -cw1 * nue / dist2;
+      const Double sourceNeg = dP_dnu * nue - dD_dnu * nue + crossProduction;
+      const Double jacobianNeg = dP_dnu - 2 * dD_dnu;
+
+      source = pos * source + (1.0 - pos) * sourceNeg;
+      jacobian = pos * jacobian + (1.0 - pos) * jacobianNeg;
+    }
+
+    VectorDbl<1> residual;
+    MatrixDbl<1> jac;
+    residual(0) = active * source * volume;
+    jac(0,0) = active * jacobian * volume;
+
+    stopPreacc(residual);
+
+    updateLinearSystem(iPoint, implicit, updateMask, residual, jac, vector, matrix);
+  }
+};
+
+/*!
+ * \class CSSTSource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Menter SST model, vectorized version of CSourcePieceWise_TurbSST
+ * (all production variants except UQ, without transition coupling).
+ */
+template<size_t NDIM>
+class CSSTSource final : public CSourceNumericsSIMD {
+private:
+  static constexpr size_t nDim = NDIM;
+
+  const su2double beta_1, beta_2, beta_star, alfa_1, alfa_2, prod_lim_const;
+  const su2double kAmb, omegaAmb;
+
+  const CTurbFlowIndices idx;
+  const CFlowVariable* flowVars;
+  const SST_ParsedOptions options;
+
+public:
+  /*!
+   * \brief Constructor, store the constants of the model, the flow variables, and the options.
+   */
+  CSSTSource(const CConfig& config, const CVariable* flowVars_, const su2double* constants,
+             su2double kineInf, su2double omegaInf) :
+    beta_1(constants[4]),
+    beta_2(constants[5]),
+    beta_star(constants[6]),
+    alfa_1(constants[8]),
+    alfa_2(constants[9]),
+    prod_lim_const(constants[10]),
+    kAmb(kineInf),
+    omegaAmb(omegaInf),
+    idx(config, nDim),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)),
+    options(config.GetSSTParsedOptions()) {
+  }
+
+  /*!
+   * \brief Compute and subtract the source terms of the points in iPoint.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution_,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CTurbSSTVariable&>(solution_);
+
+    const auto& primitives = flowVars->GetPrimitive();
+    const Double density = gatherPrimitive(iPoint, primitives, idx.density);
+    Double eddyVisc = gatherPrimitive(iPoint, primitives, idx.eddyVisc);
+    const Double strainMag = gatherVariables(iPoint, flowVars->GetStrainMag());
+    const auto vorticity = gatherVariables<3>(iPoint, flowVars->GetVorticity());
+
+    const auto turbVars = gatherVariables<2>(iPoint, solution.GetSolution());
+    const Double& kine = turbVars(0);
+    const Double& omega = turbVars(1);
+    const Double F1 = gatherVariables(iPoint, solution.GetF1blending());
+    const Double CDkw = gatherVariables(iPoint, solution.GetCrossDiff());
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance());
+
+    /*--- No source for points very close to walls, where the eddy viscosity is
+     *    usually 0, so it is changed to keep values finite. ---*/
+
+    const Double active = dist > 1e-10;
+    eddyVisc = active * eddyVisc + (1.0 - active);
+
+    /*--- Blended constants. ---*/
+
+    const Double alfa_blended = F1 * alfa_1 + (1.0 - F1) * alfa_2;
+    const Double beta_blended = F1 * beta_1 + (1.0 - F1) * beta_2;
+
+    /*--- Production term modifications. ---*/
+
+    const Double VorticityMag = norm(vorticity);
+    Double P_Base = strainMag, zetaFMt = 0.0, Mt = 0.0;
+
+    const bool compressible = (options.production == SST_OPTIONS::COMP_Wilcox) ||
+                              (options.production == SST_OPTIONS::COMP_Sarkar);
+    if (compressible) {
+      Mt = sqrt(2.0 * kine) / gatherPrimitive(iPoint, primitives, idx.soundSpeed);
+    }
+
+    switch (options.production) {
+      case SST_OPTIONS::V:
+        P_Base = VorticityMag;
+        break;
+      case SST_OPTIONS::KL:
+        P_Base = sqrt(strainMag * VorticityMag);
+        break;
+      case SST_OPTIONS::COMP_Wilcox:
+        zetaFMt = (Mt >= 0.25) * 2.0 * (Mt * Mt - 0.25 * 0.25);
+        break;
+      case SST_OPTIONS::COMP_Sarkar:
+        zetaFMt = (Mt >= 0.25) * 0.5 * (Mt * Mt);
+        break;
+      default:
+        /*--- Base production term for SST-1994 and SST-2003. ---*/
+        break;
+    }
+
+    /*--- Production limiter. ---*/
+
+    const Double prod_limit = prod_lim_const * beta_star * density * omega * kine;
+
+    const Double P = eddyVisc * pow(P_Base, 2);
+    Double pk = fmax(0.0, fmin(P, prod_limit));
+
+    /*--- Production limiter only for V2003, recompute for V1994. ---*/
+    Double pw;
+    if (options.version == SST_OPTIONS::V1994) {
+      pw = alfa_blended * density * pow(P_Base, 2);
+    } else {
+      pw = (alfa_blended * density / eddyVisc) * pk;
+    }
+
+    /*--- Sustaining terms (see CSourcePieceWise_TurbSST). ---*/
+    if (options.sust) {
+      const Double sust_k = beta_star * density * kAmb * omegaAmb;
+      const Double sust_w = beta_blended * density * omegaAmb * omegaAmb;
+      pk = fmax(pk, sust_k);
+      pw = fmax(pw, sust_w);
+    }
+
+    if (options.production == SST_OPTIONS::COMP_Sarkar) {
+      pk += -0.15 * pk * Mt + 0.2 * beta_star * (1.0 + zetaFMt) * density * omega * kine * Mt * Mt;
+    }
+
+    /*--- Dissipation. ---*/
+
+    const Double dk = beta_star * density * omega * kine * (1.0 + zetaFMt);
+    const Double dw = beta_blended * density * omega * omega * (1.0 - 0.09 / beta_blended * zetaFMt);
+
+    /*--- Residual (production - dissipation + cross diffusion) and Jacobian. ---*/
+
+    VectorDbl<2> residual;
+    residual(0) = pk * volume;
+    residual(0) -= dk * volume;
+    residual(1) = pw * volume;
+    residual(1) -= dw * volume;
+    residual(1) += (1.0 - F1) * CDkw * volume;
+
+    MatrixDbl<2> jac;
+    jac(0,0) = -beta_star * omega * volume * (1.0 + zetaFMt);
+    jac(0,1) = -beta_star * kine * volume * (1.0 + zetaFMt);
+    jac(1,0) = 0.0;
+    jac(1,1) = -2.0 * beta_blended * omega * volume * (1.0 - 0.09 / beta_blended * zetaFMt);
+
+    for (size_t iVar = 0; iVar < 2; ++iVar) {
+      residual(iVar) *= active;
+      for (size_t jVar = 0; jVar < 2; ++jVar) jac(iVar,jVar) *= active;
+    }
+
+    stopPreacc(residual);
+
+    updateLinearSystem(iPoint, implicit, updateMask, residual, jac, vector, matrix);
+  }
+};
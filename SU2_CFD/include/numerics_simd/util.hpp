@@ -143,19 +143,21 @@ FORCEINLINE Double gatherVariables(Int iPoint, const Container& vars) {
 }
 
 /*!
- * \brief Gather a vector of variables (size nVar) from row iPoint of a 2D container.
+ * \brief Gather a vector of variables (size nVar) from row iPoint of a 2D container,
+ *        optionally starting at column "start".
  */
 template<size_t nVar, class Container>
-FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars) {
-  return vars.template get<VectorDbl<nVar> >(iPoint);
+FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
+  return vars.template get<VectorDbl<nVar> >(iPoint, start);
 }
 
 /*!
- * \brief Gather a matrix of variables from outer index iPoint of a 3D container.
+ * \brief Gather a matrix of variables from outer index iPoint of a 3D container,
+ *        optionally starting at row "start".
  */
 template<size_t nRows, size_t nCols, class Container>
-FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
-  return vars.template get<MatrixDbl<nRows,nCols> >(iPoint);
+FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
+  return vars.template get<MatrixDbl<nRows,nCols> >(iPoint, start);
 }
 #else
 
@@ -179,25 +181,25 @@ FORCEINLINE Double gatherVariables(Int iPoint, const Container& vars) {
 }
 
 template<size_t nVar, class Container>
-FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars) {
+FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
   VectorDbl<nVar> x;
   for (size_t i=0; i<nVar; ++i) {
     for (size_t k=0; k<Double::Size; ++k) {
-      AD::SetPreaccIn(vars(iPoint[k],i));
-      x[i][k] = vars(iPoint[k],i);
+      AD::SetPreaccIn(vars(iPoint[k],i+start));
+      x[i][k] = vars(iPoint[k],i+start);
     }
   }
   return x;
 }
 
 template<size_t nRows, size_t nCols, class Container>
-FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
+FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
   MatrixDbl<nRows,nCols> x;
   for (size_t i=0; i<nRows; ++i) {
     for (size_t j=0; j<nCols; ++j) {
       for (size_t k=0; k<Double::Size; ++k) {
-        AD::SetPreaccIn(vars(iPoint[k],i,j));
-        x(i,j)[k] = vars(iPoint[k],i,j);
+        AD::SetPreaccIn(vars(iPoint[k],i+start,j));
+        x(i,j)[k] = vars(iPoint[k],i+start,j);
       }
     }
   }
@@ -261,3 +263,34 @@ FORCEINLINE void updateLinearSystem(Int iEdge,
     }
   }
 }
+
+/*!
+ * \brief Subtract point sources from the right-hand-side, and their Jacobians from the matrix diagonal.
+ */
+template<size_t nVar>
+FORCEINLINE void updateLinearSystem(Int iPoint,
+                                    bool implicit,
+                                    Double updateMask,
+                                    const VectorDbl<nVar>& source,
+                                    const MatrixDbl<nVar>& jac,
+                                    CSysVector<su2double>& vector,
+                                    SparseMatrixType& matrix) {
+  for (size_t k = 0; k < Double::Size; ++k) {
+    if (updateMask[k] == 0.0) continue;
+
+    su2double block[nVar];
+    for (size_t iVar = 0; iVar < nVar; ++iVar) block[iVar] = source(iVar)[k];
+    vector.SubtractBlock(iPoint[k], block);
+
+    if (implicit) {
+      su2double jacBlock[nVar][nVar];
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        for (size_t jVar = 0; jVar < nVar; ++jVar)
+          jacBlock[iVar][jVar] = jac(iVar,jVar)[k];
+
+      auto wasActive = AD::BeginPassive();
+      matrix.SubtractBlock2Diag(iPoint[k], jacBlock);
+      AD::EndPassive(wasActive);
+    }
+  }
+}
@@ -111,6 +111,16 @@ protected:
    */
   void AddHistoryOutputFieldsScalarLinsol(const CConfig* config);
 
+  /*!
+   * \brief Add history fields for the reuse of the Jacobian by the Newton-Krylov method (FVMComp, FVMInc, FVMNEMO).
+   */
+  void AddHistoryOutputFieldsNewtonKrylov(const CConfig* config);
+
+  /*!
+   * \brief Set the history field values of the Newton-Krylov method.
+   */
+  void LoadHistoryDataNewtonKrylov(const CConfig* config, const CSolver* flow_solver);
+
   /*!
    * \brief Set all scalar (turbulence/species) history field values.
    */
@@ -348,6 +348,23 @@ public:
    */
   void LoadData(CGeometry *geometry, CConfig *config, CSolver **solver_container);
 
+  /*!
+   * \brief Get the volume output values of the points before they are sorted, they carry the running time averages.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return Values of the volume fields for each domain point, empty if the volume output was not set up yet.
+   */
+  su2passivematrix GetUnsortedVolumeData(const CGeometry *geometry) const;
+
+  /*!
+   * \brief Release the data that depends on the partitioning of the grid (data sorters, points of the probes),
+   *        it is set up again on demand. Used after the grid is repartitioned during the run.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem (the repartitioned grid).
+   * \param[in] volumeData - Values of the volume fields for each domain point of the repartitioned grid,
+   *            see GetUnsortedVolumeData, nothing is restored if empty.
+   */
+  void ResetPartitionData(CConfig *config, CGeometry *geometry, const su2passivematrix& volumeData);
+
   /*!
    * \brief Preprocess the history output by setting the history fields and opening the history file.
    * \param[in] config - Definition of the particular problem.
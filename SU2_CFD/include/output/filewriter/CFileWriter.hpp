@@ -41,6 +41,11 @@ using namespace std;
 class CFileWriter{
 protected:
 
+  /*!
+   * \brief Max. number of bytes written by one MPI call (the counts of MPI are int).
+   */
+  enum : unsigned long {MAX_CHUNK_BYTES = 1ul << 30};
+
   /*!
    * \brief The MPI rank
    */
@@ -78,6 +83,26 @@ protected:
    */
   CParallelDataSorter* dataSorter;
 
+  /*!
+   * \brief Name of the file that is currently open, including the extension.
+   */
+  std::string openFileName;
+
+  /*!
+   * \brief Name that the open file gets once it is complete, different from openFileName for temporary files.
+   */
+  std::string finalFileName;
+
+  /*!
+   * \brief Chunk gathered by WriteAggregatedBinaryDataAll that is written by the background thread once the file is closed.
+   */
+  std::vector<char> pendingChunk;
+
+  /*!
+   * \brief Offset in bytes of the pending chunk within the file.
+   */
+  unsigned long pendingOffset = 0;
+
 #ifdef HAVE_MPI
   /*!
    * \brief The displacement that every process has in the current file view
@@ -137,6 +162,12 @@ public:
    */
   su2double GetUsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Wait for the background thread to finish writing the chunks of previous asynchronous writes, and then
+   * replace the previous file by the temporary file that was written. Must be called collectively.
+   */
+  static void WaitPendingWrites();
+
 protected:
 
   /*!
@@ -149,6 +180,20 @@ protected:
    */
   bool WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes, unsigned long totalSizeInBytes, unsigned long offset);
 
+  /*!
+   * \brief Collectively write a binary data array distributed over all processors to file. A subset of processors
+   * (aggregators) gathers the data of groups of consecutive ranks and writes it as one large contiguous chunk.
+   * \param[in] data - Pointer to the data to write.
+   * \param sizeInBytes - The size of the data in bytes on this processor.
+   * \param totalSizeInBytes - The total size of the array accumulated over all processors.
+   * \param offset - The offset in bytes of the chunk of data the current processor owns within the global array.
+   * \param nAggregators - Number of aggregators, 0 for all processors.
+   * \param async - The aggregators keep the chunk and a background thread writes it after CloseMPIFile.
+   * \return Boolean indicating whether the writing was successful.
+   */
+  bool WriteAggregatedBinaryDataAll(const void *data, unsigned long sizeInBytes, unsigned long totalSizeInBytes,
+                                    unsigned long offset, unsigned long nAggregators, bool async);
+
   /*!
    * \brief Write a binary data array to a currently opened file using MPI I/O. Note: routine must be called collectively,
    * although only one processor writes its data.
@@ -171,9 +216,11 @@ protected:
   /*!
    * \brief Open a file to write using MPI I/O. Already existing file is deleted.
    * \param[in] val_filename - The name of the file
+   * \param[in] temporary - Write to "<name>.tmp", which replaces the file in WaitPendingWrites (for asynchronous
+   * writes, the previous file is kept until the new one is complete).
    * \return Boolean indicating whether the opening was successful.
    */
-  bool OpenMPIFile(string val_filename);
+  bool OpenMPIFile(string val_filename, bool temporary = false);
 
   /*!
    * \brief Close a file using MPI I/O.
@@ -30,6 +30,8 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  unsigned long nAggregators; /*!< \brief Number of ranks that gather and write the data, 0 for all ranks. */
+  bool async;                 /*!< \brief Write the data from a background thread. */
 
 public:
 
@@ -41,8 +43,10 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valAggregators - Number of ranks that gather and write the data, 0 for all ranks.
+   * \param[in] valAsync - Write the data from a background thread while the solver continues.
    */
-  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter, unsigned long valAggregators = 0, bool valAsync = false);
 
   /*!
    * \brief Destructor
@@ -32,6 +32,27 @@ class CSU2MeshFileWriter final: public CFileWriter{
 private:
   unsigned short iZone, //!< Index of the current zone
   nZone;                //!< Number of zones
+  bool binary;          //!< Write the SU2 binary mesh format
+
+  /*!
+   * \brief Marker read from the boundary file written by SU2_DEF.
+   */
+  struct BoundaryMarker {
+    string tag;                 //!< Name of the marker
+    unsigned long sendTo = 0;   //!< SEND_TO value (deprecated SEND_RECEIVE markers)
+    vector<unsigned long> conn; //!< Elements as [VTK n0 n1 n2 n3]
+  };
+
+  /*!
+   * \brief Read the markers from the boundary file (master rank only).
+   */
+  vector<BoundaryMarker> ReadBoundaryFile() const;
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh format, see SU2BinaryMesh.
+   * \param[in] val_filename - The name of the file
+   */
+  void WriteBinaryData(string val_filename);
 
 public:
 
@@ -40,14 +61,20 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief File extension of the binary format
+   */
+  const static string binaryFileExt;
+
   /*!
    * \brief Construct a file writer using field names, dimension.
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valBinary - Write the SU2 binary mesh format instead of ASCII
    */
   CSU2MeshFileWriter(CParallelDataSorter* valDataSorter,
-                     unsigned short valiZone, unsigned short valnZone);
+                     unsigned short valiZone, unsigned short valnZone, bool valBinary = false);
 
   /*!
    * \brief Write sorted data to file in SU2 mesh file format
@@ -36,6 +36,13 @@
  * \author R. Sanchez.
  */
 class CFEASolver : public CFEASolverBase {
+public:
+#ifndef CODI_FORWARD_TYPE
+  using MatrixFreeScalar = su2mixedfloat;  /*!< \brief Type of the matrix-free operator, same as the Jacobian. */
+#else
+  using MatrixFreeScalar = su2double;
+#endif
+
 protected:
 
   unsigned long omp_chunk_size;     /*!< \brief Chunk size used in light point loops. */
@@ -83,6 +90,20 @@ protected:
   CSysMatrix<su2double> MassMatrix;
 #endif
 
+  /*--- Matrix-free mode, the Jacobian and the mass matrix are not allocated. ---*/
+  bool MatrixFree = false;                       /*!< \brief Apply the tangent operator element by element. */
+  CNumerics** MatrixFreeNumerics = nullptr;      /*!< \brief Numerics used to compute the element matrices. */
+  vector<unsigned char> FixedDOF;                /*!< \brief DOFs with essential BCs (identity rows and zero columns). */
+  vector<MatrixFreeScalar> DiagBlocks;           /*!< \brief Diagonal blocks of the stiffness matrix. */
+  vector<MatrixFreeScalar> InvDiagBlocks;        /*!< \brief Inverse diagonal blocks of the tangent operator (block-Jacobi). */
+  bool InvDiagBlocksValid = false;               /*!< \brief InvDiagBlocks match DiagBlocks, which with modified
+                                                      Newton-Raphson are only assembled in the first iteration. */
+  vector<MatrixFreeScalar> MassDiag;             /*!< \brief Diagonal of the mass matrix (nodal blocks are scalar). */
+  CSysVector<MatrixFreeScalar> MatrixFreeSol;    /*!< \brief Solution of the linear system in the type of the Krylov solver. */
+  CSysVector<MatrixFreeScalar> MatrixFreeRes;    /*!< \brief Rhs of the linear system in the type of the Krylov solver. */
+
+  bool ElementBatches = false;  /*!< \brief Compute the element matrices for SIMD-width batches of elements. */
+
   CProperty** element_properties = nullptr; /*!< \brief Vector which stores the properties of each element */
 
 #ifdef HAVE_OMP
@@ -164,6 +185,81 @@ protected:
    */
   void Set_VertexEliminationSchedule(CGeometry *geometry, const vector<unsigned short>& markers);
 
+  /*!
+   * \brief Impose a known solution at a node, on the Jacobian or on the matrix-free operator.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] x - Solution at the node.
+   */
+  inline void EnforceSolutionAtNode(unsigned long iPoint, const su2double* x) {
+    if (!MatrixFree) {
+      Jacobian.EnforceSolutionAtNode(iPoint, x, LinSysRes);
+      return;
+    }
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      FixedDOF[iPoint*nVar+iVar] = true;
+      LinSysRes(iPoint,iVar) = x[iVar];
+    }
+  }
+
+  /*!
+   * \brief Impose a known solution at one DOF of a node, on the Jacobian or on the matrix-free operator.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] iVar - Index of the variable.
+   * \param[in] x - Solution for the DOF.
+   */
+  inline void EnforceSolutionAtDOF(unsigned long iPoint, unsigned long iVar, su2double x) {
+    if (!MatrixFree) {
+      Jacobian.EnforceSolutionAtDOF(iPoint, iVar, x, LinSysRes);
+      return;
+    }
+    FixedDOF[iPoint*nVar+iVar] = true;
+    LinSysRes(iPoint,iVar) = x;
+  }
+
+  /*!
+   * \brief Clear the tangent matrix before assembly (the diagonal blocks in matrix-free mode).
+   * \note Called by all threads of a parallel region.
+   */
+  void SetTangentMatrixZero();
+
+  /*!
+   * \brief Add the stiffness and nodal stress terms of an element to the tangent matrix and to the residual.
+   * \note The element may be a CElement or a lane of a CFEAElementBatch.
+   * \param[in] element - Element with the computed terms.
+   * \param[in] indexNode - Global indices of the nodes of the element.
+   * \param[in] nNodes - Number of nodes of the element.
+   * \param[in] simp_penalty - Penalty applied to the stiffness in topology mode.
+   */
+  template<class ElementType>
+  void AddElementTerms(const ElementType& element, const unsigned long* indexNode,
+                       unsigned short nNodes, su2double simp_penalty);
+
+  /*!
+   * \brief Compute the stiffness matrix and the nodal stress residual (Compute_StiffMatrix and
+   *        Compute_StiffMatrix_NodalStressRes) evaluating SIMD-width batches of elements of the
+   *        same kind and material, elements of materials without batch support are computed one by one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] prestretch - Whether the reference coordinates are the prestretched ones.
+   */
+  void Compute_StiffMatrix_Batched(CGeometry *geometry, CNumerics **numerics, const CConfig *config, bool prestretch);
+
+  /*!
+   * \brief Solve the linear system with the matrix-free operator and block-Jacobi preconditioning.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixFreeSolve(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Compute the residual of the linear system (A x - b) with the matrix-free operator.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return The residual vector.
+   */
+  CSysVector<MatrixFreeScalar> MatrixFreeLinearResidual(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Compute constants for time integration.
    * \param[in] config - Definition of the particular problem.
@@ -232,6 +328,30 @@ public:
    */
   ~CFEASolver(void) override;
 
+  /*!
+   * \brief Product of the tangent operator (plus the mass term in dynamic problems) with a vector, v = A u,
+   *        computed element by element with the numerics of the material models.
+   * \note Called by all threads of a parallel region.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] u - Input vector.
+   * \param[out] v - Output vector.
+   * \param[in] applyBCs - Use identity rows and zero columns for the DOFs with essential BCs.
+   */
+  void MatrixFreeProduct(CGeometry *geometry, const CConfig *config, const CSysVector<MatrixFreeScalar>& u,
+                         CSysVector<MatrixFreeScalar>& v, bool applyBCs);
+
+  /*!
+   * \brief Apply the block-Jacobi preconditioner of the matrix-free operator, v = D^{-1} u.
+   * \note Called by all threads of a parallel region.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] u - Input vector.
+   * \param[out] v - Output vector.
+   */
+  void MatrixFreePreconditioner(CGeometry *geometry, const CConfig *config, const CSysVector<MatrixFreeScalar>& u,
+                                CSysVector<MatrixFreeScalar>& v) const;
+
   /*!
    * \brief Set residuals to zero.
    * \param[in] geometry - Geometrical definition of the problem.
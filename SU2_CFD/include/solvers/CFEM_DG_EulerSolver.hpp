@@ -40,10 +40,12 @@
 class CFEM_DG_EulerSolver : public CSolver {
 protected:
 
+  static constexpr size_t OMP_MIN_SIZE = 32; /*!< \brief Min chunk size for the light element loops. */
+
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief fluid model used in the solver, one object per thread */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -170,6 +172,11 @@ protected:
 
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
 
+  unsigned long strideWorkArraySumFact; /*!< \brief Size per OpenMP thread of the work array for the sum
+                                                     factorization kernels of the standard elements. */
+  vector<su2double> workArraySumFact;   /*!< \brief Work array for the sum factorization kernels, which
+                                                     contains strideWorkArraySumFact entries per thread. */
+
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
 
@@ -209,6 +216,9 @@ protected:
   vector<unsigned long> startLocResInternalFacesWithHaloElem; /*!< \brief The starting location in the residual of the
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
+  vector<unsigned long> startLocResInternalFaces; /*!< \brief The starting location in the residual of the
+                                                              faces for every internal matching face. Needed to
+                                                              split a range of faces over the OpenMP threads. */
 
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
@@ -324,7 +334,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -1681,4 +1691,113 @@ protected:
     NPad  = llEnd*nVar;
     if( NPad%nPadMin ) NPad += nPadMin - (NPad%nPadMin);
   }
+
+  /*!
+   * \brief Function, which interpolates the data of a chunk of volume elements from the DOFs to
+            the integration points and/or computes its parametric derivatives there. Sum
+            factorization is used if the standard element supports it, otherwise a gemm call.
+   * \param[in]  config     - Definition of the particular problem.
+   * \param[in]  ind        - Index of the standard element.
+   * \param[in]  NPad       - Padded N value in the matrix products.
+   * \param[in]  firstBlock - First block of the basis function matrix to be used,
+                              0 for the interpolation, 1 for the r-derivative, etc.
+   * \param[in]  nBlocks    - Number of consecutive blocks to be computed.
+   * \param[in]  dataDOFs   - Data in the DOFs.
+   * \param[out] dataInt    - Data in the integration points, stored per block.
+   */
+  void VolumeDOFsToIntegration(CConfig              *config,
+                               const unsigned short ind,
+                               const unsigned short NPad,
+                               const unsigned short firstBlock,
+                               const unsigned short nBlocks,
+                               const su2double      *dataDOFs,
+                               su2double            *dataInt);
+
+  /*!
+   * \brief Function, which multiplies data of a chunk of volume elements in the integration
+            points with the transpose of the basis functions or of its parametric derivatives.
+            Sum factorization is used if the standard element supports it, otherwise a gemm call.
+   * \param[in]  config      - Definition of the particular problem.
+   * \param[in]  ind         - Index of the standard element.
+   * \param[in]  NPad        - Padded N value in the matrix products.
+   * \param[in]  derivatives - If true, dataInt contains the nDim parametric fluxes per integration
+                               point, which are multiplied with the transpose of the derivatives.
+                               If false, dataInt contains one value per integration point, which
+                               is multiplied with the transpose of the basis functions.
+   * \param[in]  dataInt     - Data in the integration points.
+   * \param[out] dataDOFs    - Result in the DOFs.
+   */
+  void VolumeIntegrationToDOFs(CConfig              *config,
+                               const unsigned short ind,
+                               const unsigned short NPad,
+                               const bool           derivatives,
+                               const su2double      *dataInt,
+                               su2double            *dataDOFs);
+
+  /*!
+   * \brief Function, which determines the distance between the work arrays of the
+            individual OpenMP threads. It is rounded up to 64 bytes to avoid false sharing.
+   * \return The stride of the work array per thread.
+   */
+  inline unsigned long StrideWorkArrayThread(void) const {
+    return nextMultiple(sizeWorkArray, 64/sizeof(passivedouble));
+  }
+
+  /*!
+   * \brief Template function, which carries out a task for a range of elements or faces
+            with the available OpenMP threads. The range is split in parts, whose size
+            is a multiple of the number of entities treated simultaneously in the gemm
+            calls, and these parts are distributed dynamically over the threads.
+   * \param[in] config     - Definition of the particular problem.
+   * \param[in] indBeg     - Begin index of the range.
+   * \param[in] indEnd     - End index (not included) of the range.
+   * \param[in] workArray  - Work array, which contains StrideWorkArrayThread()
+                             entries for every OpenMP thread.
+   * \param[in] task       - Functor, which carries out the task for a part of the range.
+                             Its arguments are the begin and end index of the part
+                             and the work array of the thread.
+   * \param[in] canThread  - Whether or not the task can be carried out by multiple threads.
+   */
+  template <class TTask>
+  void ThreadedRangeTask(const CConfig       *config,
+                         const unsigned long indBeg,
+                         const unsigned long indEnd,
+                         su2double           *workArray,
+                         const TTask         &task,
+                         const bool          canThread = true) const {
+
+    /* Determine the size of the parts, such that every thread gets several
+       parts for load balancing, and the corresponding number of parts. */
+    const unsigned long nEntities = indEnd - indBeg;
+    const unsigned long nSimul    = max(config->GetSizeMatMulPadding()/nVar, 1);
+    const unsigned long nThreads  = omp_get_max_threads();
+    const unsigned long partSize  = nSimul*max(nEntities/(4*nThreads*nSimul), 1ul);
+    const unsigned long nParts    = roundUpDiv(nEntities, partSize);
+
+    /* The gemm timers of the profiling are not thread safe. */
+#ifdef PROFILE
+    const bool useThreads = false;
+#else
+    const bool useThreads = canThread && (nThreads > 1) && (nParts > 1);
+#endif
+
+    if( !useThreads ) {
+      if(nEntities > 0) task(indBeg, indEnd, workArray);
+      return;
+    }
+
+    SU2_OMP_PARALLEL
+    {
+      su2double *workArrayThread = workArray + omp_get_thread_num()*StrideWorkArrayThread();
+
+      SU2_OMP_FOR_DYN(1)
+      for(unsigned long iPart=0; iPart<nParts; ++iPart) {
+        const unsigned long partBeg = indBeg + iPart*partSize;
+        const unsigned long partEnd = min(partBeg+partSize, indEnd);
+        task(partBeg, partEnd, workArrayThread);
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+  }
 };
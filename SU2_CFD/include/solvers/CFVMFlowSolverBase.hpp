@@ -204,6 +204,16 @@ class CFVMFlowSolverBase : public CSolver {
   static constexpr bool ReducerStrategy = false;
 #endif
 
+  /*--- Edge colors split into the groups of edges between owned points and the groups that touch halo
+   * points, the halo exchange of the reconstruction data is overlapped with the former. ---*/
+
+  vector<unsigned long> OverlapEdgeIdx;      /*!< \brief Edge indices of the two colorings below. */
+  vector<GridColor<> > InteriorEdgeColoring; /*!< \brief Colors of the edge groups without halo points. */
+  vector<GridColor<> > HaloEdgeColoring;     /*!< \brief Colors of the edge groups with halo points. */
+  bool DeferHaloComms = false;      /*!< \brief The reconstruction data is exchanged by the residual loop. */
+  bool GradRecHalosPending = false; /*!< \brief The reconstruction gradients at halo points are out of date. */
+  bool LimiterHalosPending = false; /*!< \brief The limiters at halo points are out of date. */
+
   /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids.
    * We first store the fluxes and then compute the sum for each cell.
    * This strategy is thread-safe but lower performance than writting to both
@@ -268,10 +278,73 @@ class CFVMFlowSolverBase : public CSolver {
    */
   su2double EvaluateCommonObjFunc(const CConfig& config) const;
 
+  /*!
+   * \brief Whether the min/max of the primitives for the limiters are gathered together with the
+   *        reconstruction gradients (in the same pass over the neighbors of each point).
+   * \note Needs to give the same answer in SetPrimitive_Gradient_GG/LS and in SetPrimitive_Limiter.
+   */
+  bool FusedGradientLimiter(const CConfig* config) const;
+
+  /*!
+   * \brief Split the edge colors into the groups of edges between owned points and those that touch halo points.
+   * \note Groups are not split to keep the coloring valid, the edges of a color keep their order.
+   */
+  void SetOverlapEdgeColoring(const CGeometry& geometry);
+
+  /*!
+   * \brief Whether the halo exchange of the reconstruction gradients and limiters can be left to the residual loop.
+   */
+  inline bool OverlapHaloComms(const CConfig* config) const {
+    return config->GetOverlap_Halo_Comms() && (config->GetnMarker_Periodic() == 0) && !config->GetDiscrete_Adjoint() &&
+           (MGLevel == MESH_0) && !(InteriorEdgeColoring.empty() && HaloEdgeColoring.empty());
+  }
+
+  /*!
+   * \brief Type of the comms that exchange the deferred reconstruction data.
+   */
+  inline MPI_QUANTITIES PendingHaloCommsType() const {
+    if (!LimiterHalosPending) return MPI_QUANTITIES::PRIMITIVE_GRAD_REC;
+    if (!GradRecHalosPending) return MPI_QUANTITIES::PRIMITIVE_LIMITER;
+    return MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION;
+  }
+
+  /*!
+   * \brief Start the exchange of the reconstruction data at halo points, if it was deferred.
+   * \return True if there are comms in flight (the residual loop should then overlap them with the interior edges).
+   */
+  bool InitiatePendingHaloComms(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Complete the exchange started by InitiatePendingHaloComms.
+   */
+  void CompletePendingHaloComms(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Apply a task to the edges of a list of colors (in parallel within each color).
+   * \param[in] colors - List of edge colors.
+   * \param[in] task - Called with each edge index.
+   */
+  template <class ColorList, class EdgeTask>
+  static void LoopOverEdgeColors(const ColorList& colors, const EdgeTask& task) {
+    for (auto color : colors) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) task(color.indices[k]);
+      END_SU2_OMP_FOR
+    }
+  }
+
+  /*!
+   * \brief Compute the vectorized edge fluxes of a list of colors.
+   * \return Thread-local count of non-physical reconstructions.
+   */
+  template <class ColorList>
+  unsigned long EdgeFluxColors(const ColorList& colors, const CGeometry& geometry, const CConfig& config);
+
   /*!
    * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
    */
-  void EdgeFluxResidual(const CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
@@ -910,7 +983,8 @@ class CFVMFlowSolverBase : public CSolver {
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
 
-    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    /*--- The current scheme, rather than the flow scheme, to let the Newton-Krylov integration reuse the Jacobian. ---*/
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
     /*--- Local residual variables for current thread ---*/
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
@@ -367,6 +367,71 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 #endif
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetOverlapEdgeColoring(const CGeometry& geometry) {
+  const auto nEdge = geometry.GetnEdge();
+
+  /*--- The edges of a color are processed in chunks of whole groups (consecutive edges), the coloring is only valid if
+   *    the groups stay together. Flag the groups with edges that touch halo points. ---*/
+#ifdef HAVE_OMP
+  const bool grouped = !EdgeColoring.empty() && (omp_get_max_threads() > 1);
+  const unsigned long groupSize = grouped ? EdgeColoring[0].groupSize : 1ul;
+#else
+  const unsigned long groupSize = 1;
+#endif
+  vector<bool> haloGroup(roundUpDiv(nEdge, groupSize), false);
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto iPoint = geometry.edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry.edges->GetNode(iEdge, 1);
+    if (!geometry.nodes->GetDomain(iPoint) || !geometry.nodes->GetDomain(jPoint)) haloGroup[iEdge / groupSize] = true;
+  }
+
+  /*--- Copy the edges of each color into the interior or halo part, the partial group of the last edges (if any) is
+   *    still at the end of its color. ---*/
+  OverlapEdgeIdx.clear();
+  OverlapEdgeIdx.reserve(nEdge);
+  vector<unsigned long> colorPtr(1, 0);
+
+  for (const bool halo : {false, true}) {
+    for (const auto& color : EdgeColoring) {
+      for (auto k = 0ul; k < color.size; ++k) {
+        const auto iEdge = color.indices[k];
+        if (haloGroup[iEdge / groupSize] == halo) OverlapEdgeIdx.push_back(iEdge);
+      }
+      colorPtr.push_back(OverlapEdgeIdx.size());
+    }
+  }
+
+  const auto nColor = EdgeColoring.size();
+  InteriorEdgeColoring.clear();
+  HaloEdgeColoring.clear();
+
+  for (auto iColor = 0ul; iColor < 2 * nColor; ++iColor) {
+    const auto size = colorPtr[iColor + 1] - colorPtr[iColor];
+    if (size == 0) continue;
+    auto& colors = (iColor < nColor) ? InteriorEdgeColoring : HaloEdgeColoring;
+    colors.emplace_back(OverlapEdgeIdx.data() + colorPtr[iColor], size, groupSize);
+  }
+}
+
+template <class V, ENUM_REGIME R>
+bool CFVMFlowSolverBase<V, R>::InitiatePendingHaloComms(CGeometry* geometry, const CConfig* config) {
+  if (!GradRecHalosPending && !LimiterHalosPending) return false;
+
+  InitiateComms(geometry, config, PendingHaloCommsType());
+  return true;
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::CompletePendingHaloComms(CGeometry* geometry, const CConfig* config) {
+  CompleteComms(geometry, config, PendingHaloCommsType());
+
+  /*--- All threads must be done reading the flags. ---*/
+  SU2_OMP_BARRIER
+  ompMasterAssignBarrier(GradRecHalosPending, false, LimiterHalosPending, false);
+}
+
 template <class V, ENUM_REGIME R>
 CFVMFlowSolverBase<V, R>::~CFVMFlowSolverBase() {
 
@@ -386,7 +451,18 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
-  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient);
+  /*--- Gather the min/max for the limiters in the same pass, if this gradient is the one used for reconstruction. ---*/
+  const bool minMax = FusedGradientLimiter(config) && (&gradient == &nodes->GetGradient_Reconstruction());
+  auto* primMin = minMax ? &nodes->GetSolution_Min() : nullptr;
+  auto* primMax = minMax ? &nodes->GetSolution_Max() : nullptr;
+
+  /*--- If the halo exchange is deferred to the residual loop, do not communicate here. ---*/
+  const bool defer = reconstruction && DeferHaloComms;
+
+  computeGradientsGreenGauss(defer ? nullptr : this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad,
+                             prim_idx.Velocity(), gradient, primMin, primMax);
+
+  if (defer) ompMasterAssignBarrier(GradRecHalosPending, true);
 }
 
 template <class V, ENUM_REGIME R>
@@ -410,8 +486,16 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
 
-  computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
-                               primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix);
+  const bool minMax = FusedGradientLimiter(config) && (&gradient == &nodes->GetGradient_Reconstruction());
+  auto* primMin = minMax ? &nodes->GetSolution_Min() : nullptr;
+  auto* primMax = minMax ? &nodes->GetSolution_Max() : nullptr;
+
+  const bool defer = reconstruction && DeferHaloComms;
+
+  computeGradientsLeastSquares(defer ? nullptr : this, comm, commPer, *geometry, *config, weighted,
+                               primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix, primMin, primMax);
+
+  if (defer) ompMasterAssignBarrier(GradRecHalosPending, true);
 }
 
 template <class V, ENUM_REGIME R>
@@ -423,8 +507,24 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
-  computeLimiters(kindLimiter, this, MPI_QUANTITIES::PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
-                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+  computeLimiters(kindLimiter, DeferHaloComms ? nullptr : this, MPI_QUANTITIES::PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1,
+                  PERIODIC_LIM_PRIM_2, *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax,
+                  limiter, FusedGradientLimiter(config));
+
+  if (DeferHaloComms) ompMasterAssignBarrier(LimiterHalosPending, true);
+}
+
+template <class V, ENUM_REGIME R>
+bool CFVMFlowSolverBase<V, R>::FusedGradientLimiter(const CConfig* config) const {
+  /*--- The min/max over neighbors do not depend on the gradients, but periodic pairs need communication
+   * before the min/max are computed, and NEMO has its own gradient implementation. Frozen limiters for
+   * the discrete adjoint also need a passive min/max, so the fused mode is used only for the primal. ---*/
+  const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
+  return config->GetFused_Gradient_Limiter() && (MGLevel == MESH_0) && config->GetMUSCL_Flow() &&
+         (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+         (kindLimiter != LIMITER::NONE) && (kindLimiter != LIMITER::VAN_ALBADA_EDGE) &&
+         (config->GetInnerIter() <= config->GetLimiterIter()) && (config->GetnMarker_Periodic() == 0) &&
+         !config->GetDiscrete_Adjoint() && !config->GetNEMOProblem();
 }
 
 template <class V, ENUM_REGIME R>
@@ -1475,32 +1575,13 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
-                                                const CSolver* const* solvers,
-                                                CConfig *config) {
-  if (!edgeNumerics) {
-    if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
-        (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
-      SU2_MPI::Error("When using vectorization, the EDGE_COLORING_GROUP_SIZE must be divisible "
-                     "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
-    }
-    InstantiateEdgeNumerics(solvers, config);
-  }
-
-  /*--- Non-physical counter. ---*/
+template <class ColorList>
+unsigned long CFVMFlowSolverBase<V, R>::EdgeFluxColors(const ColorList& colors, const CGeometry& geometry,
+                                                       const CConfig& config) {
   unsigned long counterLocal = 0;
-  SU2_OMP_MASTER
-  ErrorCounter = 0;
-  END_SU2_OMP_MASTER
-
-  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
-  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
-  bool pausePreacc = false;
-  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
-  else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
+  for (auto color : colors) {
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
     SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for(auto k = 0ul; k < color.size; k += Double::Size) {
@@ -1513,9 +1594,9 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
       }
 
       if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+        edgeNumerics->ComputeFlux(iEdge, config, geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
       } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+        edgeNumerics->ComputeFlux(iEdge, config, geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
       }
       if (MGLevel == MESH_0) {
         for (auto j = 0ul; j < Double::Size; ++j)
@@ -1524,6 +1605,43 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     }
     END_SU2_OMP_FOR
   }
+  return counterLocal;
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(CGeometry *geometry,
+                                                const CSolver* const* solvers,
+                                                CConfig *config) {
+  if (!edgeNumerics) {
+    if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
+        (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
+      SU2_MPI::Error("When using vectorization, the EDGE_COLORING_GROUP_SIZE must be divisible "
+                     "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
+    }
+    InstantiateEdgeNumerics(solvers, config);
+  }
+
+  /*--- Non-physical counter. ---*/
+  unsigned long counterLocal = 0;
+  SU2_OMP_MASTER
+  ErrorCounter = 0;
+  END_SU2_OMP_MASTER
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+  * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
+
+  /*--- If the reconstruction data at halo points is in flight, compute the fluxes of the
+   *    edges between owned points first and finish the comms before the other edges. ---*/
+  if (InitiatePendingHaloComms(geometry, config)) {
+    counterLocal += EdgeFluxColors(InteriorEdgeColoring, *geometry, *config);
+    CompletePendingHaloComms(geometry, config);
+    counterLocal += EdgeFluxColors(HaloEdgeColoring, *geometry, *config);
+  } else {
+    counterLocal += EdgeFluxColors(EdgeColoring, *geometry, *config);
+  }
 
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
 }
@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +80,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation (if supported). */
+  bool numericsSIMDInstantiated = false; /*!< \brief If the vectorized numerics have been created (they may be null). */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -297,6 +302,28 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Instantiate the vectorized numerics, derived solvers that support them set edgeNumerics (and optionally
+   *        other SIMD objects) and leave it null when the current options are not supported.
+   * \note Called by all threads, the allocation must be done inside a safe global access region.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateNumericsSIMD(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Instantiate the vectorized numerics on the first call.
+   * \return True if edgeNumerics can be used.
+   */
+  bool PrepareNumericsSIMD(const CSolver* const* solvers, const CConfig* config);
+
+  /*!
+   * \brief Compute the convective and viscous fluxes with the vectorized edge numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, const CConfig* config);
+
  private:
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
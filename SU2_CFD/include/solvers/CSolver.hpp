@@ -73,6 +73,8 @@ protected:
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
+  unsigned long JacobianAge;     /*!< \brief Iterations since the Jacobian was updated (Newton-Krylov reuse). */
+  unsigned long JacobianUpdates; /*!< \brief Number of Jacobian updates (Newton-Krylov reuse). */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
@@ -316,6 +318,16 @@ public:
    */
   inline void SetResLinSolver(su2double val_reslinsolver) { ResLinSolver = val_reslinsolver; }
 
+  /*!
+   * \brief Set the statistics of the reuse of the Jacobian across nonlinear iterations.
+   * \param[in] age - Iterations since the Jacobian used in the current iteration was updated.
+   * \param[in] updates - Total number of updates of the Jacobian.
+   */
+  inline void SetJacobianReuse(unsigned long age, unsigned long updates) {
+    JacobianAge = age;
+    JacobianUpdates = updates;
+  }
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -363,6 +375,18 @@ public:
    */
   inline su2double GetResLinSolver(void) const { return ResLinSolver; }
 
+  /*!
+   * \brief Get the number of iterations since the Jacobian was updated.
+   * \return Age of the Jacobian used in the current iteration.
+   */
+  inline unsigned long GetJacobianAge(void) const { return JacobianAge; }
+
+  /*!
+   * \brief Get the number of updates of the Jacobian.
+   * \return Total number of updates of the Jacobian.
+   */
+  inline unsigned long GetJacobianUpdates(void) const { return JacobianUpdates; }
+
   /*!
    * \brief Get the value of the maximum delta time.
    * \return Value of the maximum delta time.
@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
+class CSourceNumericsSIMD;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -42,6 +44,24 @@ protected:
 
   vector<su2activematrix> Inlet_TurbVars;  /*!< \brief Turbulence variables at inlet profiles */
 
+  CSourceNumericsSIMD* sourceNumerics = nullptr; /*!< \brief Object for vectorized source computation (if supported). */
+
+  /*!
+   * \brief Instantiate the vectorized edge and source numerics of the turbulence model (if supported).
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateNumericsSIMD(const CSolver* const* solvers, const CConfig* config) final;
+
+  /*!
+   * \brief Compute the source terms with the vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the current options are not supported, in which case nothing is computed.
+   */
+  bool Source_Residual_SIMD(const CGeometry* geometry, const CSolver* const* solver_container, const CConfig* config);
+
 public:
   /*!
    * \brief Destructor of the class.
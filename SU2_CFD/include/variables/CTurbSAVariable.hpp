@@ -67,6 +67,11 @@ public:
    */
   inline su2double GetDES_LengthScale(unsigned long iPoint) const override { return DES_LengthScale(iPoint); }
 
+  /*!
+   * \brief Get the DES length scale of all points.
+   */
+  inline const VectorType& GetDES_LengthScale() const { return DES_LengthScale; }
+
   /*!
    * \brief Set the DES Length Scale.
    * \param[in] iPoint - Point index.
@@ -87,4 +87,14 @@ public:
    * \brief Get the value of the cross diffusion of tke and omega.
    */
   inline su2double GetCrossDiff(unsigned long iPoint) const override { return CDkw(iPoint); }
+
+  /*!
+   * \brief Get the first blending function of all points.
+   */
+  inline const VectorType& GetF1blending() const { return F1; }
+
+  /*!
+   * \brief Get the cross diffusion of all points.
+   */
+  inline const VectorType& GetCrossDiff() const { return CDkw; }
 };
@@ -581,6 +581,12 @@ public:
    */
   inline su2double GetLocalCFL(unsigned long iPoint) const { return LocalCFL(iPoint); }
 
+  /*!
+   * \brief Get the local CFL numbers of all the points (empty if the variable does not use them).
+   * \return Reference to the local CFL numbers.
+   */
+  inline VectorType& GetLocalCFL() { return LocalCFL; }
+
   /*!
    * \brief Get the entire Aux matrix of the problem.
    * \return Reference to the aux var  matrix.
@@ -728,6 +734,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -774,6 +781,7 @@ public:
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
@@ -31,12 +31,16 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
+#include "../../../Common/include/geometry/CPartitionCosts.hpp"
+#include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
 
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/filewriter/CFileWriter.hpp"
 
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
@@ -361,6 +365,61 @@ void CDriver::Finalize() {
   if (rank == MASTER_NODE)
     cout <<"\n--------------------------- Finalizing Solver ---------------------------" << endl;
 
+  /*--- Write the measured costs of the work that is weighted by the partitioning. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto* config = config_container[iZone];
+    if (!config->GetParMETIS_Calibration() || config->GetFEMSolver()) continue;
+
+    const auto* geometry = geometry_container[iZone][INST_0][MESH_0];
+
+    array<passivedouble, CPartitionCosts::N_COST_TYPES> time{};
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      const auto* integration = integration_container[iZone][INST_0][iSol];
+      if (integration == nullptr) continue;
+      for (int iCost = 0; iCost < CPartitionCosts::N_COST_TYPES; iCost++) time[iCost] += integration->GetCostTimes()[iCost];
+    }
+
+    array<unsigned long, CPartitionCosts::N_COST_TYPES> count{};
+    count[CPartitionCosts::POINT_COST] = geometry->GetnPointDomain();
+    count[CPartitionCosts::NEIGHBOR_COST] = 2 * geometry->GetnEdge();
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (!config->GetViscous_Wall(iMarker)) continue;
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        count[CPartitionCosts::WALL_COST] += geometry->nodes->GetDomain(geometry->vertex[iMarker][iVertex]->GetNode());
+      }
+    }
+    CPartitionCosts::WriteCalibration(config, time, count);
+  }
+
+  /*--- Let the background thread finish the asynchronous restart writes. ---*/
+
+  CFileWriter::WaitPendingWrites();
+
+  /*--- Gather the statistics of the compressed solver halo exchanges before the geometry is deleted. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    HaloStatistics |= (config_container[iZone]->GetKind_Halo_Compression() != HALO_COMPRESSION::NONE);
+  }
+  if (HaloStatistics) {
+    passivedouble haloTime = 0.0;
+    unsigned long haloBytes[2] = {0, 0}, globalHaloBytes[2] = {0, 0};
+    for (iZone = 0; iZone < nZone; iZone++) {
+      for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+        for (unsigned short iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+          const auto* geometry = geometry_container[iZone][iInst][iMesh];
+          if (geometry == nullptr) continue;
+          haloTime += geometry->timeP2P;
+          haloBytes[0] += geometry->bytesP2PFull;
+          haloBytes[1] += geometry->bytesP2PSent;
+        }
+      }
+    }
+    CBaseMPIWrapper::Allreduce(&haloTime, &HaloTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(haloBytes, globalHaloBytes, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if (globalHaloBytes[1] > 0) HaloCompression = passivedouble(globalHaloBytes[0]) / globalHaloBytes[1];
+  }
+
   for (iZone = 0; iZone < nZone; iZone++) {
     for (iInst = 0; iInst < nInst[iZone]; iInst++){
       FinalizeNumerics(numerics_container[iZone], solver_container[iZone][iInst],
@@ -521,6 +580,10 @@ void CDriver::Finalize() {
       cout << setw(25) << "Core-s/iter/Mpoints:" << setw(12)<< size*UsedTimeCompute/IterCount/Mpoints << " | ";
       cout << setw(20) << "Mpoints/s:" << setw(12)<< Mpoints*IterCount/UsedTimeCompute << endl;
     } else cout << endl;
+    if (size > SINGLE_NODE && HaloStatistics) {
+      cout << setw(25) << "Halo Exch. Time (s):" << setw(12)<< HaloTime << " | ";
+      cout << setw(20) << "Halo Compr. Ratio:" << setw(12)<< HaloCompression << endl;
+    }
     cout << endl;
     cout << "Output phase:" << endl;
     cout << setw(25) << "Output Time (s):"  << setw(12)<< UsedTimeOutput << " | ";
@@ -690,6 +753,19 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   unsigned short requestedMGlevels = config->GetnMGLevels();
   const bool fea = config->GetStructuralProblem();
 
+  /*--- Optional cache of the partitioning, ordering, and agglomeration. ---*/
+
+  unique_ptr<CGeometryCache> cache;
+  if (config->GetGeometry_Cache()) cache.reset(new CGeometryCache(config));
+
+  /*--- Partitioning computed by the load rebalancing, it is recorded in the cache if there is one. ---*/
+
+  if (!imposedPartition.empty()) {
+    if (!cache) cache.reset(new CGeometryCache(config, false));
+    cache->ImposePartition(move(imposedPartition));
+    imposedPartition.clear();
+  }
+
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
@@ -701,7 +777,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  geometry_aux->SetColorGrid_Parallel(config, cache.get());
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -727,10 +803,16 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee ordering or a space filling curve ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (rank == MASTER_NODE) {
+    switch (config->GetKind_PointOrdering()) {
+      case POINT_ORDERING::RCM: cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl; break;
+      case POINT_ORDERING::HILBERT: cout << "Renumbering points (Hilbert curve Ordering)." << endl; break;
+      case POINT_ORDERING::MORTON: cout << "Renumbering points (Morton curve Ordering)." << endl; break;
+    }
+  }
+  geometry[MESH_0]->SetPoint_Ordering(config, cache.get());
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -816,7 +898,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
     /*--- Create main agglomeration structure ---*/
 
-    geometry[iMGlevel] = new CMultiGridGeometry(geometry[iMGlevel-1], config, iMGlevel);
+    geometry[iMGlevel] = new CMultiGridGeometry(geometry[iMGlevel-1], config, iMGlevel, cache.get());
 
     /*--- Compute points surrounding points. ---*/
 
@@ -856,6 +938,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   if (config->GetWrt_MultiGrid()) geometry[MESH_0]->ColorMGLevels(config->GetnMGLevels(), geometry);
 
+  if (cache) cache->Write();
+
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
 
@@ -904,6 +988,232 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
 }
 
+bool CDriver::RebalanceZone(unsigned short iZone) {
+
+  auto* config = config_container[iZone];
+  if (size == SINGLE_NODE) return false;
+
+  /*--- Measured cost of the work done since the last check, its imbalance decides if the grid is repartitioned. ---*/
+
+  array<passivedouble, CPartitionCosts::N_COST_TYPES> time{};
+  for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+    const auto* integration = integration_container[iZone][INST_0][iSol];
+    if (integration == nullptr) continue;
+    for (int iCost = 0; iCost < CPartitionCosts::N_COST_TYPES; iCost++) time[iCost] += integration->GetCostTimes()[iCost];
+  }
+  passivedouble localTime = 0.0;
+  for (int iCost = 0; iCost < CPartitionCosts::N_COST_TYPES; iCost++) {
+    const passivedouble delta = time[iCost] - rebalanceCostTimes[iCost];
+    rebalanceCostTimes[iCost] = time[iCost];
+    time[iCost] = delta;
+    localTime += delta;
+  }
+  passivedouble maxTime = 0.0, sumTime = 0.0;
+  CBaseMPIWrapper::Allreduce(&localTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  CBaseMPIWrapper::Allreduce(&localTime, &sumTime, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  const passivedouble imbalance = (sumTime > 0.0) ? maxTime * size / sumTime : 1.0;
+
+  if (rank == MASTER_NODE) cout << "\nMeasured load imbalance (max/avg): " << imbalance << "." << endl;
+  if (imbalance <= config->GetParMETIS_Rebalance_Threshold()) return false;
+
+  CGeometry**& geometry = geometry_container[iZone][INST_0];
+  CSolver***& solver = solver_container[iZone][INST_0];
+
+  /*--- New owner of each domain point. ---*/
+
+  const auto destination = geometry[MESH_0]->ComputeRebalancedPartition(
+      config, time[CPartitionCosts::POINT_COST] + time[CPartitionCosts::NEIGHBOR_COST],
+      time[CPartitionCosts::WALL_COST]);
+
+  const auto nPointDomain = geometry[MESH_0]->GetnPointDomain();
+
+  unsigned long nMoved = 0, nMovedGlobal = 0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) nMoved += (destination[iPoint] != static_cast<unsigned long>(rank));
+  SU2_MPI::Allreduce(&nMoved, &nMovedGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  if (nMovedGlobal == 0) return false;
+
+  if (rank == MASTER_NODE) cout << "Rebalancing the partitioning, " << nMovedGlobal << " points change rank." << endl;
+
+  /*--- The state that is migrated, the solution and its previous time levels, and the local CFL numbers. ---*/
+
+  auto GetFields = [](CSolver** solverLevel, vector<su2activematrix*>& matrices, vector<su2activevector*>& vectors) {
+    matrices.clear();
+    vectors.clear();
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      if (solverLevel[iSol] == nullptr) continue;
+      auto* nodes = solverLevel[iSol]->GetNodes();
+      for (auto* field : {&nodes->GetSolution(), &nodes->GetSolution_time_n(), &nodes->GetSolution_time_n1()}) {
+        if (field->size() > 0) matrices.push_back(field);
+      }
+      if (nodes->GetLocalCFL().size() > 0) vectors.push_back(&nodes->GetLocalCFL());
+    }
+  };
+  vector<su2activematrix*> matrices;
+  vector<su2activevector*> vectors;
+  GetFields(solver[MESH_0], matrices, vectors);
+
+  /*--- The volume output also carries state (running time averages). ---*/
+
+  const auto volumeData = output_container[iZone]->GetUnsortedVolumeData(geometry[MESH_0]);
+  const auto nVolumeField = volumeData.cols();
+
+  /*--- Send the global index and the values of each point to its new owner. ---*/
+
+  unsigned long nValue = 1 + vectors.size() + nVolumeField;
+  for (const auto* field : matrices) nValue += field->cols();
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) nSend[destination[iPoint]] += nValue;
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<passivedouble> sendBuf(sendDispl[size]), recvBuf(recvDispl[size]);
+  auto position = sendDispl;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    auto* buf = &sendBuf[position[destination[iPoint]]];
+    position[destination[iPoint]] += nValue;
+
+    *(buf++) = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+    for (const auto* field : matrices)
+      for (auto iVar = 0ul; iVar < field->cols(); iVar++) *(buf++) = SU2_TYPE::GetValue((*field)(iPoint, iVar));
+    for (const auto* field : vectors) *(buf++) = SU2_TYPE::GetValue((*field)(iPoint));
+    for (auto iField = 0ul; iField < nVolumeField; iField++) *(buf++) = volumeData(iPoint, iField);
+  }
+  CBaseMPIWrapper::Alltoallv(sendBuf.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE, recvBuf.data(), nRecv.data(),
+                             recvDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  decltype(sendBuf)().swap(sendBuf);
+
+  /*--- The partitioning is imposed on the initial linear partition of the grid, send the new owner of each point
+   *    to the rank that reads it. ---*/
+
+  const CLinearPartitioner pointPartitioner(geometry[MESH_0]->GetGlobal_nPointDomain(), 0);
+
+  vector<int> nSendColor(size, 0), nRecvColor(size, 0), sendDisplColor(size + 1, 0), recvDisplColor(size + 1, 0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    nSendColor[pointPartitioner.GetRankContainingIndex(geometry[MESH_0]->nodes->GetGlobalIndex(iPoint))] += 2;
+  }
+  SU2_MPI::Alltoall(nSendColor.data(), 1, MPI_INT, nRecvColor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDisplColor[iRank + 1] = sendDisplColor[iRank] + nSendColor[iRank];
+    recvDisplColor[iRank + 1] = recvDisplColor[iRank] + nRecvColor[iRank];
+  }
+
+  vector<unsigned long> sendColor(sendDisplColor[size]), recvColor(recvDisplColor[size]);
+  auto positionColor = sendDisplColor;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto globalIndex = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+    auto& pos = positionColor[pointPartitioner.GetRankContainingIndex(globalIndex)];
+    sendColor[pos++] = globalIndex;
+    sendColor[pos++] = destination[iPoint];
+  }
+  SU2_MPI::Alltoallv(sendColor.data(), nSendColor.data(), sendDisplColor.data(), MPI_UNSIGNED_LONG, recvColor.data(),
+                     nRecvColor.data(), recvDisplColor.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  imposedPartition.assign(pointPartitioner.GetSizeOnRank(rank), 0);
+  for (auto iColor = 0ul; iColor < recvColor.size(); iColor += 2) {
+    imposedPartition[recvColor[iColor] - firstIndex] = recvColor[iColor + 1];
+  }
+
+  /*--- Release the grid and the structures that depend on it, the numerics are tied to the solvers. ---*/
+
+  FinalizeNumerics(numerics_container[iZone], solver, geometry, config, INST_0);
+  FinalizeSolver(solver_container[iZone], geometry, config, INST_0);
+  for (unsigned short iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) delete geometry[iMGlevel];
+  delete [] geometry;
+
+  /*--- Preprocess the grid with the imposed partitioning, then the solvers (without restarting them). ---*/
+
+  InitializeGeometry(config, geometry, false);
+
+  CGeometry::ComputeWallDistance(config_container, geometry_container);
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"-------------------- Solver Preprocessing ( Zone " << config->GetiZone() <<" ) --------------------" << endl;
+
+  solver = new CSolver**[config->GetnMGLevels()+1] ();
+  for (unsigned short iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    solver[iMGlevel] = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config, geometry[iMGlevel], iMGlevel);
+  }
+  PreprocessInlet(solver, geometry, config);
+
+  InitializeNumerics(config, geometry, solver, numerics_container[iZone][INST_0]);
+
+  PreprocessStaticMesh(config, geometry);
+
+  /*--- Store the received state in the new local points. ---*/
+
+  GetFields(solver[MESH_0], matrices, vectors);
+
+  su2passivematrix newVolumeData(geometry[MESH_0]->GetnPointDomain(), nVolumeField);
+
+  for (auto iRecv = 0ul; iRecv < recvBuf.size(); iRecv += nValue) {
+    const auto* buf = &recvBuf[iRecv];
+    const auto iPoint = geometry[MESH_0]->GetGlobal_to_Local_Point(static_cast<unsigned long>(*(buf++)));
+    if (iPoint < 0 || !geometry[MESH_0]->nodes->GetDomain(iPoint)) {
+      SU2_MPI::Error("A migrated point is not owned by its new rank.", CURRENT_FUNCTION);
+    }
+    for (auto* field : matrices)
+      for (auto iVar = 0ul; iVar < field->cols(); iVar++) (*field)(iPoint, iVar) = *(buf++);
+    for (auto* field : vectors) (*field)(iPoint) = *(buf++);
+    for (auto iField = 0ul; iField < nVolumeField; iField++) newVolumeData(iPoint, iField) = *(buf++);
+  }
+
+  /*--- Update the halos and the coarse grids, and recompute the secondary variables (as after a restart). ---*/
+
+  for (unsigned short iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto* sol = solver[iMGlevel][iSol];
+      if (sol == nullptr) continue;
+      auto* nodes = sol->GetNodes();
+
+      if (iMGlevel != MESH_0 && solver[iMGlevel-1][iSol] != nullptr) {
+        auto* fineNodes = solver[iMGlevel-1][iSol]->GetNodes();
+        CSolver::MultigridRestriction(*geometry[iMGlevel-1], fineNodes->GetSolution(), *geometry[iMGlevel],
+                                      nodes->GetSolution());
+        if (nodes->GetSolution_time_n().size() > 0 && fineNodes->GetSolution_time_n().size() > 0) {
+          CSolver::MultigridRestriction(*geometry[iMGlevel-1], fineNodes->GetSolution_time_n(), *geometry[iMGlevel],
+                                        nodes->GetSolution_time_n());
+        }
+        if (nodes->GetSolution_time_n1().size() > 0 && fineNodes->GetSolution_time_n1().size() > 0) {
+          CSolver::MultigridRestriction(*geometry[iMGlevel-1], fineNodes->GetSolution_time_n1(), *geometry[iMGlevel],
+                                        nodes->GetSolution_time_n1());
+        }
+      }
+
+      sol->InitiateComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION);
+      sol->CompleteComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION);
+      if (nodes->GetSolution_time_n().size() > 0) {
+        sol->InitiateComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION_TIME_N);
+        sol->CompleteComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION_TIME_N);
+      }
+      if (nodes->GetSolution_time_n1().size() > 0) {
+        sol->InitiateComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION_TIME_N1);
+        sol->CompleteComms(geometry[iMGlevel], config, MPI_QUANTITIES::SOLUTION_TIME_N1);
+      }
+    }
+
+    if (solver[iMGlevel][FLOW_SOL] != nullptr) {
+      solver[iMGlevel][FLOW_SOL]->Preprocessing(geometry[iMGlevel], solver[iMGlevel], config, iMGlevel, NO_RK_ITER,
+                                                RUNTIME_FLOW_SYS, false);
+    }
+    if (solver[iMGlevel][TURB_SOL] != nullptr) {
+      solver[iMGlevel][TURB_SOL]->Postprocessing(geometry[iMGlevel], solver[iMGlevel], config, iMGlevel);
+    }
+    if (solver[iMGlevel][SPECIES_SOL] != nullptr) {
+      solver[iMGlevel][SPECIES_SOL]->Preprocessing(geometry[iMGlevel], solver[iMGlevel], config, iMGlevel, NO_RK_ITER,
+                                                   RUNTIME_SPECIES_SYS, false);
+    }
+  }
+
+  output_container[iZone]->ResetPartitionData(config, geometry[MESH_0], newVolumeData);
+
+  return true;
+}
+
 void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
 
   /*--- Definition of the geometry class to store the primal grid in the partitioning process. ---*/
@@ -96,6 +96,14 @@ void CSinglezoneDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    /*--- Repartition the grid if the measured load has become unbalanced. ---*/
+
+    const auto rebalanceFreq = config_container[ZONE_0]->GetParMETIS_Rebalance_Freq();
+    if (rebalanceFreq > 0 && (TimeIter + 1) % rebalanceFreq == 0 &&
+        TimeIter + 1 < config_container[ZONE_0]->GetnTime_Iter()) {
+      RebalanceZone(ZONE_0);
+    }
+
     TimeIter++;
 
   }
@@ -46,6 +46,20 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
+  /*--- Measure the cost of each type of work on the fine grid to calibrate or rebalance the partitioning.
+   * Only the master thread keeps time, the loops end with barriers. ---*/
+
+  const bool timeWork = (config->GetParMETIS_Calibration() || config->GetParMETIS_Rebalance_Freq() > 0) &&
+                        (iMesh == MESH_0) && (omp_get_thread_num() == 0);
+  passivedouble tick = timeWork ? SU2_MPI::Wtime() : 0.0;
+
+  auto addTime = [&](int iCost) {
+    if (!timeWork) return;
+    const passivedouble now = SU2_MPI::Wtime();
+    if (iCost < CPartitionCosts::N_COST_TYPES) costTimes[iCost] += now - tick;
+    tick = now;
+  };
+
   /*--- Compute inviscid residuals ---*/
 
   switch (config->GetKind_ConvNumScheme()) {
@@ -60,6 +74,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /*--- Compute viscous residuals ---*/
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
 
+  addTime(CPartitionCosts::NEIGHBOR_COST);
+
   /*--- Compute source term residuals ---*/
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
 
@@ -68,6 +84,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   if (dual_time)
     solver_container[MainSolver]->SetResidual_DualTime(geometry, solver_container, config, iRKStep, iMesh, RunTime_EqSystem);
 
+  addTime(CPartitionCosts::POINT_COST);
+
   /*--- Pick convective and viscous numerics objects for the current thread. ---*/
 
   CNumerics* conv_bound_numerics = numerics[CONV_BOUND_TERM + omp_get_thread_num()*MAX_TERMS];
@@ -147,6 +165,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /*--- Modification of the system on the whole domain, like for a strong BC. ---*/
   solver_container[MainSolver]->Impose_Fixed_Values(geometry, config);
 
+  addTime(CPartitionCosts::N_COST_TYPES);
+
   /*--- Strong boundary conditions (Navier-Stokes and Dirichlet type BCs) ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
@@ -180,6 +200,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         break;
     }
 
+  addTime(CPartitionCosts::WALL_COST);
+
   /*--- Complete residuals for periodic boundary conditions. We loop over
    the periodic BCs in matching pairs so that, in the event that there are
    adjacent periodic markers, the repeated points will have their residuals
@@ -103,6 +103,9 @@ void CNewtonIntegration::Setup() {
   /*--- Only possible with a preconditioner. ---*/
   startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
 
+  maxJacobianAge = config->GetNewtonKrylovMaxJacobianAge();
+  reuseTolerance = config->GetNewtonKrylovReuseTolerance();
+
 }
 
 void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar mag) {
@@ -118,22 +121,29 @@ void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar m
 
 void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
 
-  /*--- Save the default integration scheme, and force to explicit if required. ---*/
+  /*--- Save the default integration scheme, and force to explicit if required (i.e. if the Jacobian is not
+   * assembled, but the time step is still computed with the default scheme). ---*/
   auto TimeIntScheme = config->GetKind_TimeIntScheme();
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
   }
 
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
 
-  if (type == ResEvalType::DEFAULT) {
+  if (type != ResEvalType::EXPLICIT) {
+    if (type == ResEvalType::NO_JACOBIAN) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
+    }
     solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+    if (type == ResEvalType::NO_JACOBIAN) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+    }
   }
 
   Space_Integration(geometry, solvers, numerics[FLOW_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
 
   /*--- Restore default. ---*/
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
   }
 
@@ -181,15 +191,27 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->Set_OldSolution();
 
-  /*--- Current residual. ---*/
+  /*--- Current residual, the Jacobian is only assembled if it is going to be updated. ---*/
+
+  const bool reuseJacobian = !updateJacobian;
+
+  ComputeResiduals(reuseJacobian ? ResEvalType::NO_JACOBIAN : ResEvalType::DEFAULT);
 
-  ComputeResiduals(ResEvalType::DEFAULT);
+  /*--- Compute the approximate Jacobian for preconditioning, when it is reused only the right-hand side is
+   * prepared (forcing the explicit scheme prevents the pseudotime term from being added again). ---*/
 
-  /*--- Compute the approximate Jacobian for preconditioning. ---*/
+  const auto TimeIntScheme = config->GetKind_TimeIntScheme();
+  if (reuseJacobian) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+  }
 
   solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
 
-  if (preconditioner) preconditioner->Build();
+  if (reuseJacobian) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
+  }
+
+  if (preconditioner && !reuseJacobian) preconditioner->Build();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
@@ -247,6 +269,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
     solvers[FLOW_SOL]->SetIterLinSolver(iter);
     solvers[FLOW_SOL]->SetResLinSolver(eps);
+    UpdateJacobianReusePolicy(iter, residual);
+    solvers[FLOW_SOL]->SetJacobianReuse(jacobianAge, jacobianUpdates);
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
@@ -287,6 +311,32 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   END_SU2_OMP_PARALLEL
 }
 
+void CNewtonIntegration::UpdateJacobianReusePolicy(unsigned long linearIters, su2double residual) {
+
+  /*--- Age of the Jacobian used in this iteration, the references are set after each update. ---*/
+
+  if (updateJacobian) {
+    jacobianAge = 0;
+    jacobianUpdates += 1;
+    refLinearIters = max(linearIters, 1ul);
+  } else {
+    jacobianAge += 1;
+  }
+
+  /*--- Residual drop caused by the previous iteration, the reference is the drop after an update. ---*/
+
+  const su2double residualDrop = lastResidual - residual;
+  lastResidual = residual;
+  if (jacobianAge == 1) refResidualDrop = residualDrop;
+
+  const bool moreIters = linearIters > reuseTolerance * refLinearIters;
+  const bool lessDrop = (jacobianAge > 1) && (residualDrop * reuseTolerance < refResidualDrop);
+
+  /*--- The Jacobian is not reused during the startup period, where it is solved instead of preconditioning. ---*/
+
+  updateJacobian = startupPeriod || (jacobianAge >= maxJacobianAge) || moreIters || lessDrop;
+}
+
 void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
 
   Scalar factor = finDiffStep / u.norm();
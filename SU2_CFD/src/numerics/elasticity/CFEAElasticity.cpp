@@ -323,6 +323,21 @@ void CFEAElasticity::SetElement_Properties(const CElement *element, const CConfi
 }
 
 
+void CFEAElasticity::Set_Batch_Element(CFEAElementBatch& batch, unsigned short iLane,
+                                       CElement *element, const CConfig *config) {
+
+  SetElement_Properties(element, config);
+
+  /*--- Only the reference gradients are needed, the kernels derive the ones
+   *    in the current configuration from the deformation gradient. ---*/
+  element->ComputeGrad_Linear();
+
+  batch.nDim = nDim;
+  batch.SetLane(iLane, element, E, Nu);
+
+}
+
+
 void CFEAElasticity::ReadDV(const CConfig *config) {
 
   int rank = SU2_MPI::GetRank();
@@ -194,6 +194,43 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
 }
 
 
+void CFEALinearElasticity::Compute_Tangent_Matrix_Batch(CFEAElementBatch& batch, const CConfig *config) {
+
+  using Double = CFEAElementBatch::Double;
+
+  const auto nNode = batch.nNodes;
+  const auto nGauss = batch.nGauss;
+
+  /*--- Lame parameters of each lane, with plane stress D_Mat has the same structure
+   *    as in plane strain but with a reduced first parameter. ---*/
+  const Double one = 1.0;
+  const Double Mu_v = batch.E / (2.0 * (one + batch.Nu));
+  Double Lambda_v = batch.Nu * batch.E / ((one + batch.Nu) * (one - 2.0 * batch.Nu));
+  if (nDim == 2 && plane_stress) Lambda_v = batch.Nu * batch.E / (one - batch.Nu * batch.Nu);
+
+  batch.ClearOutputs();
+
+  for (unsigned short iGauss = 0; iGauss < nGauss; iGauss++) {
+    const Double& Weight = batch.Weight[iGauss];
+    batch.AddIsotropicKab(batch.GradNi_X[iGauss], Weight * Lambda_v, Weight * Mu_v);
+  }
+  batch.SymmetrizeKab();
+
+  /*--- Compute residual ---*/
+  for (unsigned short iNode = 0; iNode < nNode; iNode++) {
+    for (unsigned short jNode = 0; jNode < nNode; jNode++) {
+      const auto Kab = batch.Kab[iNode][jNode];
+      for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+        const Double disp = batch.CurrCoord[jNode][jVar] - batch.RefCoord[jNode][jVar];
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          batch.Kt_a[iNode][iVar] += Kab[iVar*nVar+jVar] * disp;
+      }
+    }
+  }
+
+}
+
+
 void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_container, const CConfig *config) {
 
   /*--- Compute the D Matrix (for plane stress and 2-D)---*/
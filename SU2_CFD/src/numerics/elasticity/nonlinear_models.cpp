@@ -118,6 +118,115 @@ void CFEM_NeoHookean_Comp::Compute_Stress_Tensor(CElement *element, const CConfi
 
 }
 
+void CFEM_NeoHookean_Comp::Compute_Tangent_Matrix_Batch(CFEAElementBatch& batch, const CConfig *config) {
+
+  using Double = CFEAElementBatch::Double;
+  constexpr auto MAXNNODE = CFEAElementBatch::MAXNNODE;
+
+  unsigned short iVar, jVar, kVar, iNode, jNode;
+
+  const auto nNode = batch.nNodes;
+  const auto nGauss = batch.nGauss;
+
+  const Double one = 1.0;
+  const Double Mu_v = batch.E / (2.0 * (one + batch.Nu));
+  const Double Lambda_v = batch.Nu * batch.E / ((one + batch.Nu) * (one - 2.0 * batch.Nu));
+
+  batch.ClearOutputs();
+
+  for (unsigned short iGauss = 0; iGauss < nGauss; iGauss++) {
+
+    const auto GradNi_Ref = batch.GradNi_X[iGauss];
+
+    /*--- Deformation gradient, plane strain is assumed in 2D. ---*/
+
+    Double F[3][3];
+    for (iVar = 0; iVar < 3; iVar++)
+      for (jVar = 0; jVar < 3; jVar++)
+        F[iVar][jVar] = su2double(iVar == jVar && iVar >= nDim);
+
+    for (iNode = 0; iNode < nNode; iNode++)
+      for (iVar = 0; iVar < nDim; iVar++)
+        for (jVar = 0; jVar < nDim; jVar++)
+          F[iVar][jVar] += batch.CurrCoord[iNode][iVar] * GradNi_Ref[iNode][jVar];
+
+    /*--- Cofactors (adjugate transposed) and determinant of F. ---*/
+
+    Double cof[3][3];
+    for (iVar = 0; iVar < 3; iVar++) {
+      const auto i1 = (iVar+1)%3, i2 = (iVar+2)%3;
+      for (jVar = 0; jVar < 3; jVar++) {
+        const auto j1 = (jVar+1)%3, j2 = (jVar+2)%3;
+        cof[iVar][jVar] = F[i1][j1]*F[i2][j2] - F[i1][j2]*F[i2][j1];
+      }
+    }
+    const Double Det_F = F[0][0]*cof[0][0] + F[0][1]*cof[0][1] + F[0][2]*cof[0][2];
+
+    /*--- Same guard against singular elements as the scalar model. ---*/
+    Double inv_J, log_J;
+    for (size_t k = 0; k < CFEAElementBatch::SIZE; ++k) {
+      const bool valid = (Det_F[k] != 0.0);
+      inv_J[k] = valid ? 1.0 / Det_F[k] : 0.0;
+      log_J[k] = valid ? log(Det_F[k]) : 0.0;
+    }
+
+    /*--- Cauchy stress, sigma = mu/J (b - I) + lambda/J ln(J) I, with b = F.F^T. ---*/
+
+    const Double Mu_J = Mu_v * inv_J;
+    const Double Lambda_J = Lambda_v * inv_J;
+    const Double Diag = Lambda_J * log_J - Mu_J;
+
+    Double Stress[3][3];
+    for (iVar = 0; iVar < 3; iVar++) {
+      for (jVar = iVar; jVar < 3; jVar++) {
+        Double b_ij = 0.0;
+        for (kVar = 0; kVar < 3; kVar++) b_ij += F[iVar][kVar] * F[jVar][kVar];
+        Stress[iVar][jVar] = Mu_J * b_ij;
+        Stress[jVar][iVar] = Stress[iVar][jVar];
+      }
+      Stress[iVar][iVar] += Diag;
+    }
+
+    /*--- Gradients in the current configuration, F^-T times those in the reference,
+     *    and integration weight times the current Jacobian (J_x = Det_F * J_X). ---*/
+
+    Double GradNi_Curr[MAXNNODE][CFEAElementBatch::MAXNDIM];
+    for (iNode = 0; iNode < nNode; iNode++) {
+      for (iVar = 0; iVar < nDim; iVar++) {
+        Double grad = 0.0;
+        for (jVar = 0; jVar < nDim; jVar++) grad += cof[iVar][jVar] * GradNi_Ref[iNode][jVar];
+        GradNi_Curr[iNode][iVar] = grad * inv_J;
+      }
+    }
+    const Double Weight = batch.Weight[iGauss] * Det_F;
+
+    /*--- Constitutive term, same isotropic structure as linear elasticity with
+     *    Mu_p = (mu - lambda ln(J))/J and Lambda_p = lambda/J. ---*/
+
+    batch.AddIsotropicKab(GradNi_Curr, Weight * Lambda_J, Weight * (Mu_J - Lambda_J * log_J));
+
+    /*--- Nodal stress term and stress component of the tangent matrix. ---*/
+
+    for (iNode = 0; iNode < nNode; iNode++) {
+      Double StressGrad[CFEAElementBatch::MAXNDIM];
+      for (iVar = 0; iVar < nDim; iVar++) {
+        StressGrad[iVar] = 0.0;
+        for (jVar = 0; jVar < nDim; jVar++) StressGrad[iVar] += Stress[iVar][jVar] * GradNi_Curr[iNode][jVar];
+        StressGrad[iVar] *= Weight;
+        batch.Kt_a[iNode][iVar] += StressGrad[iVar];
+      }
+      for (jNode = iNode; jNode < nNode; jNode++) {
+        Double Ks = 0.0;
+        for (iVar = 0; iVar < nDim; iVar++) Ks += StressGrad[iVar] * GradNi_Curr[jNode][iVar];
+        batch.Ks_ab[iNode][jNode] += Ks;
+      }
+    }
+  }
+
+  batch.SymmetrizeKab();
+
+}
+
 CFEM_Knowles_NearInc::CFEM_Knowles_NearInc(unsigned short val_nDim, unsigned short val_nVar,
                         const CConfig *config) : CFEANonlinearElasticity(val_nDim, val_nVar, config) {
 
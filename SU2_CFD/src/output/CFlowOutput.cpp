@@ -1149,8 +1149,20 @@ void CFlowOutput::AddHistoryOutputFieldsScalarLinsol(const CConfig* config) {
     case SPECIES_MODEL::NONE: break;
   }
 }
+
+void CFlowOutput::AddHistoryOutputFieldsNewtonKrylov(const CConfig* config) {
+  if (!config->GetNewtonKrylov() || config->GetNewtonKrylovMaxJacobianAge() == 0) return;
+  AddHistoryOutput("JACOBIAN_AGE", "JacAge", ScreenOutputFormat::INTEGER, "LINSOL", "Number of Newton-Krylov iterations since the Jacobian and preconditioner were updated.");
+  AddHistoryOutput("JACOBIAN_UPDATES", "JacUpdates", ScreenOutputFormat::INTEGER, "LINSOL", "Number of updates of the Jacobian and preconditioner by the Newton-Krylov method.");
+}
 // clang-format on
 
+void CFlowOutput::LoadHistoryDataNewtonKrylov(const CConfig* config, const CSolver* flow_solver) {
+  if (!config->GetNewtonKrylov() || config->GetNewtonKrylovMaxJacobianAge() == 0) return;
+  SetHistoryOutputValue("JACOBIAN_AGE", flow_solver->GetJacobianAge());
+  SetHistoryOutputValue("JACOBIAN_UPDATES", flow_solver->GetJacobianUpdates());
+}
+
 void CFlowOutput::LoadHistoryDataScalar(const CConfig* config, const CSolver* const* solver) {
 
   switch (TurbModelFamily(config->GetKind_Turb_Model())) {
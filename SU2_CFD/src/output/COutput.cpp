@@ -360,6 +360,44 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
 }
 
+su2passivematrix COutput::GetUnsortedVolumeData(const CGeometry *geometry) const {
+
+  su2passivematrix volumeData;
+  if (volumeDataSorter == nullptr) return volumeData;
+
+  const auto nField = volumeDataSorter->GetFieldNames().size();
+  volumeData.resize(geometry->GetnPointDomain(), nField);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++)
+    for (auto iField = 0ul; iField < nField; iField++)
+      volumeData(iPoint, iField) = volumeDataSorter->GetUnsortedData(iPoint, iField);
+
+  return volumeData;
+}
+
+void COutput::ResetPartitionData(CConfig *config, CGeometry *geometry, const su2passivematrix& volumeData) {
+
+  delete volumeDataSorter;
+  delete surfaceDataSorter;
+  volumeDataSorter = nullptr;
+  surfaceDataSorter = nullptr;
+
+  /*--- The custom outputs convert their markers and probes to local indices when they are first evaluated. ---*/
+
+  for (auto& output : customOutputs) output.varIndices.clear();
+
+  if (volumeData.cols() == 0) return;
+
+  /*--- Restore the values that accumulate over time (time averages) on the new partitions. ---*/
+
+  AllocateDataSorters(config, geometry);
+
+  for (auto iPoint = 0ul; iPoint < volumeData.rows(); iPoint++)
+    for (auto iField = 0ul; iField < volumeData.cols(); iField++)
+      volumeDataSorter->SetUnsortedData(iPoint, iField, volumeData(iPoint, iField));
+
+}
+
 void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_container){
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
@@ -446,7 +484,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
 
       LogOutputFiles("SU2 binary restart");
-      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter, config->GetRestart_Aggregators(), config->GetRestart_Async());
 
       break;
 
@@ -469,6 +507,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2MeshFileWriter::binaryFileExt;
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2MeshFileWriter(volumeDataSorter, config->GetiZone(), config->GetnZone(), true);
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
@@ -25,10 +25,57 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <climits>
+#include <cstdio>
+#include <thread>
 #include <utility>
 
 #include "../../../include/output/filewriter/CFileWriter.hpp"
 
+namespace {
+/*--- Background thread of the asynchronous writes, it only uses file streams (no MPI calls).
+ The asynchronous writes go to a temporary file that is renamed once all ranks are done. ---*/
+struct CBackgroundWrite {
+  std::thread worker;
+  bool failed = false;
+  string tmpName, finalName;
+  void Wait() { if (worker.joinable()) worker.join(); }
+  ~CBackgroundWrite() { Wait(); }
+} backgroundWrite;
+}
+
+void CFileWriter::WaitPendingWrites() {
+
+  backgroundWrite.Wait();
+
+  if (backgroundWrite.tmpName.empty()) return;
+
+  /*--- The temporary file is complete when the threads of all ranks are done, only
+   then does it replace the previous file (which is kept if something failed). ---*/
+
+  int failed = backgroundWrite.failed, anyFailed = 0;
+  SU2_MPI::Allreduce(&failed, &anyFailed, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    const char* tmpName = backgroundWrite.tmpName.c_str();
+    const char* finalName = backgroundWrite.finalName.c_str();
+
+    if (anyFailed) {
+      cout << "WARNING: The background write of " << finalName << " failed, the previous file was kept." << endl;
+    }
+    else if (rename(tmpName, finalName) != 0) {
+      /*--- Some systems do not replace existing files when renaming. ---*/
+      remove(finalName);
+      if (rename(tmpName, finalName) != 0)
+        cout << "WARNING: Unable to rename " << tmpName << " to " << finalName << "." << endl;
+    }
+  }
+
+  backgroundWrite.tmpName.clear();
+  backgroundWrite.finalName.clear();
+  backgroundWrite.failed = false;
+}
+
 CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(std::move(valFileExt)),
   dataSorter(valDataSorter){
@@ -61,25 +108,31 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
   startTime = SU2_MPI::Wtime();
 
-  MPI_Datatype filetype;
+  /*--- The counts of MPI are int, hence large blocks are written in chunks. All ranks
+   must take part in each collective write, the number of writes is the maximum over
+   the ranks (ranks with less data write empty chunks). ---*/
 
-  /*--- Prepare to write the actual data ---*/
+  unsigned long nChunk = (sizeInBytes + MAX_CHUNK_BYTES - 1) / MAX_CHUNK_BYTES, maxChunk = 0;
+  SU2_MPI::Allreduce(&nChunk, &maxChunk, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
 
-  MPI_Type_contiguous(int(sizeInBytes), MPI_BYTE, &filetype);
-  MPI_Type_commit(&filetype);
+  /*--- Reset the file view, each rank writes at the explicit offset of its piece of the file. ---*/
 
-  /*--- Set the view for the MPI file write, i.e., describe the
- location in the file that this rank "sees" for writing its
- piece of the file. ---*/
-
-  MPI_File_set_view(fhw, disp + offsetInBytes, MPI_BYTE, filetype,
+  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
                     (char*)"native", MPI_INFO_NULL);
 
-  /*--- Collective call for all ranks to write simultaneously. ---*/
+  int ierr = MPI_SUCCESS;
 
-  int ierr = MPI_File_write_all(fhw, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+  for (unsigned long iChunk = 0; iChunk < maxChunk; iChunk++) {
+    const unsigned long begin = min<unsigned long>(iChunk * MAX_CHUNK_BYTES, sizeInBytes);
+    const unsigned long chunkSize = min<unsigned long>(MAX_CHUNK_BYTES, sizeInBytes - begin);
 
-  MPI_Type_free(&filetype);
+    /*--- Collective call for all ranks to write simultaneously. ---*/
+
+    const int err = MPI_File_write_at_all(fhw, disp + MPI_Offset(offsetInBytes + begin),
+                                          static_cast<const char*>(data) + begin, int(chunkSize),
+                                          MPI_BYTE, MPI_STATUS_IGNORE);
+    if (err != MPI_SUCCESS) ierr = err;
+  }
 
   disp      += totalSizeInBytes;
   fileSize  += sizeInBytes;
@@ -109,6 +162,104 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 }
 
+bool CFileWriter::WriteAggregatedBinaryDataAll(const void *data, unsigned long sizeInBytes,
+                                               unsigned long totalSizeInBytes, unsigned long offsetInBytes,
+                                               unsigned long nAggregators, bool async){
+
+#ifdef HAVE_MPI
+
+  if ((nAggregators == 0) && !async)
+    return WriteMPIBinaryDataAll(data, sizeInBytes, totalSizeInBytes, offsetInBytes);
+
+  startTime = SU2_MPI::Wtime();
+
+  /*--- Split the ranks into groups of consecutive ranks. The data of a group
+   is contiguous in the file, and the first rank of the group (aggregator)
+   gathers and writes it. Without aggregation each rank is its own group. ---*/
+
+  const unsigned long nGroups = (nAggregators == 0) ? size : min<unsigned long>(nAggregators, size);
+  const int groupSize = (size + nGroups - 1) / nGroups;
+
+  MPI_Comm groupComm;
+  MPI_Comm_split(SU2_MPI::GetComm(), rank / groupSize, rank, &groupComm);
+
+  int groupRank, nGroupRanks;
+  MPI_Comm_rank(groupComm, &groupRank);
+  MPI_Comm_size(groupComm, &nGroupRanks);
+
+  /*--- Gather the sizes, and then the data, on the aggregator. Without aggregation
+   there is nothing to gather (and no limit on the size). ---*/
+
+  unsigned long chunkSize = sizeInBytes;
+  vector<char> chunk;
+
+  if (nGroupRanks == 1) {
+    const auto* bytes = static_cast<const char*>(data);
+    chunk.assign(bytes, bytes + sizeInBytes);
+  }
+  else {
+    /*--- The counts of MPI are int. ---*/
+    if (sizeInBytes > INT_MAX) {
+      SU2_MPI::Error(string("The data of a rank is too large for aggregation, use RESTART_AGGREGATORS= 0") +
+                     (async ? " (each rank then writes its data in the background)." : "."), CURRENT_FUNCTION);
+    }
+    const int count = sizeInBytes;
+
+    vector<int> counts(nGroupRanks), displs(nGroupRanks + 1, 0);
+    MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, groupComm);
+
+    chunkSize = 0;
+    if (groupRank == 0) {
+      for (int iRank = 0; iRank < nGroupRanks; iRank++) chunkSize += counts[iRank];
+      if (chunkSize > INT_MAX) {
+        SU2_MPI::Error("The data of a group of ranks is too large, increase RESTART_AGGREGATORS.", CURRENT_FUNCTION);
+      }
+      for (int iRank = 0; iRank < nGroupRanks; iRank++) displs[iRank + 1] = displs[iRank] + counts[iRank];
+    }
+
+    chunk.resize(chunkSize);
+    MPI_Gatherv(data, count, MPI_BYTE, chunk.data(), counts.data(), displs.data(), MPI_BYTE, 0, groupComm);
+  }
+
+  MPI_Comm_free(&groupComm);
+
+  /*--- Reset the file view, the aggregators write independently at their offset,
+   which is the offset of their own data since they are the first rank of the group. ---*/
+
+  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
+                    (char*)"native", MPI_INFO_NULL);
+
+  int ierr = MPI_SUCCESS;
+
+  if (groupRank == 0) {
+    if (async) {
+      pendingChunk = std::move(chunk);
+      pendingOffset = disp + offsetInBytes;
+    } else {
+      for (unsigned long begin = 0; begin < chunkSize; begin += MAX_CHUNK_BYTES) {
+        const int err = MPI_File_write_at(fhw, disp + MPI_Offset(offsetInBytes + begin), chunk.data() + begin,
+                                          int(min<unsigned long>(MAX_CHUNK_BYTES, chunkSize - begin)),
+                                          MPI_BYTE, MPI_STATUS_IGNORE);
+        if (err != MPI_SUCCESS) ierr = err;
+      }
+    }
+  }
+
+  disp      += totalSizeInBytes;
+  fileSize  += sizeInBytes;
+
+  stopTime = SU2_MPI::Wtime();
+
+  usedTime += stopTime - startTime;
+
+  return (ierr == MPI_SUCCESS);
+#else
+
+  return WriteMPIBinaryDataAll(data, sizeInBytes, totalSizeInBytes, offsetInBytes);
+#endif
+
+}
+
 bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor){
 
 #ifdef HAVE_MPI
@@ -122,8 +273,14 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
   MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
                     (char*)"native", MPI_INFO_NULL);
 
-  if (rank == processor)
-    ierr = MPI_File_write_at(fhw, disp, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+  if (rank == processor) {
+    for (unsigned long begin = 0; begin < sizeInBytes; begin += MAX_CHUNK_BYTES) {
+      const unsigned long chunkSize = min<unsigned long>(MAX_CHUNK_BYTES, sizeInBytes - begin);
+      const int err = MPI_File_write_at(fhw, disp + MPI_Offset(begin), static_cast<const char*>(data) + begin,
+                                        int(chunkSize), MPI_BYTE, MPI_STATUS_IGNORE);
+      if (err != MPI_SUCCESS) ierr = err;
+    }
+  }
 
   disp     += sizeInBytes;
   fileSize += sizeInBytes;
@@ -198,10 +355,13 @@ bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
 }
 
-bool CFileWriter::OpenMPIFile(string val_filename){
+bool CFileWriter::OpenMPIFile(string val_filename, bool temporary){
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
   val_filename.append(fileExt);
+  finalFileName = val_filename;
+  if (temporary) val_filename.append(".tmp");
+  openFileName = val_filename;
 
 #ifdef HAVE_MPI
   int ierr;
@@ -256,6 +416,32 @@ bool CFileWriter::CloseMPIFile(){
   fclose(fhw);
 #endif
 
+  /*--- Hand the chunk of an asynchronous write to the background thread, the
+   file exists now, the thread only updates its part of the contents. ---*/
+
+  if (!pendingChunk.empty()) {
+    backgroundWrite.Wait();
+    backgroundWrite.worker = std::thread(
+        [](const string& name, unsigned long offset, const vector<char>& chunk) {
+          fstream file(name, ios::in | ios::out | ios::binary);
+          file.seekp(offset);
+          file.write(chunk.data(), chunk.size());
+          if (!file) {
+            cerr << "Error: unable to write to " << name << " in the background." << endl;
+            backgroundWrite.failed = true;
+          }
+        },
+        openFileName, pendingOffset, std::move(pendingChunk));
+    pendingChunk.clear();
+  }
+
+  /*--- A temporary file replaces the final one when the pending writes are done. ---*/
+
+  if (openFileName != finalFileName) {
+    backgroundWrite.tmpName = openFileName;
+    backgroundWrite.finalName = finalFileName;
+  }
+
   /*--- Communicate the total file size for the restart ---*/
 
   su2double my_fileSize = fileSize;
@@ -29,8 +29,9 @@
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter)  :
-  CFileWriter(valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter, unsigned long valAggregators,
+                                           bool valAsync)  :
+  CFileWriter(valDataSorter, fileExt), nAggregators(valAggregators), async(valAsync){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter()= default;
@@ -56,9 +57,15 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
-  /*--- Open the file using MPI I/O ---*/
+  /*--- The previous asynchronous write may still be in progress, it must
+   finish before its file is written again or its buffer is replaced. ---*/
 
-  OpenMPIFile(val_filename);
+  if (async) WaitPendingWrites();
+
+  /*--- Open the file using MPI I/O, asynchronous writes go to a temporary
+   file such that the previous file remains valid until the new one is complete. ---*/
+
+  OpenMPIFile(val_filename, async);
 
   /*--- First, write the number of variables and points (i.e., cols and rows),
    which we will need in order to read the file later. Also, write the
@@ -84,7 +91,8 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
 
   /*--- Collectively write the actual data to file ---*/
 
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  WriteAggregatedBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes,
+                               nAggregators, async);
 
   /*--- Close the file ---*/
 
@@ -27,15 +27,25 @@
 
 #include "../../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+using SU2BinaryMesh::BOUND_RECORD_SIZE;
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::binaryFileExt = SU2BinaryMesh::FILE_EXT;
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(valDataSorter, valBinary ? binaryFileExt : fileExt), iZone(valiZone), nZone(valnZone),
+   binary(valBinary) {}
 
 void CSU2MeshFileWriter::WriteData(string val_filename) {
 
+  if (binary) {
+    WriteBinaryData(val_filename);
+    return;
+  }
+
   ofstream output_file;
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
@@ -160,96 +170,235 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
 
     output_file.open(val_filename, ios::app);
 
-    /*--- Read the boundary information ---*/
+    /*--- Write the physical boundaries ---*/
+
+    const auto markers = ReadBoundaryFile();
 
-    string str = "boundary";
-    if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
-    str += ".dat";
+    output_file << "NMARK= " << markers.size() << endl;
 
-    ifstream input_file;
-    input_file.open(str);
+    for (const auto& marker : markers) {
 
-    if (!input_file.is_open()) {
-      SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+      output_file << "MARKER_TAG= " << marker.tag << endl;
+      output_file << "MARKER_ELEMS= " << marker.conn.size() / BOUND_RECORD_SIZE << endl;
+
+      if (marker.tag == "SEND_RECEIVE") {
+        output_file << "SEND_TO= " << marker.sendTo << endl;
+      }
+
+      for (auto iElem_Bound = 0ul; iElem_Bound < marker.conn.size() / BOUND_RECORD_SIZE; iElem_Bound++) {
+
+        const auto* record = &marker.conn[iElem_Bound * BOUND_RECORD_SIZE];
+        output_file << record[0];
+
+        switch (record[0]) {
+        case LINE:
+        case VERTEX:
+          output_file << "\t" << record[1] << "\t" << record[2] << "\n";
+          break;
+        case TRIANGLE:
+          output_file << "\t" << record[1] << "\t" << record[2] << "\t" << record[3] << "\n";
+          break;
+        case QUADRILATERAL:
+          output_file << "\t" << record[1] << "\t" << record[2] << "\t" << record[3] << "\t" << record[4] << "\n";
+          break;
+        }
+      }
     }
 
-    /*--- Read grid file with format SU2 ---*/
+    output_file.close();
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+}
 
-    string text_line;
-    while (getline(input_file, text_line)) {
+vector<CSU2MeshFileWriter::BoundaryMarker> CSU2MeshFileWriter::ReadBoundaryFile() const {
 
-      /*--- Write the physical boundaries ---*/
+  vector<BoundaryMarker> markers;
 
-      auto position = text_line.find("NMARK=",0);
+  /*--- Read the boundary information ---*/
 
-      if (position == string::npos) continue;
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
 
-      text_line.erase(0,6);
-      const auto nMarker_ = atoi(text_line.c_str());
-      output_file << "NMARK= " << nMarker_ << endl;
+  ifstream input_file;
+  input_file.open(str);
+
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
 
-      for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
+  /*--- Read grid file with format SU2 ---*/
+
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    auto position = text_line.find("NMARK=",0);
+
+    if (position == string::npos) continue;
+
+    text_line.erase(0,6);
+    markers.resize(atoi(text_line.c_str()));
+
+    for (auto& marker : markers) {
+
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      for (int iChar = 0; iChar < 20; iChar++) {
+        position = text_line.find(' ', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\r', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\n', 0);
+        if (position != string::npos) text_line.erase(position,1);
+      }
+      marker.tag = text_line;
+
+      /*--- Standart physical boundary ---*/
+
+      getline (input_file, text_line);
+
+      text_line.erase(0,13);
+      const auto nElem_Bound_ = atoi(text_line.c_str());
+      getline (input_file, text_line);
+
+      text_line.erase(0,8);
+      marker.sendTo = atoi(text_line.c_str());
+
+      /*--- Elements as [VTK n0 n1 n2 n3], unused nodes are 0. ---*/
+
+      marker.conn.assign(nElem_Bound_ * BOUND_RECORD_SIZE, 0);
+
+      for (auto iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
 
         getline(input_file, text_line);
-        text_line.erase(0,11);
-        for (int iChar = 0; iChar < 20; iChar++) {
-          position = text_line.find(' ', 0);
-          if (position != string::npos) text_line.erase(position,1);
-          position = text_line.find('\r', 0);
-          if (position != string::npos) text_line.erase(position,1);
-          position = text_line.find('\n', 0);
-          if (position != string::npos) text_line.erase(position,1);
+        istringstream bound_line(text_line);
+
+        auto* record = &marker.conn[iElem_Bound * BOUND_RECORD_SIZE];
+        bound_line >> record[0];
+
+        switch (record[0]) {
+        case LINE:
+        case VERTEX:
+          bound_line >> record[1]; bound_line >> record[2];
+          break;
+        case TRIANGLE:
+          bound_line >> record[1]; bound_line >> record[2]; bound_line >> record[3];
+          break;
+        case QUADRILATERAL:
+          bound_line >> record[1]; bound_line >> record[2]; bound_line >> record[3]; bound_line >> record[4];
+          break;
         }
-        string Marker_Tag = text_line;
+      }
+    }
+  }
 
-        /*--- Standart physical boundary ---*/
+  return markers;
+}
 
-        getline (input_file, text_line);
+void CSU2MeshFileWriter::WriteBinaryData(string val_filename) {
 
-        text_line.erase(0,13);
-        const auto nElem_Bound_ = atoi(text_line.c_str());
-        output_file << "MARKER_TAG= " << Marker_Tag << endl;
-        output_file << "MARKER_ELEMS= " << nElem_Bound_<< endl;
-        getline (input_file, text_line);
+  using namespace SU2BinaryMesh;
 
-        text_line.erase(0,8);
-        const auto SendTo = atoi(text_line.c_str());
+  /*--- See SU2BinaryMesh for the layout of the file. ---*/
 
-        if (Marker_Tag == "SEND_RECEIVE") {
-          output_file << "SEND_TO= " << SendTo << endl;
-        }
+  if (nZone > 1) {
+    SU2_MPI::Error("The SU2 binary mesh format stores a single zone per file.", CURRENT_FUNCTION);
+  }
 
-        for (auto iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
-
-          getline(input_file, text_line);
-          istringstream bound_line(text_line);
-
-          unsigned short VTK_Type;
-          bound_line >> VTK_Type;
-          output_file << VTK_Type;
-          unsigned long vnodes[4] = {0};
-
-          switch (VTK_Type) {
-          case LINE:
-          case VERTEX:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\n";
-            break;
-          case TRIANGLE:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\t" << vnodes[2] << "\n";
-            break;
-          case QUADRILATERAL:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2]; bound_line >> vnodes[3];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\t" << vnodes[2] << "\t" << vnodes[3] << "\n";
-            break;
-          }
-        }
+  const auto nDim = dataSorter->GetnDim();
+  const auto nPointLocal = dataSorter->GetnPoints();
+  const auto nPointGlobal = dataSorter->GetnPointsGlobal();
+  const auto nElemGlobal = dataSorter->GetnElemGlobal();
+
+  /*--- The master packs the whole marker block, its size is needed by
+   all ranks to advance the file position consistently. ---*/
+
+  vector<int64_t> markerBlock;
+  int64_t nMarker = 0;
+
+  if (rank == MASTER_NODE) {
+    const auto markers = ReadBoundaryFile();
+    nMarker = markers.size();
+
+    static_assert(MARKER_NAME_SIZE % sizeof(int64_t) == 0, "");
+    constexpr auto nameSize = MARKER_NAME_SIZE / sizeof(int64_t);
+
+    for (const auto& marker : markers) {
+      if (marker.tag.size() >= size_t(MARKER_NAME_SIZE)) {
+        SU2_MPI::Error("Marker name " + marker.tag + " is too long for the SU2 binary mesh format.",
+                       CURRENT_FUNCTION);
       }
+      const auto pos = markerBlock.size();
+      markerBlock.resize(pos + nameSize + 1, 0);
+      memcpy(&markerBlock[pos], marker.tag.c_str(), marker.tag.size());
+      markerBlock[pos + nameSize] = marker.conn.size() / BOUND_RECORD_SIZE;
+      markerBlock.insert(markerBlock.end(), marker.conn.begin(), marker.conn.end());
     }
+  }
+  unsigned long markerBytes = markerBlock.size() * sizeof(int64_t);
+  SU2_MPI::Bcast(&markerBytes, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
 
-    output_file.close();
+  /*--- Header. ---*/
+
+  const unsigned long pointBytes = nDim * sizeof(passivedouble);
+  const unsigned long elemBytes = ELEM_RECORD_SIZE * sizeof(int64_t);
+
+  int64_t header[HEADER_SIZE] = {};
+  header[MAGIC] = MAGIC_NUMBER;
+  header[FORMAT_VERSION] = VERSION;
+  header[NDIM] = nDim;
+  header[NPOINT] = nPointGlobal;
+  header[NELEM] = nElemGlobal;
+  header[NMARKER] = nMarker;
+  header[ELEM_OFFSET] = sizeof(header) + nPointGlobal * pointBytes;
+  header[MARKER_OFFSET] = header[ELEM_OFFSET] + nElemGlobal * elemBytes;
+
+  OpenMPIFile(val_filename);
+
+  bool ok = WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Coordinates, the points of each rank are a contiguous slice. ---*/
+
+  vector<passivedouble> coords(nPointLocal * nDim);
+  for (auto iPoint = 0ul; iPoint < nPointLocal; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coords[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  ok &= WriteMPIBinaryDataAll(coords.data(), nPointLocal * pointBytes, nPointGlobal * pointBytes,
+                              dataSorter->GetnPointCumulative(rank) * pointBytes);
+  vector<passivedouble>().swap(coords);
+
+  /*--- Volume elements, numbered rank by rank as in the ASCII format. ---*/
+
+  vector<int64_t> elems;
+  elems.reserve(dataSorter->GetnElem() * ELEM_RECORD_SIZE);
+
+  for (auto type : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nNodes = nPointsOfElementType(type);
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      const auto pos = elems.size();
+      elems.resize(pos + ELEM_RECORD_SIZE, 0);
+      elems[pos] = type;
+      for (auto iNode = 0u; iNode < nNodes; ++iNode)
+        elems[pos + 1 + iNode] = dataSorter->GetElemConnectivity(type, iElem, iNode) - 1;
+    }
   }
+  const unsigned long nElemLocal = elems.size() / ELEM_RECORD_SIZE;
 
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  vector<unsigned long> nElemRank(size);
+  SU2_MPI::Allgather(&nElemLocal, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  unsigned long elemOffset = 0;
+  for (int iRank = 0; iRank < rank; ++iRank) elemOffset += nElemRank[iRank];
+
+  ok &= WriteMPIBinaryDataAll(elems.data(), nElemLocal * elemBytes, nElemGlobal * elemBytes, elemOffset * elemBytes);
+  vector<int64_t>().swap(elems);
+
+  /*--- Markers. ---*/
+
+  ok &= WriteMPIBinaryData(markerBlock.data(), markerBytes, MASTER_NODE);
+
+  CloseMPIFile();
+
+  if (!ok) SU2_MPI::Error("Unable to write the SU2 binary mesh " + val_filename + fileExt, CURRENT_FUNCTION);
 }
@@ -155,6 +155,8 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
 
   HybridParallelInitialization(*config, *geometry);
 
+  if (config->GetOverlap_Halo_Comms() && (iMesh == MESH_0)) SetOverlapEdgeColoring(*geometry);
+
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
@@ -1656,6 +1658,11 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    /*--- The halos of the reconstruction data may be exchanged by the residual loop. ---*/
+
+    const bool deferHaloComms = OverlapHaloComms(config);
+    if (deferHaloComms) ompMasterAssignBarrier(DeferHaloComms, true);
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
@@ -1670,6 +1677,8 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     /*--- Limiter computation ---*/
 
     if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+
+    if (deferHaloComms) ompMasterAssignBarrier(DeferHaloComms, false);
   }
 }
 
@@ -1764,7 +1773,15 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool low_mach_corr = config->Low_Mach_Correction();
 
   /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  bool simd_scheme = false;
+  switch (config->GetKind_Upwind_Flow()) {
+    case UPWIND::ROE: case UPWIND::HLLC: case UPWIND::AUSMPLUSUP: case UPWIND::SLAU: case UPWIND::SLAU2:
+      simd_scheme = true;
+      break;
+    default:
+      break;
+  }
+  if (simd_scheme && ideal_gas && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
@@ -1797,14 +1814,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-  for(auto k = 0ul; k < color.size; ++k) {
-
-    auto iEdge = color.indices[k];
+  /*--- Flux computation for one edge. ---*/
+  auto edgeTask = [&](unsigned long iEdge) {
 
     unsigned short iDim, iVar;
 
@@ -1969,9 +1980,17 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     Viscous_Residual(iEdge, geometry, solver_container,
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+  };
+
+  /*--- Loop over edge colors, if the reconstruction data at halo points is in flight
+   *    start with the edges between owned points and finish the comms before the others. ---*/
+  if (InitiatePendingHaloComms(geometry, config)) {
+    LoopOverEdgeColors(InteriorEdgeColoring, edgeTask);
+    CompletePendingHaloComms(geometry, config);
+    LoopOverEdgeColors(HaloEdgeColoring, edgeTask);
+  } else {
+    LoopOverEdgeColors(EdgeColoring, edgeTask);
   }
-  END_SU2_OMP_FOR
-  } // end color loop
 
   FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
 }
@@ -28,12 +28,91 @@
 #include "../../include/solvers/CFEASolver.hpp"
 #include "../../include/variables/CFEABoundVariable.hpp"
 #include "../../include/numerics/elasticity/CFEAElasticity.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include <algorithm>
 
 using namespace GeometryToolbox;
 
+namespace {
+
+class CFEAMatrixFreeProduct final : public CMatrixVectorProduct<CFEASolver::MatrixFreeScalar> {
+  CFEASolver* solver;
+  CGeometry* geometry;
+  const CConfig* config;
+public:
+  CFEAMatrixFreeProduct(CFEASolver* s, CGeometry* g, const CConfig* c) : solver(s), geometry(g), config(c) {}
+
+  /*!
+   * \brief Operator for the product operation, with the essential BCs applied.
+   */
+  inline void operator()(const CSysVector<CFEASolver::MatrixFreeScalar>& u,
+                         CSysVector<CFEASolver::MatrixFreeScalar>& v) const override {
+    solver->MatrixFreeProduct(geometry, config, u, v, true);
+  }
+};
+
+class CFEABlockJacobiPreconditioner final : public CPreconditioner<CFEASolver::MatrixFreeScalar> {
+  const CFEASolver* solver;
+  CGeometry* geometry;
+  const CConfig* config;
+public:
+  CFEABlockJacobiPreconditioner(const CFEASolver* s, CGeometry* g, const CConfig* c) :
+    solver(s), geometry(g), config(c) {}
+
+  /*!
+   * \brief Operator for the preconditioning operation.
+   */
+  inline void operator()(const CSysVector<CFEASolver::MatrixFreeScalar>& u,
+                         CSysVector<CFEASolver::MatrixFreeScalar>& v) const override {
+    solver->MatrixFreePreconditioner(geometry, config, u, v);
+  }
+};
+
+/*!
+ * \brief Invert a small dense block by Gauss-Jordan elimination with partial pivoting.
+ * \param[in] n - Size of the block.
+ * \param[in,out] a - Block (row-major), destroyed.
+ * \param[out] inv - Inverse of the block.
+ */
+template<class T>
+void InvertBlock(unsigned long n, T* a, T* inv) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j)
+      inv[i*n+j] = T(i == j);
+
+  for (auto k = 0ul; k < n; ++k) {
+    auto p = k;
+    for (auto i = k+1; i < n; ++i)
+      if (fabs(a[i*n+k]) > fabs(a[p*n+k])) p = i;
+
+    if (p != k) {
+      for (auto j = 0ul; j < n; ++j) {
+        swap(a[k*n+j], a[p*n+j]);
+        swap(inv[k*n+j], inv[p*n+j]);
+      }
+    }
+
+    const T pivot = T(1) / a[k*n+k];
+    for (auto j = 0ul; j < n; ++j) {
+      a[k*n+j] *= pivot;
+      inv[k*n+j] *= pivot;
+    }
+
+    for (auto i = 0ul; i < n; ++i) {
+      if (i == k) continue;
+      const T factor = a[i*n+k];
+      for (auto j = 0ul; j < n; ++j) {
+        a[i*n+j] -= factor * a[k*n+j];
+        inv[i*n+j] -= factor * inv[k*n+j];
+      }
+    }
+  }
+}
+}
+
 
 CFEASolver::CFEASolver(LINEAR_SOLVER_MODE mesh_deform_mode) : CFEASolverBase(mesh_deform_mode) {
 
@@ -145,13 +224,36 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   if (config->GetRefGeom()) Set_ReferenceGeometry(geometry, config);
   if (config->GetPrestretch()) Set_Prestretch(geometry, config);
 
-  /*--- Initialization of matrix structures ---*/
-  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
+  /*--- Initialization of matrix structures, in matrix-free mode only the diagonal blocks are stored. ---*/
+  MatrixFree = config->GetFEA_MatrixFree();
 
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  if (!MatrixFree) {
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
+
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+    if (dynamic) MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
+  else {
+    if (rank == MASTER_NODE)
+      cout << "Matrix-free tangent operator with block-Jacobi preconditioning (Non-Linear Elasticity)." << endl;
+
+    FixedDOF.resize(nPoint*nVar, false);
+    DiagBlocks.resize(nPoint*nVar*nVar, 0.0);
+    InvDiagBlocks.resize(nPoint*nVar*nVar, 0.0);
+    if (dynamic) MassDiag.resize(nPoint, 0.0);
+
+    MatrixFreeSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    MatrixFreeRes.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  }
+
+  /*--- Batched (SIMD) element kernels, dielectric effects are only computed element by element. ---*/
+  ElementBatches = config->GetFEA_Vectorization() && !de_effects;
+
+  if (ElementBatches && (rank == MASTER_NODE))
+    cout << "Element matrices computed in batches of " << CFEAElementBatch::SIZE << " elements." << endl;
 
   if (dynamic) {
-    MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
     TimeRes_Aux.Initialize(nPoint, nPointDomain, nVar, 0.0);
     TimeRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   }
@@ -603,6 +705,12 @@ void CFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container,
   }
   END_SU2_OMP_PARALLEL
 
+  /*--- The matrix-free operator evaluates the element matrices on the fly, the essential BCs are set again. ---*/
+  if (MatrixFree) {
+    MatrixFreeNumerics = numerics;
+    fill(FixedDOF.begin(), FixedDOF.end(), false);
+  }
+
   /*--- Clear external forces. ---*/
   nodes->Clear_SurfaceLoad_Res();
 
@@ -646,13 +754,18 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  if (ElementBatches) {
+    Compute_StiffMatrix_Batched(geometry, numerics, config, false);
+    return;
+  }
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
   {
     /*--- Clear vector and matrix before calculation. ---*/
     LinSysRes.SetValZero();
-    Jacobian.SetValZero();
+    SetTangentMatrixZero();
 
     for(auto color : ElemColoring) {
 
@@ -713,9 +826,18 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
           for (iVar = 0; iVar < nVar; iVar++)
             LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
-          for (jNode = 0; jNode < nNodes; jNode++) {
-            auto Kab = element->Get_Kab(iNode, jNode);
-            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
+          if (MatrixFree) {
+            /*--- Only the diagonal blocks are assembled, for the preconditioner. ---*/
+            auto Kii = &DiagBlocks[indexNode[iNode]*nVar*nVar];
+            auto Kaa = element->Get_Kab(iNode, iNode);
+            for (iVar = 0; iVar < nVar*nVar; iVar++)
+              Kii[iVar] += SU2_TYPE::GetValue(simp_penalty*Kaa[iVar]);
+          }
+          else {
+            for (jNode = 0; jNode < nNodes; jNode++) {
+              auto Kab = element->Get_Kab(iNode, jNode);
+              Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
+            }
           }
 
           if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
@@ -740,13 +862,18 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  if (ElementBatches) {
+    Compute_StiffMatrix_Batched(geometry, numerics, config, prestretch_fem);
+    return;
+  }
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
   {
     /*--- Clear vector and matrix before calculation. ---*/
     LinSysRes.SetValZero();
-    Jacobian.SetValZero();
+    SetTangentMatrixZero();
 
     for(auto color : ElemColoring) {
 
@@ -835,8 +962,12 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
 
           for (jNode = 0; jNode < nNodes; jNode++) {
 
+            /*--- In matrix-free mode only the diagonal blocks are assembled, for the preconditioner. ---*/
+            if (MatrixFree && (jNode != iNode)) continue;
+
             /*--- Get a pointer to the matrix block to perform the update. ---*/
-            auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
+            auto Kij = MatrixFree? &DiagBlocks[indexNode[iNode]*nVar*nVar] :
+                                   Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
 
             /*--- Retrieve the values of the FEA term. ---*/
             auto Kab = fea_elem->Get_Kab(iNode, jNode);
@@ -873,6 +1004,377 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
 
 }
 
+template<class ElementType>
+void CFEASolver::AddElementTerms(const ElementType& element, const unsigned long* indexNode,
+                                 unsigned short nNodes, su2double simp_penalty) {
+
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+
+    if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+
+    auto Ta = element.Get_Kt_a(iNode);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
+
+    for (unsigned short jNode = 0; jNode < nNodes; jNode++) {
+
+      /*--- In matrix-free mode only the diagonal blocks are assembled, for the preconditioner. ---*/
+      if (MatrixFree && (jNode != iNode)) continue;
+
+      auto Kij = MatrixFree? &DiagBlocks[indexNode[iNode]*nVar*nVar] :
+                             Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
+
+      auto Kab = element.Get_Kab(iNode, jNode);
+      su2double Ks_ab = element.Get_Ks_ab(iNode, jNode);
+
+      /*--- Full block. ---*/
+      for (unsigned short iVar = 0; iVar < nVar*nVar; iVar++)
+        Kij[iVar] += SU2_TYPE::GetValue(simp_penalty*Kab[iVar]);
+
+      /*--- Only the block's diagonal. ---*/
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        Kij[iVar*(nVar+1)] += SU2_TYPE::GetValue(simp_penalty*Ks_ab);
+    }
+
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+  }
+
+}
+
+void CFEASolver::Compute_StiffMatrix_Batched(CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                             bool prestretch) {
+
+  const bool topology_mode = config->GetTopology_Optimization();
+  const su2double simp_exponent = config->GetSIMP_Exponent();
+  const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+
+  constexpr unsigned long BATCH_SIZE = CFEAElementBatch::SIZE;
+
+  /*--- Start OpenMP parallel region. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    /*--- Clear vector and matrix before calculation. ---*/
+    LinSysRes.SetValZero();
+    SetTangentMatrixZero();
+
+    const int thread = omp_get_thread_num();
+
+    /*--- Each thread fills its own batch, the elements of a chunk are sorted
+     *    by kind and material model (key) to form batches of the same type. ---*/
+    CFEAElementBatch batch;
+    vector<pair<unsigned long, unsigned long> > chunkElems;
+
+    /*--- Set the coordinates and properties of an element, and cache its point indices.
+     *    Returns the penalty to apply to the stiffness in topology mode. ---*/
+    auto SetElementData = [&](unsigned long iElem, CElement* element, unsigned long* indexNode) {
+
+      for (unsigned short iNode = 0; iNode < element->GetnNodes(); iNode++) {
+
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+          su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+
+          /*--- If pre-stretched the reference coordinate is stored in the nodes. ---*/
+          if (prestretch)
+            val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
+
+          element->SetCurr_Coord(iNode, iDim, val_Sol);
+          element->SetRef_Coord(iNode, iDim, val_Coord);
+        }
+      }
+
+      element->Set_ElProperties(element_properties[iElem]);
+
+      su2double simp_penalty = 1.0;
+      if (topology_mode) {
+        su2double density = element_properties[iElem]->GetPhysicalDensity();
+        simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+      }
+      return simp_penalty;
+    };
+
+    for(auto color : ElemColoring) {
+
+      /*--- Same chunks as the element-by-element loops (at least OMP_MIN_SIZE and a
+       *    multiple of the color group size), but they are iterated explicitly. ---*/
+#ifdef HAVE_OMP
+      const unsigned long chunkSize = nextMultiple(OMP_MIN_SIZE, color.groupSize);
+#else
+      const unsigned long chunkSize = OMP_MIN_SIZE;
+#endif
+      const unsigned long nChunks = roundUpDiv(color.size, chunkSize);
+
+      SU2_OMP_FOR_DYN(1)
+      for(auto iChunk = 0ul; iChunk < nChunks; ++iChunk) {
+
+        chunkElems.clear();
+        const auto kEnd = min<unsigned long>(color.size, (iChunk+1)*chunkSize);
+
+        for(auto k = iChunk*chunkSize; k < kEnd; ++k) {
+          auto iElem = color.indices[k];
+          int EL_KIND;
+          unsigned short nNodes;
+          GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+          chunkElems.emplace_back(EL_KIND*MAX_TERMS + element_properties[iElem]->GetMat_Mod(), iElem);
+        }
+        sort(chunkElems.begin(), chunkElems.end());
+
+        for (auto iBeg = 0ul; iBeg < chunkElems.size(); ) {
+
+          /*--- Range of elements with the same key. ---*/
+          const auto key = chunkElems[iBeg].first;
+          auto iEnd = iBeg;
+          while (iEnd < chunkElems.size() && chunkElems[iEnd].first == key) ++iEnd;
+
+          /*--- Each thread needs a dedicated element and numerics. ---*/
+          CElement* element = element_container[FEA_TERM][key/MAX_TERMS + thread*MAX_FE_KINDS];
+          CNumerics* fea_numerics = numerics[thread*MAX_TERMS + key%MAX_TERMS];
+          const auto nNodes = element->GetnNodes();
+
+          if (!fea_numerics->Supports_Tangent_Batch(config)) {
+            for (auto i = iBeg; i < iEnd; ++i) {
+              unsigned long indexNode[MAXNNODE_3D];
+              const su2double simp_penalty = SetElementData(chunkElems[i].second, element, indexNode);
+
+              fea_numerics->Compute_Tangent_Matrix(element, config);
+
+              AddElementTerms(*element, indexNode, nNodes, simp_penalty);
+            }
+          }
+          else {
+            for (auto iBatch = iBeg; iBatch < iEnd; iBatch += BATCH_SIZE) {
+              const auto nLanes = min(BATCH_SIZE, iEnd-iBatch);
+              unsigned long indexNode[BATCH_SIZE][MAXNNODE_3D];
+              su2double simp_penalty[BATCH_SIZE];
+
+              for (auto iLane = 0ul; iLane < nLanes; ++iLane) {
+                simp_penalty[iLane] = SetElementData(chunkElems[iBatch+iLane].second, element, indexNode[iLane]);
+                fea_numerics->Set_Batch_Element(batch, iLane, element, config);
+              }
+              batch.PadLanes(nLanes);
+
+              fea_numerics->Compute_Tangent_Matrix_Batch(batch, config);
+
+              for (auto iLane = 0ul; iLane < nLanes; ++iLane)
+                AddElementTerms(batch.GetLane(iLane), indexNode[iLane], nNodes, simp_penalty[iLane]);
+            }
+          }
+          iBeg = iEnd;
+        }
+
+      } // end chunk loop
+      END_SU2_OMP_FOR
+
+    } // end color loop
+
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+void CFEASolver::SetTangentMatrixZero() {
+
+  if (!MatrixFree) {
+    Jacobian.SetValZero();
+    return;
+  }
+  SU2_OMP_MASTER
+  InvDiagBlocksValid = false;
+  END_SU2_OMP_MASTER
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iVar = 0ul; iVar < nVar*nVar; iVar++)
+      DiagBlocks[iPoint*nVar*nVar+iVar] = 0.0;
+  END_SU2_OMP_FOR
+}
+
+void CFEASolver::MatrixFreeProduct(CGeometry *geometry, const CConfig *config, const CSysVector<MatrixFreeScalar>& u,
+                                   CSysVector<MatrixFreeScalar>& v, bool applyBCs) {
+
+  /*--- Same terms as the Jacobian of Compute_StiffMatrix (linear) or of Compute_StiffMatrix_NodalStressRes
+   *    (nonlinear), plus a0 * mass matrix for dynamic problems (see ImplicitNewmark_Iteration). ---*/
+
+  const bool nonlinear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::LARGE);
+  const bool dynamic = config->GetTime_Domain();
+  const bool prestretch_fem = nonlinear_analysis && config->GetPrestretch();
+  const bool de_effects = nonlinear_analysis && config->GetDE_Effects();
+
+  const bool topology_mode = config->GetTopology_Optimization();
+  const su2double simp_exponent = config->GetSIMP_Exponent();
+  const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+
+  CNumerics** numerics = MatrixFreeNumerics;
+
+  /*--- Make the view of the input consistent, and clear the output before accumulating the element products. ---*/
+  SU2_OMP_BARRIER
+  v.SetValZero();
+  SU2_OMP_BARRIER
+
+  for(auto color : ElemColoring) {
+
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      auto iElem = color.indices[k];
+
+      unsigned short iNode, jNode, iDim, iVar, jVar;
+
+      int thread = omp_get_thread_num();
+
+      /*--- Convert VTK type to index in the element container. ---*/
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+      /*--- Each thread needs a dedicated element. ---*/
+      CElement* fea_elem = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+      CElement* de_elem = element_container[DE_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+      /*--- Set the coordinates and gather the input, the columns of the fixed DOFs are zero when applying BCs. ---*/
+      unsigned long indexNode[MAXNNODE_3D];
+      passivedouble uElem[MAXNNODE_3D][MAXNVAR] = {{0.0}};
+      passivedouble vElem[MAXNNODE_3D][MAXNVAR] = {{0.0}};
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+        for (iDim = 0; iDim < nDim; iDim++) {
+          su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+          su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+
+          if (prestretch_fem)
+            val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
+
+          fea_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+          fea_elem->SetRef_Coord(iNode, iDim, val_Coord);
+
+          if (de_effects) {
+            de_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+            de_elem->SetRef_Coord(iNode, iDim, val_Coord);
+          }
+        }
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          const auto iDOF = indexNode[iNode]*nVar + iVar;
+          if (!applyBCs || !FixedDOF[iDOF])
+            uElem[iNode][iVar] = SU2_TYPE::Passive<MatrixFreeScalar>::Value(u[iDOF]);
+        }
+      }
+
+      /*--- In topology mode determine the penalties to apply to the stiffness and to the mass. ---*/
+      su2double simp_penalty = 1.0, mass_penalty = 1.0;
+      if (topology_mode) {
+        su2double density = element_properties[iElem]->GetPhysicalDensity();
+        simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+        mass_penalty = simp_minstiff+(1.0-simp_minstiff)*density;
+      }
+
+      /*--- Set the properties of the element. ---*/
+      fea_elem->Set_ElProperties(element_properties[iElem]);
+      if (de_effects)
+        de_elem->Set_ElProperties(element_properties[iElem]);
+
+      /*--- Mass term first, the tangent matrix computation clears the element. ---*/
+      if (dynamic) {
+        numerics[FEA_TERM + thread*MAX_TERMS]->Compute_Mass_Matrix(fea_elem, config);
+
+        for (iNode = 0; iNode < nNodes; iNode++) {
+          for (jNode = 0; jNode < nNodes; jNode++) {
+            const passivedouble Mab = SU2_TYPE::GetValue(a_dt[0] * mass_penalty * fea_elem->Get_Mab(iNode, jNode));
+            for (iVar = 0; iVar < nVar; iVar++)
+              vElem[iNode][iVar] += Mab * uElem[jNode][iVar];
+          }
+        }
+      }
+
+      /*--- Compute the element tangent matrices, one numerics per thread. ---*/
+      int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+
+      numerics[NUM_TERM]->Compute_Tangent_Matrix(fea_elem, config);
+
+      if (de_effects)
+        numerics[DE_TERM + thread*MAX_TERMS]->Compute_Tangent_Matrix(de_elem, config);
+
+      const passivedouble penalty = SU2_TYPE::GetValue(simp_penalty);
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        for (jNode = 0; jNode < nNodes; jNode++) {
+
+          auto Kab = fea_elem->Get_Kab(iNode, jNode);
+
+          /*--- Terms of the block's diagonal. ---*/
+          su2double Ks_ab = 0.0;
+          if (nonlinear_analysis) Ks_ab += fea_elem->Get_Ks_ab(iNode, jNode);
+          if (de_effects) Ks_ab += de_elem->Get_Ks_ab(iNode, jNode);
+
+          for (iVar = 0; iVar < nVar; iVar++) {
+            passivedouble sum = SU2_TYPE::GetValue(Ks_ab) * uElem[jNode][iVar];
+            for (jVar = 0; jVar < nVar; jVar++)
+              sum += SU2_TYPE::GetValue(Kab[iVar*nVar+jVar]) * uElem[jNode][jVar];
+            vElem[iNode][iVar] += penalty * sum;
+          }
+        }
+      }
+
+      /*--- Scatter the element product. ---*/
+      for (iNode = 0; iNode < nNodes; iNode++) {
+
+        if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+
+        for (iVar = 0; iVar < nVar; iVar++)
+          v(indexNode[iNode], iVar) += vElem[iNode][iVar];
+
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+      }
+
+    } // end iElem loop
+    END_SU2_OMP_FOR
+
+  } // end color loop
+
+  /*--- Identity rows for the fixed DOFs. ---*/
+  if (applyBCs) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iDOF = 0ul; iDOF < nPoint*nVar; iDOF++)
+      if (FixedDOF[iDOF]) v[iDOF] = u[iDOF];
+    END_SU2_OMP_FOR
+  }
+
+  /*--- MPI Parallelization. ---*/
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+
+}
+
+void CFEASolver::MatrixFreePreconditioner(CGeometry *geometry, const CConfig *config,
+                                          const CSysVector<MatrixFreeScalar>& u,
+                                          CSysVector<MatrixFreeScalar>& v) const {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto invD = &InvDiagBlocks[iPoint*nVar*nVar];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      MatrixFreeScalar sum = 0.0;
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        sum += invD[iVar*nVar+jVar] * u(iPoint, jVar);
+      v(iPoint, iVar) = sum;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- MPI Parallelization. ---*/
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+
+}
+
 void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
   const bool topology_mode = config->GetTopology_Optimization();
@@ -886,7 +1388,14 @@ void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numer
   SU2_OMP_PARALLEL
   {
     /*--- Clear matrix before calculation. ---*/
-    MassMatrix.SetValZero();
+    if (!MatrixFree) {
+      MassMatrix.SetValZero();
+    }
+    else {
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) MassDiag[iPoint] = 0.0;
+      END_SU2_OMP_FOR
+    }
 
     for(auto color : ElemColoring) {
 
@@ -936,13 +1445,19 @@ void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numer
 
           if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
 
-          for (jNode = 0; jNode < nNodes; jNode++) {
+          /*--- Only the diagonal is needed by the matrix-free preconditioner. ---*/
+          if (MatrixFree) {
+            MassDiag[indexNode[iNode]] += SU2_TYPE::GetValue(simp_penalty * element->Get_Mab(iNode, iNode));
+          }
+          else {
+            for (jNode = 0; jNode < nNodes; jNode++) {
 
-            auto Mij = MassMatrix.GetBlock(indexNode[iNode], indexNode[jNode]);
-            su2double Mab = simp_penalty * element->Get_Mab(iNode, jNode);
+              auto Mij = MassMatrix.GetBlock(indexNode[iNode], indexNode[jNode]);
+              su2double Mab = simp_penalty * element->Get_Mab(iNode, jNode);
 
-            for (iVar = 0; iVar < nVar; iVar++)
-              Mij[iVar*(nVar+1)] += SU2_TYPE::GetValue(Mab);
+              for (iVar = 0; iVar < nVar; iVar++)
+                Mij[iVar*(nVar+1)] += SU2_TYPE::GetValue(Mab);
+            }
           }
 
           if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
@@ -1559,7 +2074,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, const CConfig *config, unsigned
 
     LinSysSol.SetBlock(iPoint, zeros);
     if (LinSysReact.GetLocSize() > 0) LinSysReact.SetBlock(iPoint, zeros);
-    Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+    EnforceSolutionAtNode(iPoint, zeros);
 
   }
 
@@ -1639,7 +2154,7 @@ void CFEASolver::BC_Sym_Plane(CGeometry *geometry, const CConfig *config, unsign
     nodes->SetBound_Disp(iPoint, axis, 0.0);
     LinSysSol(iPoint, axis) = 0.0;
     if (LinSysReact.GetLocSize() > 0) LinSysReact(iPoint, axis) = 0.0;
-    Jacobian.EnforceSolutionAtDOF(iPoint, axis, su2double(0.0), LinSysRes);
+    EnforceSolutionAtDOF(iPoint, axis, 0.0);
 
   }
 
@@ -1676,7 +2191,7 @@ void CFEASolver::BC_DispDir(CGeometry *geometry, const CConfig *config, unsigned
       LinSysSol(iNode,iDim) = DispDir[iDim] - nodes->GetSolution(iNode,iDim);
 
     /*--- Enforce the solution. ---*/
-    Jacobian.EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode), LinSysRes);
+    EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode));
   }
 
 }
@@ -1786,7 +2301,8 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CConfig *config, CNumerics
     /*--- If the problem is linear, the only check we do is the RMS of the residuals. ---*/
     /*---  Compute the residual Ax-f ---*/
 
-    const auto ResidualAux = computeLinearResidual(Jacobian, LinSysSol, LinSysRes);
+    const auto ResidualAux = MatrixFree? MatrixFreeLinearResidual(geometry, config) :
+                                         computeLinearResidual(Jacobian, LinSysSol, LinSysRes);
 
     SU2_OMP_PARALLEL {
 
@@ -2158,7 +2674,7 @@ void CFEASolver::ImplicitNewmark_Iteration(const CGeometry *geometry, CNumerics
        * correct differentiation the Jacobian is recomputed every time step.
        *
        */
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if (((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) && !MatrixFree) {
         Jacobian.MatrixMatrixAddition(SU2_TYPE::GetValue(a_dt[0]), MassMatrix);
       }
 
@@ -2342,7 +2858,7 @@ void CFEASolver::GeneralizedAlpha_Iteration(const CGeometry *geometry, CNumerics
       /*--- Add the mass matrix contribution to the Jacobian. ---*/
 
       /*--- See notes on logic in ImplicitNewmark_Iteration(). ---*/
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if (((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) && !MatrixFree) {
         Jacobian.MatrixMatrixAddition(SU2_TYPE::GetValue(a_dt[0]), MassMatrix);
       }
 
@@ -2480,9 +2996,19 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
   CSysMatrixComms::Complete(LinSysSol, geometry, config);
 
   for (auto iPoint : ExtraVerticesToEliminate) {
-    Jacobian.EnforceSolutionAtNode(iPoint, LinSysSol.GetBlock(iPoint), LinSysRes);
+    EnforceSolutionAtNode(iPoint, LinSysSol.GetBlock(iPoint));
+  }
+
+  if (MatrixFree) {
+    MatrixFreeSolve(geometry, config);
+    return;
   }
 
+  /*--- With modified Newton-Raphson the tangent matrix is only assembled in the first iteration. ---*/
+  const bool mod_newton = (config->GetGeometricConditions() == STRUCT_DEFORMATION::LARGE) &&
+                          (config->GetKind_SpaceIteScheme_FEA() == STRUCT_SPACE_ITE::MOD_NEWTON);
+  System.SetSameMatrix(mod_newton && (config->GetInnerIter() != 0));
+
   SU2_OMP_PARALLEL
   {
   /*--- This is required for the discrete adjoint. ---*/
@@ -2506,6 +3032,129 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 
 }
 
+void CFEASolver::MatrixFreeSolve(CGeometry *geometry, const CConfig *config) {
+
+  const bool dynamic = config->GetTime_Domain();
+  const auto kindSolver = config->GetKind_Linear_Solver();
+  const auto maxIter = config->GetLinear_Solver_Iter();
+  const MatrixFreeScalar solverTol = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+  const MatrixFreeScalar massCoeff = SU2_TYPE::GetValue(a_dt[0]);
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Eliminate the columns of the fixed DOFs, i.e. move their product with the known solution to the rhs.
+   *    The rows of the fixed DOFs were set by EnforceSolutionAtNode/DOF. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    MatrixFreeSol[i] = FixedDOF[i]? SU2_TYPE::GetValue(LinSysSol[i]) : 0.0;
+  END_SU2_OMP_FOR
+
+  MatrixFreeProduct(geometry, config, MatrixFreeSol, MatrixFreeRes, false);
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i)
+    if (!FixedDOF[i]) LinSysRes[i] -= MatrixFreeRes[i];
+  END_SU2_OMP_FOR
+
+  /*--- As for the assembled system, the rhs of the halo points is zero. ---*/
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = nPointDomain*nVar; i < nPoint*nVar; ++i) LinSysRes[i] = 0.0;
+  END_SU2_OMP_FOR
+
+  /*--- Invert the diagonal blocks of the operator (with the BCs) for the block-Jacobi preconditioner, only when
+   *    they were assembled again (i.e. not after the first iteration of modified Newton-Raphson). ---*/
+
+  if (!InvDiagBlocksValid) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      MatrixFreeScalar block[MAXNVAR*MAXNVAR];
+
+      for (auto iVar = 0ul; iVar < nVar*nVar; iVar++)
+        block[iVar] = DiagBlocks[iPoint*nVar*nVar+iVar];
+
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        if (dynamic) block[iVar*(nVar+1)] += massCoeff * MassDiag[iPoint];
+
+        if (FixedDOF[iPoint*nVar+iVar]) {
+          for (auto jVar = 0ul; jVar < nVar; jVar++)
+            block[iVar*nVar+jVar] = block[jVar*nVar+iVar] = 0.0;
+          block[iVar*(nVar+1)] = 1.0;
+        }
+      }
+      InvertBlock(nVar, block, &InvDiagBlocks[iPoint*nVar*nVar]);
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_MASTER
+    InvDiagBlocksValid = true;
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Solve the system in the type of the operator. ---*/
+
+  MatrixFreeRes.PassiveCopy(LinSysRes);
+  MatrixFreeSol.PassiveCopy(LinSysSol);
+
+  const CFEAMatrixFreeProduct product(this, geometry, config);
+  const CFEABlockJacobiPreconditioner precond(this, geometry, config);
+
+  MatrixFreeScalar residual = 0.0;
+  unsigned long iter = 0;
+
+  switch (kindSolver) {
+    case CONJUGATE_GRADIENT:
+      iter = System.CG_LinSolver(MatrixFreeRes, MatrixFreeSol, product, precond, solverTol, maxIter, residual,
+                                 false, config);
+      break;
+    case BCGSTAB:
+      iter = System.BCGSTAB_LinSolver(MatrixFreeRes, MatrixFreeSol, product, precond, solverTol, maxIter, residual,
+                                      false, config);
+      break;
+    case RESTARTED_FGMRES:
+      iter = System.RFGMRES_LinSolver(MatrixFreeRes, MatrixFreeSol, product, precond, solverTol, maxIter, residual,
+                                      false, config);
+      break;
+    default:
+      iter = System.FGMRES_LinSolver(MatrixFreeRes, MatrixFreeSol, product, precond, solverTol, maxIter, residual,
+                                     false, config);
+      break;
+  }
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nPoint*nVar; ++i) LinSysSol[i] = MatrixFreeSol[i];
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(residual);
+  }
+  END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+CSysVector<CFEASolver::MatrixFreeScalar> CFEASolver::MatrixFreeLinearResidual(CGeometry *geometry,
+                                                                              const CConfig *config) {
+
+  CSysVector<MatrixFreeScalar> r(nPoint, nPointDomain, nVar, nullptr);
+
+  SU2_OMP_PARALLEL
+  {
+    MatrixFreeSol.PassiveCopy(LinSysSol);
+
+    MatrixFreeProduct(geometry, config, MatrixFreeSol, r, true);
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto i = 0ul; i < nPointDomain*nVar; ++i) r[i] -= SU2_TYPE::GetValue(LinSysRes[i]);
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  return r;
+}
 
 void CFEASolver::PredictStruct_Displacement(CGeometry *geometry, const CConfig *config) {
 
@@ -42,8 +42,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver() : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -76,8 +74,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -121,8 +117,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
   CFx_Inv = nullptr;   CFy_Inv = nullptr;   CFz_Inv = nullptr;
@@ -265,6 +259,22 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Determine the size per OpenMP thread of the work array needed by the
+        sum factorization kernels of the standard elements and allocate it.
+        The padded N value is rounded up to 64 bytes, because that is done
+        for the last chunks in the ADER predictor step. ---*/
+  const unsigned long nPadSumFact = nextMultiple(nPadGemm, 64/sizeof(passivedouble));
+  strideWorkArraySumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i) {
+    if( standardElementsSol[i].GetSumFactorization() ) {
+      const unsigned long sizeElem = 2*nPadSumFact*standardElementsSol[i].GetNIntegration();
+      strideWorkArraySumFact = max(strideWorkArraySumFact, sizeElem);
+    }
+  }
+
+  strideWorkArraySumFact = nextMultiple(strideWorkArraySumFact, 64/sizeof(passivedouble));
+  workArraySumFact.resize(strideWorkArraySumFact*omp_get_max_threads());
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -412,6 +422,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   startLocResInternalFacesLocalElem.assign(nTimeLevels+1, 0);
   startLocResInternalFacesWithHaloElem.assign(nTimeLevels+1, 0);
+  startLocResInternalFaces.assign(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1, 0);
 
   /*--- Determine the size of the vector to store residuals that come from the
         integral over the faces and determine the number of entries in this
@@ -483,7 +494,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       }
     }
 
-    /* Store the position of the residual in the appropriate entry. */
+    /* Store the position of the residual in the appropriate entries. */
+    startLocResInternalFaces[i+1] = sizeVecResFaces;
     if(i < nMatchingInternalFacesWithHaloElem[0] )
       startLocResInternalFacesLocalElem[timeLevel+1] = sizeVecResFaces;
     else
@@ -732,7 +744,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver() {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -816,6 +828,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -823,98 +837,98 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
-                                       config->GetPressure_Critical(), config->GetTemperature_Critical());
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+                                          config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
-                                     config->GetTemperature_Critical(), config->GetAcentric_Factor());
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+                                        config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case COOLPROP:
 
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      auxFluidModel = new CCoolProp(config->GetFluid_Name());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config, false);
+      auxFluidModel = new CDataDrivenFluid(config, false);
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
 
       break;
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -954,17 +968,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -972,10 +986,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -989,7 +1003,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1068,52 +1082,61 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
+  delete auxFluidModel;
 
-  delete FluidModel;
+  /*--- Create one final fluid model object per OpenMP thread to be able to use them in parallel.
+   *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
 
-  switch (config->GetKind_FluidModel()) {
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND,
+                                                 config->GetPressure_Critical() / config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical() / config->GetTemperature_Ref());
+        break;
 
-    case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-  }
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND,
+                                               config->GetPressure_Critical() / config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical() / config->GetTemperature_Ref(),
+                                               config->GetAcentric_Factor());
+        break;
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+      case COOLPROP:
+        FluidModel[thread] = new CCoolProp(config->GetFluid_Name());
+        break;
 
-  if (viscous) {
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
-    FluidModel->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+      case DATADRIVEN_FLUID:
+        FluidModel[thread] = new CDataDrivenFluid(config, false);
+        break;
+    }
+
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+      GetFluidModel()->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+    }
   }
+  END_SU2_OMP_PARALLEL
+
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
@@ -3227,9 +3250,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3253,9 +3276,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3713,8 +3736,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3745,8 +3768,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3861,11 +3884,18 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
      not the tasks from the list have been completed. */
   vector<bool> taskCompleted(tasksList.size(), false);
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Allocate the memory for the work arrays of all OpenMP threads and initialize
+     it to zero to avoid warnings in debug mode  about uninitialized memory when
+     padding is applied. The tasks that are carried out by the master thread only
+     use the work array of the first thread. */
+  vector<su2double> workArrayVec(StrideWorkArrayThread()*omp_get_max_threads(), 0.0);
   su2double *workArray = workArrayVec.data();
 
+  /* The internal faces can only be treated by multiple threads if the Riemann
+     solver does not need the (non thread safe) numerics object. */
+  const bool threadedFaces = (config->GetRiemann_Solver_FEM() == UPWIND::ROE) ||
+                             (config->GetRiemann_Solver_FEM() == UPWIND::LAX_FRIEDRICH);
+
   /* While loop to carry out all the tasks in tasksList. */
   unsigned long lowestIndexInList = 0;
   while(lowestIndexInList < tasksList.size()) {
@@ -3902,7 +3932,10 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
                                            + nVolElemInternalPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+              ThreadedRangeTask(config, elemBeg, elemEnd, workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  ADER_DG_PredictorStep(config, beg, end, work);
+                });
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -3915,7 +3948,10 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
               const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
               const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
                                            + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+              ThreadedRangeTask(config, elemBeg, elemEnd, workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  ADER_DG_PredictorStep(config, beg, end, work);
+                });
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4033,32 +4069,41 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
               /*--- Compute the volume portion of the residual. ---*/
               const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
+              ThreadedRangeTask(config, nVolElemOwnedPerTimeLevel[level],
+                                nVolElemOwnedPerTimeLevel[level+1], workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  Volume_Residual(config, beg, end, work);
+                });
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
 
             case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
+              /* Compute the residual of the faces that only involve owned elements.
+                 The location in the face residual follows from the first face. */
               const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
+              ThreadedRangeTask(config, nMatchingInternalFacesLocalElem[level],
+                                nMatchingInternalFacesLocalElem[level+1], workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  unsigned long indResFaces = startLocResInternalFaces[beg];
+                  ResidualFaces(config, beg, end, indResFaces, numerics[CONV_TERM], work);
+                }, threadedFaces);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
 
             case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Compute the residual of the faces that involve a halo element. */
+              /* Compute the residual of the faces that involve a halo element.
+                 The location in the face residual follows from the first face. */
               const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
+              ThreadedRangeTask(config, nMatchingInternalFacesWithHaloElem[level],
+                                nMatchingInternalFacesWithHaloElem[level+1], workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  unsigned long indResFaces = startLocResInternalFaces[beg];
+                  ResidualFaces(config, beg, end, indResFaces, numerics[CONV_TERM], work);
+                }, threadedFaces);
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4124,10 +4169,11 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
               /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
               const unsigned short level = tasksList[i].timeLevel;
               const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
+              ThreadedRangeTask(config, nVolElemOwnedPerTimeLevel[level],
+                                nVolElemOwnedPerTimeLevel[level+1], workArray,
+                [&](unsigned long beg, unsigned long end, su2double *work) {
+                  MultiplyResidualByInverseMassMatrix(config, useADER, beg, end, work);
+                });
               taskCarriedOut = taskCompleted[i] = true;
               break;
             }
@@ -4767,9 +4813,6 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -4818,8 +4861,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4842,8 +4885,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  VolumeDOFsToIntegration(config, ind, NPad, 1, nDim, fluxXDOF, gradFluxXInt);
+  VolumeDOFsToIntegration(config, ind, NPad, 1, nDim, fluxYDOF, gradFluxYInt);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -4905,7 +4948,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    VolumeDOFsToIntegration(config, ind, NPad, 0, 1, sol, solInt);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -4997,7 +5040,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  VolumeIntegrationToDOFs(config, ind, NPad, false, divFlux, res);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
@@ -5012,9 +5055,6 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -5067,8 +5107,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5101,9 +5141,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  VolumeDOFsToIntegration(config, ind, NPad, 1, nDim, fluxXDOF, gradFluxXInt);
+  VolumeDOFsToIntegration(config, ind, NPad, 1, nDim, fluxYDOF, gradFluxYInt);
+  VolumeDOFsToIntegration(config, ind, NPad, 1, nDim, fluxZDOF, gradFluxZInt);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5182,7 +5222,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    VolumeDOFsToIntegration(config, ind, NPad, 0, 1, sol, solInt);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5278,7 +5318,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  VolumeIntegrationToDOFs(config, ind, NPad, false, divFlux, res);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -5297,9 +5337,6 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Check if a body force is present and set it accordingly. */
@@ -5319,11 +5356,11 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the solution and the derivatives w.r.t. the parametric     ---*/
-  /*--- coordinates in the integration points. The first argument in       ---*/
-  /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
+  /*--- coordinates in the integration points, i.e. nDim+1 blocks of the  ---*/
+  /*--- basis function matrix.                                            ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  VolumeDOFsToIntegration(config, ind, NPad, 0, 3, sol, solAndGradInt);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the inviscid fluxes, multiplied by the   ---*/
@@ -5357,8 +5394,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5487,7 +5524,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  VolumeIntegrationToDOFs(config, ind, NPad, false, divFlux, res);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
@@ -5506,9 +5543,6 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- Get the necessary information from the standard element. ---*/
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Check if a body force is present and set it accordingly. */
@@ -5530,11 +5564,11 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the solution and the derivatives w.r.t. the parametric     ---*/
-  /*--- coordinates in the integration points. The first argument in       ---*/
-  /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
+  /*--- coordinates in the integration points, i.e. nDim+1 blocks of the  ---*/
+  /*--- basis function matrix.                                            ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  VolumeDOFsToIntegration(config, ind, NPad, 0, 4, sol, solAndGradInt);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5572,8 +5606,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5723,7 +5757,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  VolumeIntegrationToDOFs(config, ind, NPad, false, divFlux, res);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig             *config,
@@ -5831,6 +5865,78 @@ void CFEM_DG_EulerSolver::Shock_Capturing_DG(CConfig             *config,
   }
 }
 
+void CFEM_DG_EulerSolver::VolumeDOFsToIntegration(CConfig              *config,
+                                                  const unsigned short ind,
+                                                  const unsigned short NPad,
+                                                  const unsigned short firstBlock,
+                                                  const unsigned short nBlocks,
+                                                  const su2double      *dataDOFs,
+                                                  su2double            *dataInt) {
+
+  const CFEMStandardElement &standardElem = standardElementsSol[ind];
+  const unsigned short nInt  = standardElem.GetNIntegration();
+  const unsigned short nDOFs = standardElem.GetNDOFs();
+
+  if( standardElem.GetSumFactorization() ) {
+
+    /* Tensor product element. Carry out the sum factorization for every block
+       using the work array of this thread. */
+    su2double *work = workArraySumFact.data() + omp_get_thread_num()*strideWorkArraySumFact;
+    for(unsigned short b=0; b<nBlocks; ++b)
+      standardElem.SumFactDOFsToIntegration(NPad, firstBlock+b, dataDOFs,
+                                            dataInt + b*nInt*NPad, work);
+  }
+  else {
+
+    /* General element. Carry out the matrix multiplication with the
+       corresponding blocks of the basis function matrix. */
+    const su2double *matBasisInt = standardElem.GetMatBasisFunctionsIntegration()
+                                 + firstBlock*nInt*nDOFs;
+    blasFunctions->gemm(nInt*nBlocks, NPad, nDOFs, matBasisInt, dataDOFs, dataInt, config);
+  }
+}
+
+void CFEM_DG_EulerSolver::VolumeIntegrationToDOFs(CConfig              *config,
+                                                  const unsigned short ind,
+                                                  const unsigned short NPad,
+                                                  const bool           derivatives,
+                                                  const su2double      *dataInt,
+                                                  su2double            *dataDOFs) {
+
+  const CFEMStandardElement &standardElem = standardElementsSol[ind];
+  const unsigned short nInt  = standardElem.GetNIntegration();
+  const unsigned short nDOFs = standardElem.GetNDOFs();
+
+  if( standardElem.GetSumFactorization() ) {
+
+    /* Tensor product element. Use sum factorization with the work array of
+       this thread. For the derivatives the fluxes are stored per integration
+       point, hence the leading dimension is nDim*NPad and the contributions
+       of the parametric directions are summed. */
+    su2double *work = workArraySumFact.data() + omp_get_thread_num()*strideWorkArraySumFact;
+    if( derivatives ) {
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        standardElem.SumFactIntegrationToDOFs(NPad, iDim+1, nDim*NPad, dataInt + iDim*NPad,
+                                              dataDOFs, work, iDim > 0);
+    }
+    else
+      standardElem.SumFactIntegrationToDOFs(NPad, 0, NPad, dataInt, dataDOFs, work, false);
+  }
+  else if( derivatives ) {
+
+    /* General element. Multiply the fluxes with the transpose of the
+       derivatives of the basis functions. */
+    const su2double *matDerBasisIntTrans = standardElem.GetDerMatBasisFunctionsIntTrans();
+    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, dataInt, dataDOFs, config);
+  }
+  else {
+
+    /* General element. Multiply the data with the transpose of the basis functions. */
+    const su2double *basisFunctionsIntTrans = standardElem.GetBasisFunctionsIntegrationTrans();
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, dataInt, dataDOFs, config);
+  }
+}
+
 void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemBeg,
                                           const unsigned long elemEnd,
@@ -5874,9 +5980,6 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
     /*--- Set the pointers for the local arrays. ---*/
@@ -5906,9 +6009,9 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
           solDOFs[i*NPad+llNVar+mm] = solDOFsElem[i*nVar+mm];
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    /* Call the general function to determine the solution in the
+       integration points of the chunk of elements. */
+    VolumeDOFsToIntegration(config, ind, NPad, 0, 1, solDOFs, solInt);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5959,8 +6062,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6054,8 +6157,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6173,16 +6276,17 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Call the general function to multiply the fluxes with the transpose
+       of the derivatives of the basis functions. Use solDOFs as a temporary
+       storage for the result. */
+    VolumeIntegrationToDOFs(config, ind, NPad, true, fluxes, solDOFs);
 
     /* Add the contribution from the source terms, if needed. Use solInt
-       as temporary storage for the matrix product. */
+       as temporary storage for the result. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Call the general function to multiply with the transpose of the basis functions. */
+      VolumeIntegrationToDOFs(config, ind, NPad, false, sources, solInt);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6707,32 +6811,36 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     elemEnd   = nVolElemHaloPerTimeLevel[timeLevel+1];
   }
 
-  /* For the halo elements the residual is initialized to zero. */
-  if( !ownedElements ) {
-
+  /* The elements are independent, hence the loop can be shared by the threads. */
+  SU2_OMP_PARALLEL_(if(elemEnd-elemStart > OMP_MIN_SIZE))
+  {
+    /* Loop over the required element range. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for(unsigned long l=elemStart; l<elemEnd; ++l) {
-      su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
-      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
-        resDOFsElem[i] = 0.0;
-    }
-  }
 
-  /* Loop over the required element range. */
-  for(unsigned long l=elemStart; l<elemEnd; ++l) {
+      /* For the halo elements the residual is initialized to zero. */
+      if( !ownedElements ) {
+        su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+        for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
+          resDOFsElem[i] = 0.0;
+      }
 
-    /* Loop over the DOFs of this element. */
-    for(unsigned long i=volElem[l].offsetDOFsSolLocal;
-                      i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
+      /* Loop over the DOFs of this element. */
+      for(unsigned long i=volElem[l].offsetDOFsSolLocal;
+                        i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
 
-      /* Create the final residual by summing up all contributions. */
-      su2double *resDOF = VecResDOFs.data() + nVar*i;
-      for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
-        const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
-        for(unsigned short k=0; k<nVar; ++k)
-          resDOF[k] += resFace[k];
+        /* Create the final residual by summing up all contributions. */
+        su2double *resDOF = VecResDOFs.data() + nVar*i;
+        for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
+          const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
+          for(unsigned short k=0; k<nVar; ++k)
+            resDOF[k] += resFace[k];
+        }
       }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
@@ -6960,8 +7068,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7013,8 +7121,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7483,21 +7591,27 @@ void CFEM_DG_EulerSolver::ADER_DG_Iteration(const unsigned long elemBeg,
                                             const unsigned long elemEnd) {
 
   /*--- Update the solution by looping over the given range
-        of volume elements. ---*/
-  for(unsigned long l=elemBeg; l<elemEnd; ++l) {
-
-    /* Set the pointers for the residual and solution for this element. */
-    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
-    su2double *res     = VecTotResDOFsADER.data() + offset;
-    su2double *solDOFs = VecSolDOFs.data()        + offset;
-
-    /* Loop over the DOFs for this element and update the solution.
-       Initialize the residual to zero afterwards. */
-    for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i) {
-      solDOFs[i] -= VecDeltaTime[l]*res[i];
-      res[i]      = 0.0;
+        of volume elements, which is shared by the threads. ---*/
+  SU2_OMP_PARALLEL_(if(elemEnd-elemBeg > OMP_MIN_SIZE))
+  {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+
+      /* Set the pointers for the residual and solution for this element. */
+      const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+      su2double *res     = VecTotResDOFsADER.data() + offset;
+      su2double *solDOFs = VecSolDOFs.data()        + offset;
+
+      /* Loop over the DOFs for this element and update the solution.
+         Initialize the residual to zero afterwards. */
+      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i) {
+        solDOFs[i] -= VecDeltaTime[l]*res[i];
+        res[i]      = 0.0;
+      }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::BoundaryStates_Euler_Wall(CConfig                  *config,
@@ -7619,9 +7733,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7727,9 +7841,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7791,11 +7905,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
 
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7822,9 +7936,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7854,10 +7968,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7905,10 +8019,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -8002,7 +8116,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -8017,7 +8131,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8068,11 +8182,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8147,11 +8261,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9543,9 +9657,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
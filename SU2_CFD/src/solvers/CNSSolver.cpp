@@ -88,6 +88,11 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
+  /*--- The halos of the reconstruction data may be exchanged by the residual loop. ---*/
+
+  const bool deferHaloComms = !Output && muscl && !center && OverlapHaloComms(config);
+  if (deferHaloComms) ompMasterAssignBarrier(DeferHaloComms, true);
+
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
@@ -116,6 +121,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     SetPrimitive_Limiter(geometry, config);
   }
 
+  if (deferHaloComms) ompMasterAssignBarrier(DeferHaloComms, false);
+
   ComputeVorticityAndStrainMag(*config, geometry, iMesh);
 
   /*--- Compute the TauWall from the wall functions ---*/
@@ -93,6 +93,8 @@ CSolver::CSolver(LINEAR_SOLVER_MODE linear_solver_mode) : System(linear_solver_m
   /*--- Variable initialization to avoid valgrid warnings when not used. ---*/
 
   IterLinSolver = 0;
+  JacobianAge = 0;
+  JacobianUpdates = 0;
 
   /*--- Initialize pointer for any verification solution. ---*/
   VerificationSolution  = nullptr;
@@ -1352,6 +1354,10 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       COUNT_PER_POINT  = nPrimVarGrad;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION:
+      COUNT_PER_POINT  = nPrimVarGrad*(nDim+1);
+      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      break;
     case MPI_QUANTITIES::SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
@@ -1384,6 +1390,26 @@ void CSolver::GetCommCountAndType(const CConfig* config,
                      CURRENT_FUNCTION);
       break;
   }
+
+  /*--- Gradients and limiters only feed the reconstruction and the viscous
+   fluxes, they can be exchanged in single precision to halve the messages. ---*/
+
+  if (config->GetKind_Halo_Compression() == HALO_COMPRESSION::FLOAT32) {
+    switch (commType) {
+      case MPI_QUANTITIES::SOLUTION_LIMITER:
+      case MPI_QUANTITIES::PRIMITIVE_LIMITER:
+      case MPI_QUANTITIES::SOLUTION_GRADIENT:
+      case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
+      case MPI_QUANTITIES::SOLUTION_GRAD_REC:
+      case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
+      case MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION:
+      case MPI_QUANTITIES::AUXVAR_GRADIENT:
+        MPI_TYPE = COMM_TYPE_FLOAT;
+        break;
+      default:
+        break;
+    }
+  }
 }
 
 namespace CommHelpers {
@@ -1392,13 +1418,15 @@ namespace CommHelpers {
       case MPI_QUANTITIES::SOLUTION_GRAD_REC: return nodes->GetGradient_Reconstruction();
       case MPI_QUANTITIES::PRIMITIVE_GRADIENT: return nodes->GetGradient_Primitive();
       case MPI_QUANTITIES::PRIMITIVE_GRAD_REC: return nodes->GetGradient_Reconstruction();
+      case MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION: return nodes->GetGradient_Reconstruction();
       case MPI_QUANTITIES::AUXVAR_GRADIENT: return nodes->GetAuxVarGradient();
       default: return nodes->GetGradient();
     }
   }
 
   su2activematrix& selectLimiter(CVariable* nodes, MPI_QUANTITIES commType) {
-    if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
+    if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER ||
+        commType == MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
 }
@@ -1417,6 +1445,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   int iMessage, iSend, nSend;
 
+  const passivedouble startTime = SU2_MPI::Wtime();
+
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
@@ -1431,6 +1461,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
   /*--- Set some local pointers to make access simpler. ---*/
 
   su2double *bufDSend = geometry->bufD_P2PSend;
+  float *bufFSend = geometry->bufF_P2PSend;
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1507,6 +1538,13 @@ void CSolver::InitiateComms(CGeometry *geometry,
               for (iDim = 0; iDim < nDim; iDim++)
                 bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
             break;
+          case MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++)
+                bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+              bufDSend[buf_offset+nPrimVarGrad*nDim+iVar] = limiter(iPoint, iVar);
+            }
+            break;
           case MPI_QUANTITIES::SOLUTION_FEA:
             for (iVar = 0; iVar < nVar; iVar++) {
               bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
@@ -1533,6 +1571,13 @@ void CSolver::InitiateComms(CGeometry *geometry,
                            CURRENT_FUNCTION);
             break;
         }
+
+        /*--- Compress the packet of this point (HALO_COMPRESSION). ---*/
+
+        if (MPI_TYPE == COMM_TYPE_FLOAT) {
+          for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
+            bufFSend[buf_offset+iVar] = static_cast<float>(SU2_TYPE::GetValue(bufDSend[buf_offset+iVar]));
+        }
       }
       END_SU2_OMP_FOR
 
@@ -1541,6 +1586,16 @@ void CSolver::InitiateComms(CGeometry *geometry,
       geometry->PostP2PSends(geometry, config, MPI_TYPE, COUNT_PER_POINT, iMessage, false);
 
     }
+
+    /*--- Account the message volume for the performance summary. ---*/
+
+    SU2_OMP_MASTER {
+      const unsigned long nValues = COUNT_PER_POINT * geometry->nPoint_P2PSend[geometry->nP2PSend];
+      geometry->bytesP2PFull += nValues * sizeof(passivedouble);
+      geometry->bytesP2PSent += nValues * ((MPI_TYPE == COMM_TYPE_FLOAT) ? sizeof(float) : sizeof(passivedouble));
+      geometry->timeP2P += SU2_MPI::Wtime() - startTime;
+    }
+    END_SU2_OMP_MASTER
   }
 
 }
@@ -1561,13 +1616,16 @@ void CSolver::CompleteComms(CGeometry *geometry,
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
+  const passivedouble startTime = SU2_MPI::Wtime();
+
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
   /*--- Set some local pointers to make access simpler. ---*/
 
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
+  su2double *bufDRecv = geometry->bufD_P2PRecv;
+  const float *bufFRecv = geometry->bufF_P2PRecv;
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1615,6 +1673,13 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
 
+        /*--- Decompress the packet of this point (HALO_COMPRESSION). ---*/
+
+        if (MPI_TYPE == COMM_TYPE_FLOAT) {
+          for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
+            bufDRecv[buf_offset+iVar] = bufFRecv[buf_offset+iVar];
+        }
+
         /*--- Store the data correctly depending on the quantity. ---*/
 
         switch (commType) {
@@ -1655,6 +1720,13 @@ void CSolver::CompleteComms(CGeometry *geometry,
               for (iDim = 0; iDim < nDim; iDim++)
                 gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
             break;
+          case MPI_QUANTITIES::PRIMITIVE_RECONSTRUCTION:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++)
+                gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
+              limiter(iPoint,iVar) = bufDRecv[buf_offset+nPrimVarGrad*nDim+iVar];
+            }
+            break;
           case MPI_QUANTITIES::SOLUTION_FEA:
             for (iVar = 0; iVar < nVar; iVar++) {
               base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
@@ -1692,6 +1764,10 @@ void CSolver::CompleteComms(CGeometry *geometry,
 #ifdef HAVE_MPI
     SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
 #endif
+
+    SU2_OMP_MASTER
+    geometry->timeP2P += SU2_MPI::Wtime() - startTime;
+    END_SU2_OMP_MASTER
   }
 
 }
@@ -308,6 +308,9 @@ void CTurbSASolver::Viscous_Residual(const unsigned long iEdge, const CGeometry*
 void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                     CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Vectorized source terms, if supported for the current options. ---*/
+  if (Source_Residual_SIMD(geometry, solver_container, config)) return;
+
   bool axisymmetric = config->GetAxisymmetric();
   
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -43,6 +43,45 @@ CTurbSolver::~CTurbSolver() {
   for (auto& mat : SlidingState) {
     for (auto ptr : mat) delete [] ptr;
   }
+  delete sourceNumerics;
+}
+
+void CTurbSolver::InstantiateNumericsSIMD(const CSolver* const* solvers, const CConfig* config) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    const auto* flowVars = solvers[FLOW_SOL]->GetNodes();
+    const auto* constants = GetConstants();
+
+    edgeNumerics = CNumericsSIMD::CreateTurbNumerics(*config, nDim, flowVars, constants);
+    sourceNumerics = CSourceNumericsSIMD::CreateTurbSource(*config, nDim, flowVars, constants,
+                                                           GetTke_Inf(), GetOmega_Inf());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+bool CTurbSolver::Source_Residual_SIMD(const CGeometry* geometry, const CSolver* const* solver_container,
+                                       const CConfig* config) {
+  PrepareNumericsSIMD(solver_container, config);
+  if (!sourceNumerics) return false;
+
+  AD::StartNoSharedReading();
+
+  SU2_OMP_FOR_DYN(nextMultiple(omp_chunk_size, Double::Size))
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k + j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j * in;
+    }
+    sourceNumerics->ComputeSource(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+
+  return true;
 }
 
 void CTurbSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
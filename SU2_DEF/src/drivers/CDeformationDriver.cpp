@@ -28,6 +28,7 @@
 #include "../../include/drivers/CDeformationDriver.hpp"
 
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
 #include "../../../SU2_CFD/include/output/CMeshOutput.hpp"
 #include "../../../SU2_CFD/include/solvers/CMeshSolver.hpp"
@@ -497,8 +498,17 @@ void CDeformationDriver::OutputFiles() {
 
     output_container[iZone]->LoadData(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], nullptr);
 
+    /*--- The binary mesh format is selected by the extension of the output file. ---*/
+
+    const auto meshOutFilename = driver_config->GetMesh_Out_FileName();
+    const string binaryExt = SU2BinaryMesh::FILE_EXT;
+    const bool binaryMesh = meshOutFilename.size() > binaryExt.size() &&
+                            meshOutFilename.compare(meshOutFilename.size() - binaryExt.size(), binaryExt.size(),
+                                                    binaryExt) == 0;
+
     output_container[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone][INST_0][MESH_0],
-                                         OUTPUT_TYPE::MESH, driver_config->GetMesh_Out_FileName());
+                                         binaryMesh ? OUTPUT_TYPE::MESH_BINARY : OUTPUT_TYPE::MESH,
+                                         meshOutFilename);
 
     /*--- Set the file names for the visualization files. ---*/
 
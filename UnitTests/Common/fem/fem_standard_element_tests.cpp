@@ -0,0 +1,124 @@
+/*!
+ * \file fem_standard_element_tests.cpp
+ * \brief Unit tests for the sum factorization kernels of the DG standard elements.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+namespace {
+std::vector<su2double> TestData(size_t size, int seed) {
+  std::vector<su2double> x(size);
+  for (size_t i = 0; i < size; ++i) x[i] = std::sin(0.37 * (i + 1) + seed);
+  return x;
+}
+
+void CheckEqual(const std::vector<su2double>& x, const std::vector<su2double>& ref) {
+  su2double scale = 0.0;
+  for (const auto& v : ref) scale = std::max(scale, std::abs(v));
+  for (size_t i = 0; i < ref.size(); ++i) {
+    CHECK(SU2_TYPE::GetValue(x[i]) == Approx(SU2_TYPE::GetValue(ref[i])).margin(1e-12 * SU2_TYPE::GetValue(scale)));
+  }
+}
+
+std::unique_ptr<CConfig> DGConfig() {
+  std::stringstream options;
+  options << "SOLVER= FEM_EULER" << std::endl;
+  auto* orig = cout.rdbuf(nullptr);
+  std::unique_ptr<CConfig> config(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+  cout.rdbuf(orig);
+  return config;
+}
+}  // namespace
+
+TEST_CASE("Sum factorization matches the dense DG operators", "[FEM standard element]") {
+  const auto config = DGConfig();
+  CBlasStructure blas;
+
+  /*--- Number of entities per point, as the padded number of variables of the solver. ---*/
+  const unsigned short NPad = 6;
+
+  for (const unsigned short VTK_Type : {QUADRILATERAL, HEXAHEDRON}) {
+    const unsigned short nDim = (VTK_Type == QUADRILATERAL) ? 2 : 3;
+
+    for (const unsigned short nPoly : {1, 2, 3, 4}) {
+      for (const bool constJac : {true, false}) {
+        CAPTURE(VTK_Type, nPoly, constJac);
+        const CFEMStandardElement element(VTK_Type, nPoly, constJac, config.get());
+
+        /*--- Linear elements use the dense matrices. ---*/
+        REQUIRE(element.GetSumFactorization() == (nPoly > 1));
+        if (!element.GetSumFactorization()) continue;
+
+        const unsigned short nInt = element.GetNIntegration();
+        const unsigned short nDOFs = element.GetNDOFs();
+        std::vector<su2double> work(2 * nInt * NPad);
+
+        /*--- Interpolation and parametric derivatives in the integration points, blocks of matBasisIntegration. ---*/
+        const auto dataDOFs = TestData(nDOFs * NPad, 1);
+        for (unsigned short derDir = 0; derDir <= nDim; ++derDir) {
+          std::vector<su2double> ref(nInt * NPad), dataInt(nInt * NPad, 1e3);
+          const su2double* matBasisInt = element.GetMatBasisFunctionsIntegration() + derDir * nInt * nDOFs;
+          blas.gemm(nInt, NPad, nDOFs, matBasisInt, dataDOFs.data(), ref.data(), nullptr);
+
+          element.SumFactDOFsToIntegration(NPad, derDir, dataDOFs.data(), dataInt.data(), work.data());
+          CheckEqual(dataInt, ref);
+        }
+
+        /*--- Multiplication with the transposed basis functions. ---*/
+        {
+          const auto dataInt = TestData(nInt * NPad, 2);
+          std::vector<su2double> ref(nDOFs * NPad), result(nDOFs * NPad, 1e3);
+          blas.gemm(nDOFs, NPad, nInt, element.GetBasisFunctionsIntegrationTrans(), dataInt.data(), ref.data(),
+                    nullptr);
+
+          element.SumFactIntegrationToDOFs(NPad, 0, NPad, dataInt.data(), result.data(), work.data(), false);
+          CheckEqual(result, ref);
+        }
+
+        /*--- Multiplication with the transposed derivatives, the fluxes of all directions are stored per
+         * integration point and their contributions are summed, as in the volume residual. ---*/
+        {
+          const auto dataInt = TestData(nInt * nDim * NPad, 3);
+          std::vector<su2double> ref(nDOFs * NPad), result(nDOFs * NPad, 1e3);
+          blas.gemm(nDOFs, NPad, nInt * nDim, element.GetDerMatBasisFunctionsIntTrans(), dataInt.data(), ref.data(),
+                    nullptr);
+
+          for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+            element.SumFactIntegrationToDOFs(NPad, iDim + 1, nDim * NPad, dataInt.data() + iDim * NPad, result.data(),
+                                             work.data(), iDim > 0);
+          }
+          CheckEqual(result, ref);
+        }
+      }
+    }
+  }
+}
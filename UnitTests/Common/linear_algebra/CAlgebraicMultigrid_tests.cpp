@@ -0,0 +1,174 @@
+/*!
+ * \file CAlgebraicMultigrid_tests.cpp
+ * \brief Unit tests for the aggregation-based AMG preconditioner.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysVector.hpp"
+#include "../../../Common/include/linear_algebra/CAlgebraicMultigrid.hpp"
+
+namespace {
+using Scalar = su2mixedfloat;
+using Vector = CSysVector<Scalar>;
+
+/*--- BCSR matrix of the 5-point Laplacian on an n x n grid (Dirichlet boundaries), each entry is multiplied
+ * by a 2x2 coupling block, the diagonal is slightly dominant. ---*/
+struct CPoissonMatrix {
+  enum : unsigned long { nVar = 2 };
+  const unsigned long n, nPoint;
+  std::vector<unsigned long> row_ptr, col_ind, dia_ptr;
+  std::vector<Scalar> values;
+
+  explicit CPoissonMatrix(unsigned long size) : n(size), nPoint(size * size) {
+    const Scalar coupling[nVar * nVar] = {1.0, 0.2, 0.1, 1.0};
+
+    row_ptr.push_back(0);
+    for (auto j = 0ul; j < n; ++j) {
+      for (auto i = 0ul; i < n; ++i) {
+        /*--- Neighbors in ascending order of the column index. ---*/
+        const long offsets[] = {-long(n), -1, 0, 1, long(n)};
+        for (const auto offset : offsets) {
+          if ((offset == -1 && i == 0) || (offset == 1 && i + 1 == n) || (offset == -long(n) && j == 0) ||
+              (offset == long(n) && j + 1 == n))
+            continue;
+          const auto col = j * n + i + offset;
+          if (offset == 0) dia_ptr.push_back(col_ind.size());
+          col_ind.push_back(col);
+          const Scalar factor = (offset == 0) ? 4.05 : -1.0;
+          for (auto k = 0ul; k < nVar * nVar; ++k) values.push_back(factor * coupling[k]);
+        }
+        row_ptr.push_back(col_ind.size());
+      }
+    }
+  }
+
+  void Product(const Vector& x, Vector& y) const {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        Scalar sum = 0.0;
+        for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            sum += values[k * nVar * nVar + iVar * nVar + jVar] * x(col_ind[k], jVar);
+        y(iPoint, iVar) = sum;
+      }
+    }
+  }
+
+  /*--- Norm of the residual b - A x. ---*/
+  Scalar ResidualNorm(const Vector& b, const Vector& x) const {
+    Vector Ax(b);
+    Product(x, Ax);
+    Scalar norm = 0.0;
+    for (auto i = 0ul; i < b.GetLocSize(); ++i) norm += pow(b[i] - Ax[i], 2);
+    return sqrt(norm);
+  }
+};
+
+std::unique_ptr<CConfig> TestConfig() {
+  std::stringstream options;
+  options << "SOLVER= EULER" << std::endl;
+  options << "LINEAR_SOLVER_PREC= AMG" << std::endl;
+  auto* orig = cout.rdbuf(nullptr);
+  std::unique_ptr<CConfig> config(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+  cout.rdbuf(orig);
+  return config;
+}
+
+Vector RightHandSide(const CPoissonMatrix& A) {
+  Vector b;
+  b.Initialize(A.nPoint, A.nPoint, CPoissonMatrix::nVar, 0.0);
+  for (auto i = 0ul; i < b.GetLocSize(); ++i) b[i] = std::sin(0.1 * i) + 0.5;
+  return b;
+}
+}  // namespace
+
+TEST_CASE("AMG direct coarse solve is exact", "[AMG]") {
+  const auto config = TestConfig();
+  /*--- Without halos no communication is needed. ---*/
+  CGeometry geometry;
+
+  /*--- Small enough to be solved directly on the finest level. ---*/
+  const CPoissonMatrix A(10);
+  CAlgebraicMultigrid<Scalar> amg;
+  amg.SetMatrix(A.nVar, A.nPoint, A.nPoint, A.row_ptr.data(), A.col_ind.data(), A.dia_ptr.data(), A.values.data());
+  amg.Build(config.get());
+  REQUIRE(amg.GetNumLevels() == 1);
+
+  const auto b = RightHandSide(A);
+  Vector x(b);
+  x.SetValZero();
+  amg.Solve(b, x, &geometry, config.get());
+
+  const Scalar eps = std::numeric_limits<Scalar>::epsilon();
+  CHECK(A.ResidualNorm(b, x) < 1e3 * eps * b.norm());
+}
+
+TEST_CASE("AMG V-cycle reduces the residual", "[AMG]") {
+  const auto config = TestConfig();
+  CGeometry geometry;
+
+  CPoissonMatrix A(32);
+  CAlgebraicMultigrid<Scalar> amg;
+  amg.SetMatrix(A.nVar, A.nPoint, A.nPoint, A.row_ptr.data(), A.col_ind.data(), A.dia_ptr.data(), A.values.data());
+  amg.Build(config.get());
+  REQUIRE(amg.GetNumLevels() > 1);
+
+  const auto b = RightHandSide(A);
+  const Scalar norm0 = b.norm();
+
+  /*--- One cycle with zero initial guess. ---*/
+  Vector x(b), r(b), dx(b);
+  amg.Solve(b, x, &geometry, config.get());
+  const Scalar norm1 = A.ResidualNorm(b, x);
+  CHECK(norm1 < 0.75 * norm0);
+
+  /*--- Used as a stationary iteration, the cycles keep reducing the residual. ---*/
+  Scalar norm = norm1;
+  for (int iter = 0; iter < 10; ++iter) {
+    A.Product(x, r);
+    for (auto i = 0ul; i < r.GetLocSize(); ++i) r[i] = b[i] - r[i];
+    amg.Solve(r, dx, &geometry, config.get());
+    x += dx;
+    const Scalar newNorm = A.ResidualNorm(b, x);
+    CHECK(newNorm < norm);
+    norm = newNorm;
+  }
+  CHECK(norm < 1e-2 * norm0);
+
+  /*--- A rebuild with new values (same pattern) reuses the aggregation. ---*/
+  const auto nLevels = amg.GetNumLevels();
+  for (auto& v : A.values) v *= 2.0;
+  amg.Build(config.get());
+  CHECK(amg.GetNumLevels() == nLevels);
+  amg.Solve(b, x, &geometry, config.get());
+  CHECK(A.ResidualNorm(b, x) < 0.75 * norm0);
+}
@@ -0,0 +1,180 @@
+/*!
+ * \file CHalfBlockStorage_tests.cpp
+ * \brief Unit tests for the 16-bit conversions and block storage of CHalfBlockStorage.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "../../../Common/include/linear_algebra/CHalfBlockStorage.hpp"
+
+using namespace HalfPrecision;
+
+namespace {
+bool IsNaN16(uint16_t h, bool bf16) {
+  return bf16 ? ((h & 0x7f80u) == 0x7f80u && (h & 0x7fu)) : ((h & 0x7c00u) == 0x7c00u && (h & 0x3ffu));
+}
+}  // namespace
+
+TEST_CASE("FP16 encoding", "[Half precision]") {
+  const float inf = std::numeric_limits<float>::infinity();
+
+  /*--- Input and expected code, normals (with ties to even), subnormals, overflow, infinity. ---*/
+  const std::vector<std::pair<float, uint16_t>> cases = {
+      {0.0f, 0x0000},
+      {-0.0f, 0x8000},
+      {1.0f, 0x3c00},
+      {-2.0f, 0xc000},
+      {1.0f / 3, 0x3555},
+      {65504.0f, 0x7bff},
+      {1.0f + std::ldexp(1.0f, -11), 0x3c00},
+      {1.0f + 3 * std::ldexp(1.0f, -11), 0x3c02},
+      {std::ldexp(1.0f, -14), 0x0400},
+      {std::ldexp(1.0f, -14) - std::ldexp(1.0f, -24), 0x03ff},
+      {std::ldexp(1.0f, -15), 0x0200},
+      {std::ldexp(1.0f, -24), 0x0001},
+      {std::ldexp(1.0f, -25), 0x0000},
+      {1.5f * std::ldexp(1.0f, -25), 0x0001},
+      {3 * std::ldexp(1.0f, -25), 0x0002},
+      {std::ldexp(1.0f, -30), 0x0000},
+      {65519.0f, 0x7bff},
+      {65520.0f, 0x7c00},
+      {-1e10f, 0xfc00},
+      {inf, 0x7c00},
+      {-inf, 0xfc00}};
+
+  for (const auto& c : cases) {
+    CHECK(FloatToFP16Soft(c.first) == c.second);
+    CHECK(FloatToFP16(c.first) == c.second);
+  }
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  CHECK(IsNaN16(FloatToFP16Soft(nan), false));
+  CHECK(IsNaN16(FloatToFP16(nan), false));
+  CHECK(IsNaN16(FloatToFP16Soft(-nan), false));
+
+  /*--- The portable and the native (F16C, when available) versions agree over a sweep of the floats. ---*/
+  for (uint64_t i = 0; i < (1ull << 32); i += 4099) {
+    const auto bits = static_cast<uint32_t>(i);
+    float f;
+    memcpy(&f, &bits, sizeof(float));
+    if (std::isnan(f)) continue;
+    REQUIRE(FloatToFP16Soft(f) == FloatToFP16(f));
+  }
+}
+
+TEST_CASE("FP16 round trip", "[Half precision]") {
+  std::vector<uint16_t> codes(1u << 16);
+  for (uint32_t i = 0; i < codes.size(); ++i) codes[i] = static_cast<uint16_t>(i);
+
+  /*--- All the codes, including the subnormals and infinities, decode exactly and encode back to themselves. ---*/
+  std::vector<float> decoded(codes.size());
+  FP16ToFloat(codes.data(), decoded.data(), codes.size());
+
+  for (uint32_t i = 0; i < codes.size(); ++i) {
+    const auto h = codes[i];
+    const float f = FP16ToFloatSoft(h);
+    if (IsNaN16(h, false)) {
+      REQUIRE(std::isnan(f));
+      REQUIRE(std::isnan(FP16ToFloat(h)));
+      REQUIRE(std::isnan(decoded[i]));
+      continue;
+    }
+    REQUIRE(FloatToFP16Soft(f) == h);
+    REQUIRE(FP16ToFloat(h) == f);
+    REQUIRE(decoded[i] == f);
+  }
+  CHECK(FP16ToFloatSoft(0x0001) == std::ldexp(1.0f, -24));
+  CHECK(FP16ToFloatSoft(0x03ff) == std::ldexp(1023.0f, -24));
+  CHECK(FP16ToFloatSoft(0x7bff) == 65504.0f);
+  CHECK(std::isinf(FP16ToFloatSoft(0xfc00)));
+}
+
+TEST_CASE("BF16 encoding and round trip", "[Half precision]") {
+  const float inf = std::numeric_limits<float>::infinity();
+
+  /*--- Ties to even, subnormal, overflow of the rounding, infinity. ---*/
+  const std::vector<std::pair<float, uint16_t>> cases = {
+      {1.0f, 0x3f80},
+      {-2.0f, 0xc000},
+      {1.0f + std::ldexp(1.0f, -8), 0x3f80},
+      {1.0f + 3 * std::ldexp(1.0f, -8), 0x3f82},
+      {1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20), 0x3f81},
+      {std::ldexp(1.0f, -130), 0x0008},
+      {std::numeric_limits<float>::max(), 0x7f80},
+      {-inf, 0xff80}};
+  for (const auto& c : cases) CHECK(FloatToBF16(c.first) == c.second);
+  CHECK(IsNaN16(FloatToBF16(std::numeric_limits<float>::quiet_NaN()), true));
+  CHECK(IsNaN16(FloatToBF16(std::numeric_limits<float>::signaling_NaN()), true));
+
+  for (uint32_t i = 0; i < (1u << 16); ++i) {
+    const auto h = static_cast<uint16_t>(i);
+    if (IsNaN16(h, true)) continue;
+    REQUIRE(FloatToBF16(BF16ToFloat(h)) == h);
+  }
+}
+
+TEST_CASE("Half precision block products", "[Half precision]") {
+  const unsigned long nBlk = 3, nRows = 5, nCols = 5;
+
+  for (const auto format : {PREC_STORAGE::FP16, PREC_STORAGE::BF16}) {
+    const double tol = (format == PREC_STORAGE::FP16) ? 2e-3 : 2e-2;
+
+    /*--- Entries spanning a few orders of magnitude, and a block of zeros. ---*/
+    std::vector<su2double> blocks(nBlk * nRows * nCols, 0.0), x(nCols), y(nRows), ref(nRows), get(nRows * nCols);
+    for (auto k = 0ul; k < 2 * nRows * nCols; ++k) blocks[k] = std::sin(k + 1.0) * std::pow(10.0, k % 4 - 1.0);
+    for (auto j = 0ul; j < nCols; ++j) x[j] = std::cos(j + 1.0);
+
+    CHalfBlockStorage storage;
+    storage.Initialize(nBlk, nRows, nCols, format);
+    for (auto iBlk = 0ul; iBlk < nBlk; ++iBlk) storage.Set(iBlk, &blocks[iBlk * nRows * nCols]);
+
+    for (auto iBlk = 0ul; iBlk < nBlk; ++iBlk) {
+      const auto* a = &blocks[iBlk * nRows * nCols];
+      double norm = 0;
+      for (auto i = 0ul; i < nRows; ++i) {
+        ref[i] = 0.0;
+        for (auto j = 0ul; j < nCols; ++j) {
+          ref[i] += a[i * nCols + j] * x[j];
+          norm = std::max(norm, std::abs(SU2_TYPE::GetValue(a[i * nCols + j] * x[j])));
+        }
+      }
+
+      storage.Get(iBlk, get.data());
+      for (auto k = 0ul; k < nRows * nCols; ++k) {
+        CHECK(SU2_TYPE::GetValue(get[k]) == Approx(SU2_TYPE::GetValue(a[k])).epsilon(tol / 4).margin(1e-12));
+      }
+
+      storage.MatVec(iBlk, x.data(), y.data());
+      for (auto i = 0ul; i < nRows; ++i) {
+        CHECK(SU2_TYPE::GetValue(y[i]) == Approx(SU2_TYPE::GetValue(ref[i])).margin(tol * nCols * norm + 1e-12));
+      }
+
+      storage.MatVecSub(iBlk, x.data(), y.data());
+      for (auto i = 0ul; i < nRows; ++i) CHECK(SU2_TYPE::GetValue(y[i]) == 0.0);
+    }
+  }
+}
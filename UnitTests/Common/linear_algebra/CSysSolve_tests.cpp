@@ -0,0 +1,173 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the Krylov solvers of CSysSolve.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+using Vector = CSysVector<su2double>;
+
+/*--- Block tridiagonal system of a 1D convection-diffusion problem with 2 coupled variables (non-symmetric). ---*/
+struct CTestSystem {
+  enum : unsigned long { nVar = 2 };
+  const unsigned long nBlk;
+  const su2double convection;
+
+  CTestSystem(unsigned long n, su2double c) : nBlk(n), convection(c) {}
+
+  /*--- Entry (iVar,jVar) of the block (iBlk,jBlk), with jBlk = iBlk + offset. ---*/
+  su2double Entry(int offset, unsigned long iVar, unsigned long jVar) const {
+    if (offset == 0) return (iVar == jVar) ? 4.0 : 0.5;
+    const su2double diffusion = (iVar == jVar) ? -1.0 : 0.0;
+    return diffusion + offset * convection * (iVar == jVar ? 1.0 : 0.2);
+  }
+
+  void Product(const Vector& u, Vector& v) const {
+    for (auto iBlk = 0ul; iBlk < nBlk; ++iBlk) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        su2double sum = 0.0;
+        for (int offset = -1; offset <= 1; ++offset) {
+          if ((iBlk == 0 && offset < 0) || (iBlk + 1 == nBlk && offset > 0)) continue;
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) sum += Entry(offset, iVar, jVar) * u(iBlk + offset, jVar);
+        }
+        v(iBlk, iVar) = sum;
+      }
+    }
+  }
+};
+
+class CTestProduct : public CMatrixVectorProduct<su2double> {
+  const CTestSystem& system;
+
+ public:
+  explicit CTestProduct(const CTestSystem& s) : system(s) {}
+  void operator()(const Vector& u, Vector& v) const override { system.Product(u, v); }
+};
+
+/*--- Inverse of the diagonal blocks (linear, as required by pipelined FGMRES). ---*/
+class CTestPreconditioner : public CPreconditioner<su2double> {
+  const CTestSystem& system;
+
+ public:
+  explicit CTestPreconditioner(const CTestSystem& s) : system(s) {}
+  void operator()(const Vector& u, Vector& v) const override {
+    const su2double a = system.Entry(0, 0, 0), b = system.Entry(0, 0, 1), det = a * a - b * b;
+    for (auto iBlk = 0ul; iBlk < system.nBlk; ++iBlk) {
+      v(iBlk, 0) = (a * u(iBlk, 0) - b * u(iBlk, 1)) / det;
+      v(iBlk, 1) = (a * u(iBlk, 1) - b * u(iBlk, 0)) / det;
+    }
+  }
+};
+
+su2double MaxError(const Vector& x, const Vector& ref) {
+  su2double error = 0.0;
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) error = std::max(error, std::abs(x[i] - ref[i]));
+  return error;
+}
+
+std::unique_ptr<CConfig> TestConfig() {
+  std::stringstream options;
+  options << "SOLVER= EULER" << std::endl;
+  options << "LINEAR_SOLVER_RECYCLE_SIZE= 6" << std::endl;
+  auto* orig = cout.rdbuf(nullptr);
+  std::unique_ptr<CConfig> config(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+  cout.rdbuf(orig);
+  return config;
+}
+}  // namespace
+
+TEST_CASE("Pipelined FGMRES and GCRO-DR match FGMRES", "[Linear solvers]") {
+  const auto config = TestConfig();
+  const unsigned long nBlk = 60, maxIter = 200;
+  const su2double tol = 1e-12;
+
+  for (const su2double convection : {0.0, 1.5}) {
+    const CTestSystem system(nBlk, convection);
+    const CTestProduct product(system);
+    const CTestPreconditioner precond(system);
+
+    /*--- Right hand side of a known solution. ---*/
+    Vector exact, b;
+    exact.Initialize(nBlk, nBlk, CTestSystem::nVar, 0.0);
+    b.Initialize(nBlk, nBlk, CTestSystem::nVar, 0.0);
+    for (auto i = 0ul; i < exact.GetLocSize(); ++i) exact[i] = std::sin(0.3 * i) + 0.1 * i / nBlk;
+    system.Product(exact, b);
+
+    CSysSolve<su2double> solver;
+    su2double residual = 0.0;
+
+    Vector xFGMRES(b), xPFGMRES(b), xGCRODR(b);
+    xFGMRES.SetValZero();
+    xPFGMRES.SetValZero();
+    xGCRODR.SetValZero();
+
+    const auto iterFGMRES =
+        solver.FGMRES_LinSolver(b, xFGMRES, product, precond, tol, maxIter, residual, false, config.get());
+    CHECK(SU2_TYPE::GetValue(MaxError(xFGMRES, exact)) < 1e-9);
+
+    const auto iterPFGMRES =
+        solver.PFGMRES_LinSolver(b, xPFGMRES, product, precond, tol, maxIter, residual, false, config.get());
+    CHECK(SU2_TYPE::GetValue(MaxError(xPFGMRES, xFGMRES)) < 1e-9);
+    CHECK(iterPFGMRES <= iterFGMRES + 2);
+
+    /*--- Without a recycled subspace yet, GCRO-DR is FGMRES. ---*/
+    const auto iterGCRODR =
+        solver.GCRODR_LinSolver(b, xGCRODR, product, precond, tol, maxIter, residual, false, config.get(), true);
+    CHECK(SU2_TYPE::GetValue(MaxError(xGCRODR, xFGMRES)) < 1e-9);
+    CHECK(iterGCRODR <= iterFGMRES + 2);
+
+    /*--- A second system with the same matrix uses the recycled subspace, it must not need more iterations. ---*/
+    for (auto i = 0ul; i < exact.GetLocSize(); ++i) exact[i] = std::cos(0.7 * i);
+    system.Product(exact, b);
+
+    xFGMRES.SetValZero();
+    xGCRODR.SetValZero();
+    const auto iterFGMRES2 =
+        solver.FGMRES_LinSolver(b, xFGMRES, product, precond, tol, maxIter, residual, false, config.get());
+    const auto iterGCRODR2 =
+        solver.GCRODR_LinSolver(b, xGCRODR, product, precond, tol, maxIter, residual, false, config.get(), false);
+    CHECK(SU2_TYPE::GetValue(MaxError(xFGMRES, exact)) < 1e-9);
+    CHECK(SU2_TYPE::GetValue(MaxError(xGCRODR, exact)) < 1e-9);
+    CHECK(iterGCRODR2 <= iterFGMRES2);
+
+    /*--- A different matrix, the image of the recycled subspace is recomputed. ---*/
+    const CTestSystem system2(nBlk, convection + 0.5);
+    const CTestProduct product2(system2);
+    const CTestPreconditioner precond2(system2);
+    system2.Product(exact, b);
+
+    xGCRODR.SetValZero();
+    solver.GCRODR_LinSolver(b, xGCRODR, product2, precond2, tol, maxIter, residual, false, config.get(), true);
+    CHECK(SU2_TYPE::GetValue(MaxError(xGCRODR, exact)) < 1e-9);
+  }
+}
@@ -0,0 +1,108 @@
+/*!
+ * \file blas_structure_tests.cpp
+ * \brief Unit tests for the dense matrix products of CBlasStructure.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <vector>
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+namespace {
+/*--- Sizes (M,N,K) of the products. Without BLAS, the columns of the row major C (N) are computed in tiles
+ * of 8 by the register-tiled microkernel, and the rows (M) in tiles of 4, hence sizes that are multiples of
+ * the tiles, sizes with every possible remainder, and degenerate sizes are tested. ---*/
+const int sizes[][3] = {{1, 1, 1}, {4, 8, 3}, {3, 5, 7}, {9, 13, 5}, {17, 16, 11}, {6, 24, 1}, {5, 9, 20}, {2, 31, 8}};
+
+std::vector<su2double> TestMatrix(int size, int seed) {
+  std::vector<su2double> x(size);
+  for (int i = 0; i < size; ++i) x[i] = std::sin(0.37 * (i + 1) + seed);
+  return x;
+}
+
+/*--- Naive row major product with padded (leading dimension) storage. ---*/
+void NaiveProduct(int M, int N, int K, const su2double* A, const su2double* B, su2double* C) {
+  for (int i = 0; i < M; ++i) {
+    for (int j = 0; j < N; ++j) {
+      su2double sum = 0.0;
+      for (int k = 0; k < K; ++k) sum += A[i * K + k] * B[k * N + j];
+      C[i * N + j] = sum;
+    }
+  }
+}
+}  // namespace
+
+TEST_CASE("Dense gemm", "[BLAS]") {
+  CBlasStructure blas;
+
+  for (const auto& size : sizes) {
+    const int M = size[0], N = size[1], K = size[2];
+
+    const auto A = TestMatrix(M * K, 1);
+    const auto B = TestMatrix(K * N, 2);
+    std::vector<su2double> ref(M * N), C(M * N, 1e3);
+
+    NaiveProduct(M, N, K, A.data(), B.data(), ref.data());
+    blas.gemm(M, N, K, A.data(), B.data(), C.data(), nullptr);
+
+    for (int i = 0; i < M * N; ++i) {
+      CHECK(SU2_TYPE::GetValue(C[i]) == Approx(SU2_TYPE::GetValue(ref[i])).margin(1e-13));
+    }
+  }
+}
+
+TEST_CASE("Strided batched gemm", "[BLAS]") {
+  CBlasStructure blas;
+  const int nBatch = 5;
+
+  for (const auto& size : sizes) {
+    const int M = size[0], N = size[1], K = size[2];
+
+    /*--- The matrices are padded, and A is shared by the batch (stride 0) or not. The result is initialized
+     * with garbage to check that it is overwritten and not accumulated. ---*/
+    const long strideB = K * N + 3, strideC = M * N + 5;
+
+    for (const long strideA : {0l, long(M * K + 1)}) {
+      const auto A = TestMatrix(strideA * (nBatch - 1) + M * K, 3);
+      const auto B = TestMatrix(strideB * nBatch, 4);
+      std::vector<su2double> C(strideC * nBatch, 1e3), ref(M * N);
+
+      blas.gemm_batched(M, N, K, nBatch, A.data(), strideA, B.data(), strideB, C.data(), strideC, nullptr);
+
+      for (int iBatch = 0; iBatch < nBatch; ++iBatch) {
+        NaiveProduct(M, N, K, &A[iBatch * strideA], &B[iBatch * strideB], ref.data());
+
+        for (int i = 0; i < M * N; ++i) {
+          CHECK(SU2_TYPE::GetValue(C[iBatch * strideC + i]) == Approx(SU2_TYPE::GetValue(ref[i])).margin(1e-13));
+        }
+        /*--- The padding is not modified. ---*/
+        if (iBatch + 1 < nBatch) {
+          for (long i = M * N; i < strideC; ++i) CHECK(SU2_TYPE::GetValue(C[iBatch * strideC + i]) == 1e3);
+        }
+      }
+    }
+  }
+}
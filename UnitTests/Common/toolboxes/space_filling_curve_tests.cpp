@@ -0,0 +1,82 @@
+/*!
+ * \file space_filling_curve_tests.cpp
+ * \brief Unit tests for the space filling curve keys of the geometry toolbox.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+namespace {
+/*--- Sort the points of a lattice with n^nDim points (stored in the most significant bits) by their key.
+ * Returns the number of pairs of consecutive points that are not face neighbors, and of repeated keys. ---*/
+template <class KeyFunc>
+std::pair<int, int> WalkLattice(int nDim, int n, int nBitsLattice, KeyFunc key) {
+  const int shift = 64 / nDim - nBitsLattice;
+  int nPoint = 1;
+  for (int iDim = 0; iDim < nDim; ++iDim) nPoint *= n;
+
+  std::vector<std::pair<uint64_t, std::vector<int>>> points;
+  for (int iPoint = 0; iPoint < nPoint; ++iPoint) {
+    std::vector<int> coord(nDim);
+    uint32_t intCoord[3] = {0, 0, 0};
+    for (int iDim = 0, rest = iPoint; iDim < nDim; ++iDim, rest /= n) {
+      coord[iDim] = rest % n;
+      intCoord[iDim] = uint32_t(coord[iDim]) << shift;
+    }
+    points.emplace_back(key(nDim, intCoord), coord);
+  }
+  std::sort(points.begin(), points.end());
+
+  int nJumps = 0, nRepeated = 0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    int dist = 0;
+    for (int iDim = 0; iDim < nDim; ++iDim) dist += std::abs(points[i].second[iDim] - points[i - 1].second[iDim]);
+    nJumps += (dist != 1);
+    nRepeated += (points[i].first == points[i - 1].first);
+  }
+  return {nJumps, nRepeated};
+}
+}  // namespace
+
+TEST_CASE("Space filling curves", "[Geometry Toolbox]") {
+  for (int nDim = 2; nDim <= 3; ++nDim) {
+    /*--- The Hilbert curve only moves between face neighbors. ---*/
+    const auto hilbert = WalkLattice(nDim, 8, 3, GeometryToolbox::HilbertKey<int>);
+    CHECK(hilbert.first == 0);
+    CHECK(hilbert.second == 0);
+
+    /*--- The Morton curve visits the 2x2(x2) blocks in order, all keys are unique. ---*/
+    const auto morton = WalkLattice(nDim, 8, 3, GeometryToolbox::MortonKey<int>);
+    CHECK(morton.second == 0);
+  }
+
+  /*--- The first coordinate is the most significant bit of each group. ---*/
+  const uint32_t coord[2] = {1, 0};
+  CHECK(GeometryToolbox::MortonKey(2, coord) == 2);
+}
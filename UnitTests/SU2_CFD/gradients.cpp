@@ -154,3 +154,41 @@ TEST_CASE("GG", "[Gradients]") { testGreenGauss<LinearFunction>(); }
 TEST_CASE("LS", "[Gradients]") { testLeastSquares<LinearFunction>(false); }
 
 TEST_CASE("WLS", "[Gradients]") { testLeastSquares<LinearFunction>(true); }
+
+template <class TestField>
+void testFusedMinMax(bool greenGauss) {
+  TestField field;
+  const auto nPoint = field.geometry->GetnPoint();
+  const auto nDim = field.geometry->GetnDim();
+  C3DDoubleMatrix R(nPoint, nDim, nDim);
+  C3DDoubleMatrix gradient(nPoint, field.nVar, nDim);
+  su2activematrix fieldMin(nPoint, field.nVar), fieldMax(nPoint, field.nVar);
+
+  if (greenGauss) {
+    computeGradientsGreenGauss(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, *field.geometry.get(),
+                               *field.config.get(), field, 0, field.nVar, -1, gradient, &fieldMin, &fieldMax);
+  } else {
+    computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, *field.geometry.get(),
+                                 *field.config.get(), true, field, 0, field.nVar, -1, gradient, R, &fieldMin,
+                                 &fieldMax);
+  }
+  check(field, gradient);
+
+  /*--- The min/max must match a separate pass over the neighbors. ---*/
+  su2double err = 0.0;
+  for (auto iPoint = 0ul; iPoint < field.geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < field.nVar; ++iVar) {
+      su2double refMin = field(iPoint, iVar), refMax = refMin;
+      for (auto jPoint : field.geometry->nodes->GetPoints(iPoint)) {
+        refMin = min(refMin, field(jPoint, iVar));
+        refMax = max(refMax, field(jPoint, iVar));
+      }
+      err = max(err, abs(fieldMin(iPoint, iVar) - refMin) + abs(fieldMax(iPoint, iVar) - refMax));
+    }
+  }
+  CHECK(err == 0.0);
+}
+
+TEST_CASE("GG fused min/max", "[Gradients]") { testFusedMinMax<LinearFunction>(true); }
+
+TEST_CASE("WLS fused min/max", "[Gradients]") { testFusedMinMax<LinearFunction>(false); }
@@ -0,0 +1,183 @@
+/*!
+ * \file CFEAElementBatch_tests.cpp
+ * \brief Unit tests for the tangent matrix of batches of finite elements.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/geometry/elements/CElement.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/nonlinear_models.hpp"
+
+namespace {
+/*--- Results of the scalar (one element at a time) integration. ---*/
+struct CElementResults {
+  std::vector<su2double> Kab, Ks_ab, Kt_a;
+
+  CElementResults(const CElement& element, unsigned short nDim) {
+    const auto nNode = element.GetnNodes();
+    for (unsigned short a = 0; a < nNode; ++a) {
+      for (unsigned short b = 0; b < nNode; ++b) {
+        for (unsigned short k = 0; k < nDim * nDim; ++k) Kab.push_back(element.Get_Kab(a, b)[k]);
+        Ks_ab.push_back(element.Get_Ks_ab(a, b));
+      }
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) Kt_a.push_back(element.Get_Kt_a(a)[iDim]);
+    }
+  }
+};
+
+su2double MaxAbs(const std::vector<su2double>& x) {
+  su2double m = 0.0;
+  for (const auto& v : x) m = std::max(m, std::abs(v));
+  return m;
+}
+
+/*--- Compare a lane of the batch with the scalar results, relative to the largest entry of each term. ---*/
+void CheckLane(const CFEAElementBatch& batch, size_t iLane, const CElementResults& ref, unsigned short nNode,
+               unsigned short nDim) {
+  const auto lane = batch.GetLane(iLane);
+  const su2double tolKab = 1e-12 * MaxAbs(ref.Kab), tolKs = 1e-12 * MaxAbs(ref.Ks_ab) + 1e-14;
+  const su2double tolKt = 1e-12 * MaxAbs(ref.Kt_a) + 1e-14;
+
+  for (unsigned short a = 0; a < nNode; ++a) {
+    for (unsigned short b = 0; b < nNode; ++b) {
+      const auto ab = a * nNode + b;
+      for (unsigned short k = 0; k < nDim * nDim; ++k) {
+        CHECK(SU2_TYPE::GetValue(lane.Get_Kab(a, b)[k]) ==
+              Approx(SU2_TYPE::GetValue(ref.Kab[ab * nDim * nDim + k])).margin(SU2_TYPE::GetValue(tolKab)));
+      }
+      CHECK(SU2_TYPE::GetValue(lane.Get_Ks_ab(a, b)) ==
+            Approx(SU2_TYPE::GetValue(ref.Ks_ab[ab])).margin(SU2_TYPE::GetValue(tolKs)));
+    }
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      CHECK(SU2_TYPE::GetValue(lane.Get_Kt_a(a)[iDim]) ==
+            Approx(SU2_TYPE::GetValue(ref.Kt_a[a * nDim + iDim])).margin(SU2_TYPE::GetValue(tolKt)));
+    }
+  }
+}
+
+/*--- Nodes of the standard elements, with nDim = 3 the third coordinate is used. ---*/
+const su2double* ParentNode(unsigned short nDim, unsigned short nNode, unsigned short iNode) {
+  static const su2double tria[3][3] = {{0, 0}, {1, 0}, {0, 1}};
+  static const su2double quad[4][3] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+  static const su2double tetra[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+  static const su2double pyram[5][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0.5, 0.5, 1}};
+  static const su2double prism[6][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {0, 1, 1}};
+  static const su2double hexa[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+                                       {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+  if (nDim == 2) return (nNode == 3) ? tria[iNode] : quad[iNode];
+  switch (nNode) {
+    case 4: return tetra[iNode];
+    case 5: return pyram[iNode];
+    case 6: return prism[iNode];
+    default: return hexa[iNode];
+  }
+}
+
+/*--- Distorted and deformed element, different for each seed. ---*/
+void SetCoordinates(CElement& element, unsigned short nDim, int seed) {
+  const auto nNode = element.GetnNodes();
+  for (unsigned short iNode = 0; iNode < nNode; ++iNode) {
+    const auto* x = ParentNode(nDim, nNode, iNode);
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const su2double ref = x[iDim] + 0.1 * std::sin(1.3 * seed + 2.1 * iNode + 0.7 * iDim);
+      element.SetRef_Coord(iNode, iDim, ref);
+      element.SetCurr_Coord(iNode, iDim, ref + 0.05 * std::cos(0.9 * seed + 1.7 * iNode + 1.1 * iDim));
+    }
+  }
+}
+
+std::unique_ptr<CConfig> ElasticityConfig(bool planeStress) {
+  std::stringstream options;
+  options << "SOLVER= ELASTICITY\n"
+          << "ELASTICITY_MODULUS= 2.0e5\n"
+          << "POISSON_RATIO= 0.3\n"
+          << "FORMULATION_ELASTICITY_2D= " << (planeStress ? "PLANE_STRESS" : "PLANE_STRAIN") << "\n";
+  auto* orig = cout.rdbuf(nullptr);
+  std::unique_ptr<CConfig> config(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+  cout.rdbuf(orig);
+  return config;
+}
+}  // namespace
+
+TEST_CASE("Batched tangent matrix matches the scalar one", "[FEA element batch]") {
+  constexpr size_t SIZE = CFEAElementBatch::SIZE;
+
+  for (const unsigned short nDim : {2, 3}) {
+    for (const bool planeStress : {false, true}) {
+      if (nDim == 3 && planeStress) continue;
+      const auto config = ElasticityConfig(planeStress);
+
+      std::unique_ptr<CNumerics> linear(new CFEALinearElasticity(nDim, nDim, config.get()));
+      std::unique_ptr<CNumerics> neoHookean(new CFEM_NeoHookean_Comp(nDim, nDim, config.get()));
+
+      std::vector<std::unique_ptr<CElement>> elements;
+      if (nDim == 2) {
+        elements.emplace_back(new CTRIA1());
+        elements.emplace_back(new CQUAD4());
+      } else {
+        elements.emplace_back(new CTETRA1());
+        elements.emplace_back(new CPYRAM5());
+        elements.emplace_back(new CPRISM6());
+        elements.emplace_back(new CHEXA8());
+      }
+
+      for (auto* numerics : {linear.get(), neoHookean.get()}) {
+        /*--- Only the nonlinear plane stress model is not vectorized. ---*/
+        const bool supported = numerics->Supports_Tangent_Batch(config.get());
+        CHECK(supported == !(numerics == neoHookean.get() && nDim == 2 && planeStress));
+        if (!supported) continue;
+
+        for (auto& element : elements) {
+          const auto nNode = element->GetnNodes();
+
+          /*--- Full batches, and partial ones whose unused lanes are padded. ---*/
+          for (const size_t nLanes : {SIZE, (SIZE + 1) / 2, size_t(1)}) {
+            CAPTURE(nDim, planeStress, nNode, nLanes);
+
+            CFEAElementBatch batch;
+            std::vector<CElementResults> scalar;
+            for (size_t iLane = 0; iLane < nLanes; ++iLane) {
+              SetCoordinates(*element, nDim, iLane + nNode);
+              numerics->Compute_Tangent_Matrix(element.get(), config.get());
+              scalar.emplace_back(*element, nDim);
+              numerics->Set_Batch_Element(batch, iLane, element.get(), config.get());
+            }
+            batch.PadLanes(nLanes);
+            numerics->Compute_Tangent_Matrix_Batch(batch, config.get());
+
+            for (size_t iLane = 0; iLane < nLanes; ++iLane) CheckLane(batch, iLane, scalar[iLane], nNode, nDim);
+
+            /*--- The padded lanes repeat the first element. ---*/
+            for (size_t iLane = nLanes; iLane < SIZE; ++iLane) CheckLane(batch, iLane, scalar[0], nNode, nDim);
+          }
+        }
+      }
+    }
+  }
+}
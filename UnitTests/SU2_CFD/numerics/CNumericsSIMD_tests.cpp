@@ -0,0 +1,249 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Unit tests for the vectorized upwind schemes of the flow solver.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#include "../../../SU2_CFD/include/solvers/CEulerSolver.hpp"
+#include "../../../SU2_CFD/include/variables/CEulerVariable.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+
+namespace {
+using Vector = CSysVector<su2double>;
+using MixedVector = CSysVector<su2mixedfloat>;
+
+/*--- Euler problem on a small box (or rectangle), in a non-uniform state. ---*/
+struct CFlowProblem {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSolver** solvers = nullptr;
+
+  CFlowProblem(unsigned short nDim, const std::string& scheme, bool muscl, passivedouble mach, bool accurateJacobians) {
+    std::stringstream options;
+    options << "SOLVER= EULER\n"
+            << "MESH_FORMAT= " << (nDim == 2 ? "RECTANGLE" : "BOX") << "\n"
+            << "MESH_BOX_SIZE= 6,5,4\n"
+            << "MESH_BOX_LENGTH= 1,0.5,0.5\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "MARKER_EULER= (y_minus)\n"
+            << "MARKER_FAR= (x_minus, x_plus, y_plus" << (nDim == 2 ? "" : ", z_minus, z_plus") << ")\n"
+            << "MACH_NUMBER= " << mach << "\n"
+            << "AOA= 5\n"
+            << "CONV_NUM_METHOD_FLOW= " << scheme << "\n"
+            << "MUSCL_FLOW= " << (muscl ? "YES" : "NO") << "\n"
+            << "SLOPE_LIMITER_FLOW= NONE\n"
+            << "USE_ACCURATE_FLUX_JACOBIANS= " << (accurateJacobians ? "YES" : "NO") << "\n";
+
+    auto* orig = cout.rdbuf(nullptr);
+    config.reset(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+    {
+      std::unique_ptr<CGeometry> aux(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry.reset(new CPhysicalGeometry(aux.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    solvers = CSolverFactory::CreateSolverContainer(MAIN_SOLVER::EULER, config.get(), geometry.get(), MESH_0);
+    cout.rdbuf(orig);
+  }
+
+  ~CFlowProblem() {
+    delete solvers[FLOW_SOL];
+    delete[] solvers;
+  }
+
+  /*--- Perturb the free-stream state, and update the primitives and their gradients. ---*/
+  void SetState() {
+    auto* nodes = solvers[FLOW_SOL]->GetNodes();
+    const auto nDim = geometry->GetnDim();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto* x = geometry->nodes->GetCoord(iPoint);
+      const su2double phase = 3 * x[0] + 5 * x[1] + (nDim == 3 ? 7 * x[2] : 0.0);
+
+      const su2double momentum = nodes->GetSolution(iPoint, 1);
+      for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar) {
+        nodes->SetSolution(iPoint, iVar, nodes->GetSolution(iPoint, iVar) * (1 + 0.05 * std::sin(phase + iVar)));
+      }
+      for (auto iDim = 1ul; iDim < nDim; ++iDim) {
+        nodes->AddSolution(iPoint, iDim + 1, 0.2 * momentum * std::cos(phase + iDim));
+      }
+    }
+
+    auto* orig = cout.rdbuf(nullptr);
+    solvers[FLOW_SOL]->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    cout.rdbuf(orig);
+  }
+
+  /*--- Residual and product of the Jacobian with u of the scalar numerics, assembled as in the scalar path of
+   * CEulerSolver::Upwind_Residual (the states are physical, the reconstruction is never reverted). ---*/
+  void ScalarResidual(CNumerics& numerics, const MixedVector& u, Vector& residual, Vector& product) {
+    auto* nodes = static_cast<CEulerVariable*>(solvers[FLOW_SOL]->GetNodes());
+    const auto nDim = geometry->GetnDim();
+    const auto nVar = solvers[FLOW_SOL]->GetnVar();
+    const auto nPrimVarGrad = nDim + 4;
+    const bool muscl = config->GetMUSCL_Flow();
+
+    residual.SetValZero();
+    product.SetValZero();
+
+    /*--- Only the first nPrimVarGrad primitives are reconstructed. ---*/
+    std::vector<su2double> Primitive_i(solvers[FLOW_SOL]->GetnPrimVar(), 0.0), Primitive_j(Primitive_i);
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      numerics.SetNormal(geometry->edges->GetNormal(iEdge));
+
+      auto* V_i = nodes->GetPrimitive(iPoint);
+      auto* V_j = nodes->GetPrimitive(jPoint);
+
+      if (muscl) {
+        const auto* Coord_i = geometry->nodes->GetCoord(iPoint);
+        const auto* Coord_j = geometry->nodes->GetCoord(jPoint);
+        const auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+        const auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+        for (auto iVar = 0ul; iVar < nPrimVarGrad; ++iVar) {
+          Primitive_i[iVar] = V_i[iVar];
+          Primitive_j[iVar] = V_j[iVar];
+          for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+            const su2double dist = 0.5 * (Coord_j[iDim] - Coord_i[iDim]);
+            Primitive_i[iVar] += dist * Gradient_i[iVar][iDim];
+            Primitive_j[iVar] -= dist * Gradient_j[iVar][iDim];
+          }
+        }
+        V_i = Primitive_i.data();
+        V_j = Primitive_j.data();
+      }
+      numerics.SetPrimitive(V_i, V_j);
+
+      const auto res = numerics.ComputeResidual(config.get());
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        residual(iPoint, iVar) += res.residual[iVar];
+        residual(jPoint, iVar) -= res.residual[iVar];
+
+        su2double jacProduct = 0.0;
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          jacProduct += res.jacobian_i[iVar][jVar] * u(iPoint, jVar) + res.jacobian_j[iVar][jVar] * u(jPoint, jVar);
+        }
+        product(iPoint, iVar) += jacProduct;
+        product(jPoint, iVar) -= jacProduct;
+      }
+    }
+  }
+};
+
+template <class Vector>
+su2double MaxAbs(const Vector& x, unsigned long n) {
+  su2double m = 0.0;
+  for (auto i = 0ul; i < n; ++i) m = std::max<su2double>(m, std::abs(x[i]));
+  return m;
+}
+
+template <class VectorA, class VectorB>
+void CheckVectors(const VectorA& vectorized, const VectorB& scalar, unsigned long n, passivedouble tol) {
+  const passivedouble margin = tol * SU2_TYPE::GetValue(MaxAbs(scalar, n));
+  REQUIRE(margin > 0.0);
+  for (auto i = 0ul; i < n; ++i) {
+    CHECK(SU2_TYPE::GetValue(vectorized[i]) == Approx(SU2_TYPE::GetValue(scalar[i])).epsilon(0.0).margin(margin));
+  }
+}
+
+std::unique_ptr<CNumerics> ScalarNumerics(const std::string& scheme, unsigned short nDim, unsigned short nVar,
+                                          const CConfig* config) {
+  if (scheme == "HLLC") return std::unique_ptr<CNumerics>(new CUpwHLLC_Flow(nDim, nVar, config));
+  if (scheme == "AUSMPLUSUP") return std::unique_ptr<CNumerics>(new CUpwAUSMPLUSUP_Flow(nDim, nVar, config));
+  if (scheme == "SLAU") return std::unique_ptr<CNumerics>(new CUpwSLAU_Flow(nDim, nVar, config, false));
+  return std::unique_ptr<CNumerics>(new CUpwSLAU2_Flow(nDim, nVar, config, false));
+}
+}  // namespace
+
+TEST_CASE("Vectorized upwind schemes match the scalar ones", "[Upwind SIMD]") {
+  for (const unsigned short nDim : {2, 3}) {
+    for (const std::string scheme : {"HLLC", "AUSMPLUSUP", "SLAU", "SLAU2"}) {
+      for (const bool muscl : {false, true}) {
+        /*--- Subsonic and supersonic free-streams, the latter has supersonic faces for HLLC. ---*/
+        for (const passivedouble mach : {0.3, 1.5}) {
+          /*--- The AUSM-type schemes have two kinds of Jacobians. ---*/
+          for (const bool accurateJacobians : {false, true}) {
+            if (accurateJacobians && scheme == "HLLC") continue;
+            CAPTURE(nDim, scheme, muscl, mach, accurateJacobians);
+
+            CFlowProblem problem(nDim, scheme, muscl, mach, accurateJacobians);
+            problem.SetState();
+
+            auto* solver = problem.solvers[FLOW_SOL];
+            const auto nPoint = problem.geometry->GetnPoint();
+            const auto nPointDomain = problem.geometry->GetnPointDomain();
+            const auto nVar = solver->GetnVar();
+            const auto n = nPointDomain * nVar;
+
+            /*--- Product with the Jacobian, to compare the matrices. ---*/
+            MixedVector u(nPoint, nPointDomain, nVar, 0.0), productVectorized(u);
+            for (auto i = 0ul; i < u.GetLocSize(); ++i) u[i] = std::cos(0.37 * i) + 0.5;
+
+            /*--- The flow solver always uses the vectorized path for these schemes. ---*/
+            solver->LinSysRes.SetValZero();
+            solver->Jacobian.SetValZero();
+            solver->Upwind_Residual(problem.geometry.get(), problem.solvers, nullptr, problem.config.get(), MESH_0);
+            solver->Jacobian.MatrixVectorProduct(u, productVectorized, problem.geometry.get(), problem.config.get());
+
+            auto numerics = ScalarNumerics(scheme, nDim, nVar, problem.config.get());
+            Vector residual(nPoint, nPointDomain, nVar, 0.0), productScalar(residual);
+            problem.ScalarResidual(*numerics, u, residual, productScalar);
+
+            CheckVectors(solver->LinSysRes, residual, n, 1e-10);
+
+            /*--- The accurate Jacobians of SLAU are finite differences, which amplify the rounding differences. ---*/
+            const bool finiteDifferences = accurateJacobians && scheme != "AUSMPLUSUP";
+            CheckVectors(productVectorized, productScalar, n, finiteDifferences ? 2e-6 : 1e-8);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+/*!
+ * \file CFileWriter_tests.cpp
+ * \brief Unit tests for the aggregated and asynchronous binary writes of CFileWriter.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../../../SU2_CFD/include/output/filewriter/CFileWriter.hpp"
+
+namespace {
+/*--- Writes a header (master only) followed by one block of data per rank, like the binary restart. ---*/
+class CTestFileWriter : public CFileWriter {
+ public:
+  CTestFileWriter() : CFileWriter(".bin") {}
+
+  void Write(const std::string& name, const std::vector<char>& data, unsigned long nAggregators, bool async) {
+    const unsigned long localSize = data.size();
+    std::vector<unsigned long> sizes(size);
+    SU2_MPI::Allgather(&localSize, 1, MPI_UNSIGNED_LONG, sizes.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    unsigned long offset = 0, totalSize = 0;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank < rank) offset += sizes[iRank];
+      totalSize += sizes[iRank];
+    }
+
+    OpenMPIFile(name, async);
+    const char header[] = "header";
+    WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+    WriteAggregatedBinaryDataAll(data.data(), localSize, totalSize, offset, nAggregators, async);
+    CloseMPIFile();
+  }
+};
+
+/*--- The data of a rank depends on the rank and on a version number. ---*/
+std::vector<char> RankData(int version) {
+  const int rank = SU2_MPI::GetRank();
+  std::vector<char> data(1000 + 7 * rank);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i * (rank + 3) + version);
+  return data;
+}
+
+/*--- What the file should contain. ---*/
+std::vector<char> ExpectedFile(int version) {
+  const char header[] = "header";
+  std::vector<char> file(header, header + sizeof(header));
+  for (int iRank = 0; iRank < SU2_MPI::GetSize(); ++iRank) {
+    for (size_t i = 0; i < 1000u + 7 * iRank; ++i) file.push_back(static_cast<char>(i * (iRank + 3) + version));
+  }
+  return file;
+}
+
+std::vector<char> ReadFile(const std::string& name) {
+  std::ifstream file(name, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool FileExists(const std::string& name) { return std::ifstream(name).good(); }
+}  // namespace
+
+TEST_CASE("Aggregated and asynchronous binary writes", "[File writer]") {
+  const std::string name = "file_writer_test";
+  const auto data = RankData(0);
+  const auto expected = ExpectedFile(0);
+
+  for (unsigned long nAggregators : {0ul, 1ul, 2ul}) {
+    for (bool async : {false, true}) {
+      CTestFileWriter writer;
+      writer.Write(name, data, nAggregators, async);
+      CFileWriter::WaitPendingWrites();
+      SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+      CHECK(ReadFile(name + ".bin") == expected);
+      CHECK_FALSE(FileExists(name + ".bin.tmp"));
+      SU2_MPI::Barrier(SU2_MPI::GetComm());
+    }
+  }
+  if (SU2_MPI::GetRank() == MASTER_NODE) std::remove((name + ".bin").c_str());
+}
+
+TEST_CASE("Asynchronous writes keep the previous file", "[File writer]") {
+  const std::string name = "file_writer_async_test";
+
+  CTestFileWriter writer;
+  writer.Write(name, RankData(1), 0, false);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  /*--- The new file is written to a temporary file, which only replaces the previous one once complete. ---*/
+  writer.Write(name, RankData(2), 0, true);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  CHECK(ReadFile(name + ".bin") == ExpectedFile(1));
+
+  CFileWriter::WaitPendingWrites();
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  CHECK(ReadFile(name + ".bin") == ExpectedFile(2));
+  CHECK_FALSE(FileExists(name + ".bin.tmp"));
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) std::remove((name + ".bin").c_str());
+}
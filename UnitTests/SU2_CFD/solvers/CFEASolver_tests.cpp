@@ -0,0 +1,151 @@
+/*!
+ * \file CFEASolver_tests.cpp
+ * \brief Unit tests for the matrix-free tangent operator of CFEASolver.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/solvers/CFEASolver.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/nonlinear_models.hpp"
+
+namespace {
+/*--- Structural problem on a small box of hexahedra. ---*/
+struct CBoxFEAProblem {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  std::unique_ptr<CFEASolver> solver;
+  std::vector<CNumerics*> numerics;
+
+  CBoxFEAProblem(bool nonlinear, bool matrixFree) {
+    std::stringstream options;
+    options << "SOLVER= ELASTICITY\n"
+            << "MESH_FORMAT= BOX\n"
+            << "MESH_BOX_SIZE= 4,3,3\n"
+            << "MESH_BOX_LENGTH= 2,1,1\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "MARKER_CLAMPED= ( x_minus, x_plus, y_minus, y_plus, z_minus, z_plus )\n"
+            << "ELASTICITY_MODULUS= 1000\n"
+            << "POISSON_RATIO= 0.3\n"
+            << "GEOMETRIC_CONDITIONS= " << (nonlinear ? "LARGE_DEFORMATIONS" : "SMALL_DEFORMATIONS") << "\n"
+            << "MATERIAL_MODEL= " << (nonlinear ? "NEO_HOOKEAN" : "LINEAR_ELASTIC") << "\n"
+            << "FEA_MATRIX_FREE= " << (matrixFree ? "YES" : "NO") << "\n";
+
+    auto* orig = cout.rdbuf(nullptr);
+    config.reset(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+    {
+      std::unique_ptr<CGeometry> aux(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry.reset(new CPhysicalGeometry(aux.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->SetVertex(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    solver.reset(new CFEASolver(geometry.get(), config.get()));
+
+    const auto nDim = geometry->GetnDim();
+    numerics.assign(MAX_TERMS * omp_get_max_threads(), nullptr);
+    for (int thread = 0; thread < omp_get_max_threads(); ++thread) {
+      auto& fea = numerics[FEA_TERM + thread * MAX_TERMS];
+      if (nonlinear)
+        fea = new CFEM_NeoHookean_Comp(nDim, nDim, config.get());
+      else
+        fea = new CFEALinearElasticity(nDim, nDim, config.get());
+    }
+    cout.rdbuf(orig);
+  }
+
+  ~CBoxFEAProblem() {
+    for (auto* n : numerics) delete n;
+  }
+
+  /*--- Deform the box, so that the tangent of the nonlinear model depends on the solution. ---*/
+  void SetDisplacement() {
+    auto* nodes = solver->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto* coord = geometry->nodes->GetCoord(iPoint);
+      for (auto iDim = 0u; iDim < geometry->GetnDim(); ++iDim) {
+        nodes->SetSolution(iPoint, iDim, 0.05 * std::sin(1.0 + coord[0] + 2 * coord[1] * (iDim + 1) + 3 * coord[2]));
+      }
+    }
+  }
+
+  /*--- Assemble the tangent, in matrix-free mode only its diagonal blocks. ---*/
+  void ComputeTangent(bool nonlinear) {
+    auto* orig = cout.rdbuf(nullptr);
+    solver->Preprocessing(geometry.get(), nullptr, config.get(), numerics.data(), MESH_0, 0, RUNTIME_FEA_SYS, false);
+    if (nonlinear)
+      solver->Compute_StiffMatrix_NodalStressRes(geometry.get(), numerics.data(), config.get());
+    else
+      solver->Compute_StiffMatrix(geometry.get(), numerics.data(), config.get());
+    cout.rdbuf(orig);
+  }
+};
+}  // namespace
+
+TEST_CASE("Matrix-free FEA product matches the assembled tangent", "[FEA matrix-free]") {
+  using Scalar = CFEASolver::MatrixFreeScalar;
+
+  for (const bool nonlinear : {false, true}) {
+    CBoxFEAProblem assembled(nonlinear, false);
+    CBoxFEAProblem matrixFree(nonlinear, true);
+
+    if (nonlinear) {
+      assembled.SetDisplacement();
+      matrixFree.SetDisplacement();
+    }
+    assembled.ComputeTangent(nonlinear);
+    matrixFree.ComputeTangent(nonlinear);
+
+    const auto nPoint = assembled.geometry->GetnPoint();
+    const auto nPointDomain = assembled.geometry->GetnPointDomain();
+    const auto nVar = assembled.geometry->GetnDim();
+
+    CSysVector<Scalar> u(nPoint, nPointDomain, nVar, 0.0), vAssembled(u), vMatrixFree(u);
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) u[i] = std::cos(0.37 * i) + 0.5;
+
+    assembled.solver->Jacobian.MatrixVectorProduct(u, vAssembled, assembled.geometry.get(), assembled.config.get());
+    matrixFree.solver->MatrixFreeProduct(matrixFree.geometry.get(), matrixFree.config.get(), u, vMatrixFree, false);
+
+    Scalar maxAbs = 0.0;
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) maxAbs = std::max(maxAbs, std::abs(vAssembled[i]));
+    REQUIRE(maxAbs > 0.0);
+
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) {
+      CHECK(SU2_TYPE::GetValue(vMatrixFree[i]) ==
+            Approx(SU2_TYPE::GetValue(vAssembled[i])).margin(1e-5 * SU2_TYPE::GetValue(maxAbs)));
+    }
+  }
+}
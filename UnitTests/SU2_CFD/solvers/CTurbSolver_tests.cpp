@@ -0,0 +1,216 @@
+/*!
+ * \file CTurbSolver_tests.cpp
+ * \brief Unit tests for the vectorized residuals of the turbulence solvers.
+ * \author SU2 Contributors
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSolver.hpp"
+#include "../../../SU2_CFD/include/variables/CEulerVariable.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+
+namespace {
+using Indices = CEulerVariable::CIndices<unsigned short>;
+
+/*--- RANS problem on a small box (or rectangle) with a wall, in a non-uniform state. ---*/
+struct CTurbProblem {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSolver** solvers = nullptr;
+  std::vector<CNumerics*> numerics;
+
+  CTurbProblem(unsigned short nDim, const std::string& model, bool vectorize) {
+    std::stringstream options;
+    options << "SOLVER= RANS\n"
+            << "KIND_TURB_MODEL= " << model << "\n"
+            << "MESH_FORMAT= " << (nDim == 2 ? "RECTANGLE" : "BOX") << "\n"
+            << "MESH_BOX_SIZE= 6,5,4\n"
+            << "MESH_BOX_LENGTH= 1,0.5,0.5\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "MARKER_HEATFLUX= (y_minus, 0.0)\n"
+            << "MARKER_FAR= (x_minus, x_plus, y_plus" << (nDim == 2 ? "" : ", z_minus, z_plus") << ")\n"
+            << "MACH_NUMBER= 0.3\n"
+            << "REYNOLDS_NUMBER= 1e4\n"
+            << "MUSCL_FLOW= YES\n"
+            << "MUSCL_TURB= YES\n"
+            << "USE_VECTORIZATION= " << (vectorize ? "YES" : "NO") << "\n";
+
+    auto* orig = cout.rdbuf(nullptr);
+    config.reset(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+    {
+      std::unique_ptr<CGeometry> aux(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry.reset(new CPhysicalGeometry(aux.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    /*--- The wall is at y = 0, the points on it have no source. ---*/
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      geometry->nodes->SetWall_Distance(iPoint, geometry->nodes->GetCoord(iPoint, 1));
+    }
+
+    solvers = CSolverFactory::CreateSolverContainer(MAIN_SOLVER::RANS, config.get(), geometry.get(), MESH_0);
+
+    /*--- The scalar numerics, as created by the driver. ---*/
+    const auto* turbSolver = solvers[TURB_SOL];
+    const auto nVar = turbSolver->GetnVar();
+    numerics.assign(MAX_TERMS * omp_get_max_threads(), nullptr);
+    for (int thread = 0; thread < omp_get_max_threads(); ++thread) {
+      auto* terms = &numerics[thread * MAX_TERMS];
+      if (model == "SA") {
+        terms[CONV_TERM] = new CUpwSca_TurbSA<Indices>(nDim, nVar, config.get());
+        terms[VISC_TERM] = new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config.get());
+        terms[SOURCE_FIRST_TERM] = SAFactory<Indices>(nDim, config.get());
+      } else {
+        const auto* constants = turbSolver->GetConstants();
+        terms[CONV_TERM] = new CUpwSca_TurbSST<Indices>(nDim, nVar, config.get());
+        terms[VISC_TERM] = new CAvgGrad_TurbSST<Indices>(nDim, nVar, constants, true, config.get());
+        terms[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSST<Indices>(
+            nDim, nVar, constants, turbSolver->GetTke_Inf(), turbSolver->GetOmega_Inf(), config.get());
+      }
+      terms[SOURCE_SECOND_TERM] = new CSourceNothing(nDim, nVar, config.get());
+    }
+    cout.rdbuf(orig);
+  }
+
+  ~CTurbProblem() {
+    for (auto* n : numerics) delete n;
+    delete solvers[TURB_SOL];
+    delete solvers[FLOW_SOL];
+    delete[] solvers;
+  }
+
+  /*--- Perturb the free-stream state, and update the primitives, gradients and eddy viscosity. ---*/
+  void SetState() {
+    auto* flowNodes = solvers[FLOW_SOL]->GetNodes();
+    auto* turbNodes = solvers[TURB_SOL]->GetNodes();
+    const auto nDim = geometry->GetnDim();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto* x = geometry->nodes->GetCoord(iPoint);
+      const su2double phase = 3 * x[0] + 5 * x[1] + (nDim == 3 ? 7 * x[2] : 0.0);
+
+      const su2double momentum = flowNodes->GetSolution(iPoint, 1);
+      for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar) {
+        flowNodes->SetSolution(iPoint, iVar, flowNodes->GetSolution(iPoint, iVar) * (1 + 0.05 * std::sin(phase + iVar)));
+      }
+      for (auto iDim = 1ul; iDim < nDim; ++iDim) {
+        flowNodes->AddSolution(iPoint, iDim + 1, 0.1 * momentum * std::cos(phase + iDim));
+      }
+      for (auto iVar = 0ul; iVar < solvers[TURB_SOL]->GetnVar(); ++iVar) {
+        turbNodes->SetSolution(iPoint, iVar, turbNodes->GetSolution(iPoint, iVar) * (1 + 0.3 * std::sin(2 * phase + iVar)));
+      }
+    }
+
+    auto* orig = cout.rdbuf(nullptr);
+    solvers[FLOW_SOL]->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    solvers[TURB_SOL]->Postprocessing(geometry.get(), solvers, config.get(), MESH_0);
+    solvers[FLOW_SOL]->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    solvers[TURB_SOL]->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, 0, RUNTIME_TURB_SYS, false);
+    cout.rdbuf(orig);
+  }
+
+  void ComputeResiduals(bool sources) {
+    auto* turbSolver = solvers[TURB_SOL];
+    turbSolver->LinSysRes.SetValZero();
+    turbSolver->Jacobian.SetValZero();
+    if (sources)
+      turbSolver->Source_Residual(geometry.get(), solvers, numerics.data(), config.get(), MESH_0);
+    else
+      turbSolver->Upwind_Residual(geometry.get(), solvers, numerics.data(), config.get(), MESH_0);
+  }
+};
+
+template <class Vector>
+su2double MaxAbs(const Vector& x, unsigned long n) {
+  su2double m = 0.0;
+  for (auto i = 0ul; i < n; ++i) m = std::max<su2double>(m, std::abs(x[i]));
+  return m;
+}
+
+template <class Vector>
+void CheckVectors(const Vector& vectorized, const Vector& scalar, unsigned long n, passivedouble tol) {
+  const passivedouble margin = tol * SU2_TYPE::GetValue(MaxAbs(scalar, n));
+  REQUIRE(margin > 0.0);
+  for (auto i = 0ul; i < n; ++i) {
+    CHECK(SU2_TYPE::GetValue(vectorized[i]) == Approx(SU2_TYPE::GetValue(scalar[i])).margin(margin));
+  }
+}
+}  // namespace
+
+TEST_CASE("Vectorized turbulence residuals match the scalar ones", "[Turbulence SIMD]") {
+  for (const unsigned short nDim : {2, 3}) {
+    for (const std::string model : {"SA", "SST"}) {
+      CTurbProblem scalar(nDim, model, false);
+      CTurbProblem vectorized(nDim, model, true);
+      scalar.SetState();
+      vectorized.SetState();
+
+      const auto nPoint = scalar.geometry->GetnPoint();
+      const auto nPointDomain = scalar.geometry->GetnPointDomain();
+      const auto nVar = scalar.solvers[TURB_SOL]->GetnVar();
+      const auto n = nPointDomain * nVar;
+
+      /*--- Product with the Jacobian, to compare the matrices. ---*/
+      CSysVector<su2mixedfloat> u(nPoint, nPointDomain, nVar, 0.0), productScalar(u), productVectorized(u);
+      for (auto i = 0ul; i < u.GetLocSize(); ++i) u[i] = std::cos(0.37 * i) + 0.5;
+
+      /*--- Convective and viscous edge fluxes, then the source terms. ---*/
+      for (const bool sources : {false, true}) {
+        CAPTURE(nDim, model, sources);
+        scalar.ComputeResiduals(sources);
+        vectorized.ComputeResiduals(sources);
+
+        CheckVectors(vectorized.solvers[TURB_SOL]->LinSysRes, scalar.solvers[TURB_SOL]->LinSysRes, n, 1e-9);
+
+        scalar.solvers[TURB_SOL]->Jacobian.MatrixVectorProduct(u, productScalar, scalar.geometry.get(),
+                                                                scalar.config.get());
+        vectorized.solvers[TURB_SOL]->Jacobian.MatrixVectorProduct(u, productVectorized, vectorized.geometry.get(),
+                                                                    vectorized.config.get());
+        CheckVectors(productVectorized, productScalar, n, 1e-6);
+      }
+    }
+  }
+}